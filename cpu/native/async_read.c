@@ -18,12 +18,25 @@
  */
 
 #include <err.h>
+#include <errno.h>
 #include <signal.h>
+#include <stdbool.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <poll.h>
 
+#include "modules.h"
+
+#if IS_USED(MODULE_NATIVE_ASYNC_READ_EPOLL)
+#  ifndef __linux__
+#    error "native_async_read_epoll is only available on Linux"
+#  endif
+#  include <sys/epoll.h>
+#  include <sys/mman.h>
+#  include <sys/prctl.h>
+#endif
+
 #include "async_read.h"
 #include "native_internal.h"
 
@@ -33,8 +46,130 @@ static async_read_t pollers[ASYNC_READ_NUMOF];
 
 static void _sigio_child(int fd);
 
+#if IS_USED(MODULE_NATIVE_ASYNC_READ_EPOLL)
+static int _epoll_fd = -1;
+static pid_t _epoll_child;
+/* shared with the watcher, set while a SIGIO is on its way */
+static uint8_t *_epoll_pending;
+
+static void _epoll_watch(pid_t parent)
+{
+    struct epoll_event events[ASYNC_READ_NUMOF];
+    sigset_t sigmask;
+
+    /* RIOT's signal handlers have no business in this process */
+    sigfillset(&sigmask);
+    sigprocmask(SIG_BLOCK, &sigmask, NULL);
+    prctl(PR_SET_PDEATHSIG, SIGKILL);
+    if (getppid() != parent) {
+        real_exit(EXIT_SUCCESS);
+    }
+
+    while (1) {
+        /* all fds are armed one-shot, so every fd is reported once until
+         * the driver calls native_async_read_continue() */
+        if (epoll_wait(_epoll_fd, events, ASYNC_READ_NUMOF, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            kill(parent, SIGKILL);
+            err(EXIT_FAILURE, "epoll_watch: epoll_wait");
+        }
+        /* a single signal for everything that got ready until the ISR runs */
+        if (!__atomic_exchange_n(_epoll_pending, 1, __ATOMIC_ACQ_REL)) {
+            kill(parent, SIGIO);
+        }
+    }
+}
+
+static void _epoll_start(void)
+{
+    if ((_epoll_fd = epoll_create1(EPOLL_CLOEXEC)) < 0) {
+        err(EXIT_FAILURE, "native_async_read: epoll_create1");
+    }
+    if (_epoll_pending == NULL) {
+        _epoll_pending = mmap(NULL, sizeof(*_epoll_pending),
+                              PROT_READ | PROT_WRITE,
+                              MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        if (_epoll_pending == MAP_FAILED) {
+            err(EXIT_FAILURE, "native_async_read: mmap");
+        }
+    }
+    *_epoll_pending = 0;
+
+    pid_t parent = _native_pid;
+    if ((_epoll_child = real_fork()) == -1) {
+        err(EXIT_FAILURE, "native_async_read: fork");
+    }
+    if (_epoll_child == 0) {
+        _epoll_watch(parent);
+    }
+}
+
+static void _epoll_stop(void)
+{
+    if (_epoll_fd < 0) {
+        return;
+    }
+    kill(_epoll_child, SIGKILL);
+    real_close(_epoll_fd);
+    _epoll_fd = -1;
+}
+
+static int _epoll_ctl(int op, int fd)
+{
+    struct epoll_event event = {
+        .events = EPOLLIN | EPOLLPRI | EPOLLONESHOT,
+        .data.fd = fd,
+    };
+
+    return epoll_ctl(_epoll_fd, op, fd, &event);
+}
+
+static bool _epoll_add(int fd)
+{
+    if (_epoll_fd < 0) {
+        _epoll_start();
+    }
+    if (_epoll_ctl(EPOLL_CTL_ADD, fd) == 0) {
+        return true;
+    }
+    /* e.g. regular files, these fall back to signal driven I/O */
+    if (errno != EPERM) {
+        err(EXIT_FAILURE, "native_async_read: epoll_ctl(EPOLL_CTL_ADD)");
+    }
+    return false;
+}
+
+static void _epoll_rearm_idle(void)
+{
+    if (_epoll_fd < 0) {
+        return;
+    }
+    __atomic_store_n(_epoll_pending, 0, __ATOMIC_RELEASE);
+    /* fds that aren't readable anymore won't see a handler to re-arm them */
+    for (int i = 0; i < _next_index; i++) {
+        if (!(_fds[i].revents & _fds[i].events)) {
+            _epoll_ctl(EPOLL_CTL_MOD, _fds[i].fd);
+        }
+    }
+}
+#else
+static bool _epoll_add(int fd)
+{
+    (void)fd;
+    return false;
+}
+#endif
+
 static void _async_io_isr(void) {
-    if (real_poll(_fds, _next_index, 0) > 0) {
+    int ready = real_poll(_fds, _next_index, 0);
+
+#if IS_USED(MODULE_NATIVE_ASYNC_READ_EPOLL)
+    _epoll_rearm_idle();
+#endif
+
+    if (ready > 0) {
         for (int i = 0; i < _next_index; i++) {
             /* handle if one of the events has happened */
             if (_fds[i].revents & _fds[i].events) {
@@ -50,6 +185,9 @@ void native_async_read_setup(void) {
 
 void native_async_read_cleanup(void) {
     native_unregister_interrupt(SIGIO);
+#if IS_USED(MODULE_NATIVE_ASYNC_READ_EPOLL)
+    _epoll_stop();
+#endif
 
     for (int i = 0; i < _next_index; i++) {
         /* don't close stdin */
@@ -63,6 +201,11 @@ void native_async_read_cleanup(void) {
 }
 
 void native_async_read_continue(int fd) {
+#if IS_USED(MODULE_NATIVE_ASYNC_READ_EPOLL)
+    if (_epoll_fd >= 0) {
+        _epoll_ctl(EPOLL_CTL_MOD, fd);
+    }
+#endif
     for (int i = 0; i < _next_index; i++) {
         if (_fds[i].fd == fd && pollers[i].child_pid) {
             kill(pollers[i].child_pid, SIGCONT);
@@ -88,6 +231,14 @@ void native_async_read_add_handler(int fd, void *arg, native_async_read_callback
 
     _add_handler(fd, arg, handler);
 
+    if (_epoll_add(fd)) {
+        if (real_fcntl(fd, F_SETFL, O_NONBLOCK) == -1) {
+            err(EXIT_FAILURE, "native_async_read_add_handler(): fcntl(F_SETFL)");
+        }
+        _next_index++;
+        return;
+    }
+
     /* configure fds to send signals on io */
     if (real_fcntl(fd, F_SETOWN, _native_pid) == -1) {
         err(EXIT_FAILURE, "native_async_read_add_handler(): fcntl(F_SETOWN)");
@@ -112,6 +263,12 @@ void native_async_read_remove_handler(int fd)
         err(EXIT_FAILURE, "native_async_read_remove_handler(): fcntl(F_SETFL)");
     }
 
+#if IS_USED(MODULE_NATIVE_ASYNC_READ_EPOLL)
+    if (_epoll_fd >= 0) {
+        _epoll_ctl(EPOLL_CTL_DEL, fd);
+    }
+#endif
+
     unsigned i;
     for (i = 0; (i < (unsigned)_next_index) && (_fds[i].fd != fd); i++) { };
     if (i == (unsigned)_next_index) {
@@ -135,7 +292,9 @@ void native_async_read_add_int_handler(int fd, void *arg, native_async_read_call
 
     _add_handler(fd, arg, handler);
 
-    _sigio_child(_next_index);
+    if (!_epoll_add(fd)) {
+        _sigio_child(_next_index);
+    }
     _next_index++;
 }
 
@@ -14,6 +14,15 @@
 /**
  * @file
  * @brief  Multiple asynchronous read on file descriptors
+ *
+ * By default, file descriptors signal readiness with SIGIO, one signal per
+ * event, and interrupt file descriptors are watched by a child process each.
+ * On Linux, `USEMODULE += native_async_read_epoll` instead watches all file
+ * descriptors in a single child process using epoll. Every file descriptor
+ * then raises at most one event until @ref native_async_read_continue is
+ * called for it, and all events up to the next interrupt share a single
+ * SIGIO.
+ *
  * @author Takuo Yonezawa <Yonezawa-T2@mail.dnp.co.jp>
  */
 #ifndef ASYNC_READ_H
@@ -26,12 +26,28 @@ extern "C" {
 
 #include <stdint.h>
 #include <stdbool.h>
+
+#include "modules.h"
 #include "net/netdev.h"
 
+#include "net/ethernet.h"
 #include "net/ethernet/hdr.h"
 
 #include "net/if.h"
 
+/**
+ * @brief   Number of frames read from the TAP at once
+ *
+ * With module `netdev_tap_rx_batch` all frames pending on the TAP (up to this
+ * number) are read in one go when the driver is asked for a frame. The
+ * following frames are then served from memory, so that the SIGIO and
+ * `select()` round trip needed for every frame otherwise is only needed once
+ * per batch.
+ */
+#ifndef CONFIG_NETDEV_TAP_RX_BATCH_SIZE
+#define CONFIG_NETDEV_TAP_RX_BATCH_SIZE     (32U)
+#endif
+
 /* MARK: - Low-level ethernet driver for native tap interfaces */
 /**
  * @name Low-level ethernet driver for native tap interfaces
@@ -47,6 +63,22 @@ typedef struct netdev_tap {
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     bool promiscuous;                   /**< Flag for promiscuous mode */
     bool wired;                         /**< Flag for wired mode */
+#if IS_USED(MODULE_NETDEV_TAP_RX_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Frames read from the TAP but not yet received
+     *
+     * @note    Only available with module `netdev_tap_rx_batch`
+     */
+    uint8_t rx_buf[CONFIG_NETDEV_TAP_RX_BATCH_SIZE][ETHERNET_FRAME_LEN];
+    /**
+     * @brief   Lengths of the frames in netdev_tap_t::rx_buf
+     *
+     * @note    Only available with module `netdev_tap_rx_batch`
+     */
+    uint16_t rx_len[CONFIG_NETDEV_TAP_RX_BATCH_SIZE];
+    uint8_t rx_next;                    /**< next frame to receive */
+    uint8_t rx_num;                     /**< number of frames buffered */
+#endif
 } netdev_tap_t;
 
 /**
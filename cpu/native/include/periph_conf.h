@@ -53,6 +53,15 @@ extern "C" {
 #define TIMER_CHANNEL_NUMOF    (1U)    /**< Number of timer channels */
 /** @} */
 
+/* MARK: - RTT configuration */
+/**
+ * @name RTT configuration
+ * @{
+ */
+#define RTT_FREQUENCY       (32768U)
+#define RTT_MAX_VALUE       (0xffffffffU)
+/** @} */
+
 /* MARK: - xtimer configuration */
 /**
  * @name `xtimer` configuration
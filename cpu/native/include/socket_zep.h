@@ -47,6 +47,34 @@
  *     |       0       |       0       |       0       |       0       |
  *     +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
  *
+ * Shared memory medium
+ * ====================
+ *
+ * Instead of sending every frame through a ZEP dispatcher, nodes on the same
+ * host can exchange frames through a shared memory segment. Add
+ *
+ * ```
+ * USEMODULE += socket_zep_shm
+ * ```
+ *
+ * to your Makefile and start every node with `-z shm:<name>`. All nodes
+ * started with the same `<name>` share one medium. Each node owns a slot with
+ * a receive ring in the segment, a sender copies its frames directly into the
+ * rings of the nodes it has a link to. A UDP datagram on the loopback
+ * interface is only used to wake up a receiver whose ring ran empty.
+ *
+ * Every node publishes its addresses in its slot, so unicast frames are only
+ * copied to their destination and ACKs only to the sender of the acknowledged
+ * frame. Only broadcasts and nodes in promiscuous mode wake up the other
+ * processes, which keeps the medium usable with a hundred nodes and more.
+ *
+ * The segment also holds a link matrix with the probability of a frame from one
+ * node reaching another, which is used as LQI of the received frames. A new
+ * segment starts as a full mesh without losses, `dist/tools/zep_shm` can load
+ * a topology in the format of the ZEP dispatcher into it.
+ *
+ * All nodes on a medium must be built with the same
+ * @ref CONFIG_SOCKET_ZEP_SHM_NODES and @ref CONFIG_SOCKET_ZEP_SHM_RING_LEN.
  */
 
 /**
@@ -57,6 +85,7 @@
 #ifndef SOCKET_ZEP_H
 #define SOCKET_ZEP_H
 
+#include "modules.h"
 #include "net/netdev.h"
 #include "net/netdev/ieee802154.h"
 #include "net/ieee802154/radio.h"
@@ -67,6 +96,21 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Maximum number of nodes on a shared memory medium
+ */
+#ifndef CONFIG_SOCKET_ZEP_SHM_NODES
+#define CONFIG_SOCKET_ZEP_SHM_NODES     (128U)
+#endif
+
+/**
+ * @brief   Number of frames a node can hold in its receive ring on a shared
+ *          memory medium
+ */
+#ifndef CONFIG_SOCKET_ZEP_SHM_RING_LEN
+#define CONFIG_SOCKET_ZEP_SHM_RING_LEN  (16U)
+#endif
+
 /**
  * @brief   ZEP device initialization parameters
  */
@@ -75,6 +119,12 @@ typedef struct {
     char *local_port;   /**< local address string */
     char *remote_addr;  /**< remote address string */
     char *remote_port;  /**< local address string */
+    /**
+     * @brief   name of the shared memory medium, NULL to use UDP
+     *
+     * @note    Only used with module `socket_zep_shm`
+     */
+    char *shm_name;
 } socket_zep_params_t;
 
 /**
@@ -121,6 +171,11 @@ typedef struct {
     ieee802154_filter_mode_t filter_mode;   /**< frame filter mode */
     zepdev_state_t state;                   /**< device state machine */
     bool send_hello;                        /**< send HELLO packet on connect */
+#if IS_USED(MODULE_SOCKET_ZEP_SHM) || defined(DOXYGEN)
+    void *shm;                              /**< shared memory medium */
+    unsigned shm_slot;                      /**< own slot on the medium */
+    unsigned shm_peer;                      /**< sender of the last frame */
+#endif
 } socket_zep_t;
 
 /**
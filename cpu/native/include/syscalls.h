@@ -59,6 +59,7 @@ __SPECIFIER int (*real_connect)(int socket, ...);
 __SPECIFIER int (*real_printf)(const char *format, ...);
 __SPECIFIER int (*real_getaddrinfo)(const char *node, ...);
 __SPECIFIER int (*real_getifaddrs)(struct ifaddrs **ifap);
+__SPECIFIER int (*real_getsockname)(int socket, ...);
 __SPECIFIER int (*real_gettimeofday)(struct timeval *t, ...);
 __SPECIFIER int (*real_getpid)(void);
 __SPECIFIER int (*real_chdir)(const char *path);
@@ -92,6 +93,7 @@ __SPECIFIER int (*real_fgetc)(FILE *stream);
 __SPECIFIER mode_t (*real_umask)(mode_t cmask);
 __SPECIFIER ssize_t (*real_writev)(int fildes, const struct iovec *iov, int iovcnt);
 __SPECIFIER ssize_t (*real_send)(int sockfd, const void *buf, size_t len, int flags);
+__SPECIFIER ssize_t (*real_sendto)(int sockfd, const void *buf, size_t len, int flags, ...);
 __SPECIFIER off_t (*real_lseek)(int fd, off_t offset, int whence);
 __SPECIFIER off_t (*real_fstat)(int fd, struct stat *statbuf);
 __SPECIFIER int (*real_fsync)(int fd);
@@ -126,6 +126,11 @@ static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
             *((bool*)value) = (bool)_get_promiscuous(dev);
             res = sizeof(bool);
             break;
+        case NETOPT_RX_POLL:
+            /* recv() returns 0 when the TAP is drained */
+            *((netopt_enable_t *)value) = NETOPT_ENABLE;
+            res = sizeof(netopt_enable_t);
+            break;
         case NETOPT_IS_WIRED:
             if (!_get_wired(dev)) {
                 res = -ENOTSUP;
@@ -189,18 +194,34 @@ static const netdev_driver_t netdev_driver_tap = {
 };
 
 /* driver implementation */
-static inline bool _is_addr_broadcast(uint8_t *addr)
+static inline bool _is_addr_broadcast(const uint8_t *addr)
 {
     return ((addr[0] == 0xff) && (addr[1] == 0xff) && (addr[2] == 0xff) &&
             (addr[3] == 0xff) && (addr[4] == 0xff) && (addr[5] == 0xff));
 }
 
-static inline bool _is_addr_multicast(uint8_t *addr)
+static inline bool _is_addr_multicast(const uint8_t *addr)
 {
     /* source: http://ieee802.org/secmail/pdfocSP2xXA6d.pdf */
     return (addr[0] & 0x01);
 }
 
+static bool _is_for_me(netdev_tap_t *dev, const void *buf)
+{
+    const ethernet_hdr_t *hdr = buf;
+
+    if (!(dev->promiscuous) && !_is_addr_multicast(hdr->dst) &&
+        !_is_addr_broadcast(hdr->dst) &&
+        (memcmp(hdr->dst, dev->addr, ETHERNET_ADDR_LEN) != 0)) {
+        DEBUG("netdev_tap: received for %02x:%02x:%02x:%02x:%02x:%02x\n"
+              "That's not me => Dropped\n",
+              hdr->dst[0], hdr->dst[1], hdr->dst[2],
+              hdr->dst[3], hdr->dst[4], hdr->dst[5]);
+        return false;
+    }
+    return true;
+}
+
 static void _continue_reading(netdev_tap_t *dev)
 {
     /* work around lost signals */
@@ -228,6 +249,74 @@ static void _continue_reading(netdev_tap_t *dev)
     _native_pending_syscalls_down();
 }
 
+#if IS_USED(MODULE_NETDEV_TAP_RX_BATCH)
+static void _rx_fill(netdev_tap_t *dev)
+{
+    dev->rx_next = 0;
+    dev->rx_num = 0;
+    /* bound the reads, not the frames kept, so that a flood of frames for
+     * other hosts can't keep us here */
+    for (unsigned i = 0; i < CONFIG_NETDEV_TAP_RX_BATCH_SIZE; i++) {
+        uint8_t *frame = dev->rx_buf[dev->rx_num];
+        int nread = real_read(dev->tap_fd, frame, ETHERNET_FRAME_LEN);
+
+        if (nread < 0) {
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+                err(EXIT_FAILURE, "netdev_tap: read");
+            }
+            /* TAP is drained, the next frame raises SIGIO again */
+            break;
+        }
+        if (nread == 0) {
+            DEBUG("netdev_tap: ignoring null-event\n");
+            break;
+        }
+        if (_is_for_me(dev, frame)) {
+            dev->rx_len[dev->rx_num++] = nread;
+        }
+    }
+    DEBUG("netdev_tap: read %u frames\n", dev->rx_num);
+}
+
+static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
+{
+    netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
+    int res;
+    (void)info;
+
+    if (dev->rx_next == dev->rx_num) {
+        _rx_fill(dev);
+        if (dev->rx_num == 0) {
+            _continue_reading(dev);
+            return 0;
+        }
+    }
+
+    res = dev->rx_len[dev->rx_next];
+    if (!buf) {
+        if (len == 0) {
+            return res;
+        }
+        DEBUG("netdev_tap: discarding the frame\n");
+    }
+    else if (len < (size_t)res) {
+        DEBUG("netdev_tap: buffer too small, discarding the frame\n");
+        res = -ENOBUFS;
+    }
+    else {
+        memcpy(buf, dev->rx_buf[dev->rx_next], res);
+    }
+
+    if (++dev->rx_next < dev->rx_num) {
+        /* serve the next buffered frame without waiting for SIGIO */
+        netdev_trigger_event_isr(netdev);
+    }
+    else {
+        _continue_reading(dev);
+    }
+    return res;
+}
+#else
 static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 {
     netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
@@ -262,15 +351,7 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     DEBUG("netdev_tap: read %d bytes\n", nread);
 
     if (nread > 0) {
-        ethernet_hdr_t *hdr = (ethernet_hdr_t *)buf;
-        if (!(dev->promiscuous) && !_is_addr_multicast(hdr->dst) &&
-            !_is_addr_broadcast(hdr->dst) &&
-            (memcmp(hdr->dst, dev->addr, ETHERNET_ADDR_LEN) != 0)) {
-            DEBUG("netdev_tap: received for %02x:%02x:%02x:%02x:%02x:%02x\n"
-                  "That's not me => Dropped\n",
-                  hdr->dst[0], hdr->dst[1], hdr->dst[2],
-                  hdr->dst[3], hdr->dst[4], hdr->dst[5]);
-
+        if (!_is_for_me(dev, buf)) {
             native_async_read_continue(dev->tap_fd);
 
             return 0;
@@ -296,6 +377,7 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 
     return -1;
 }
+#endif /* IS_USED(MODULE_NETDEV_TAP_RX_BATCH) */
 
 static int _send(netdev_t *netdev, const iolist_t *iolist)
 {
@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @file
+ * @ingroup cpu_native
+ * @ingroup drivers_periph_rtt
+ * @brief   Native CPU periph/rtt.h implementation
+ * @{
+ *
+ * The counter is derived from the monotonic system clock, alarms and
+ * overflows are emulated with ztimer. Hence the RTT can not be used as a
+ * ztimer backend on native.
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "cpu.h"
+#include "irq.h"
+#include "panic.h"
+#include "periph/rtt.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#include "native_internal.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* The counter is tracked with 64 bit, so alarms and overflows are compared
+ * against absolute targets and never fire early. The counter value is
+ * _start + ticks since _epoch_ns, truncated to 32 bit. */
+static uint64_t _start;
+static uint64_t _epoch_ns;
+static bool _powered;
+
+static ztimer_t _alarm_timer;
+static rtt_cb_t _alarm_cb;
+static void *_alarm_arg;
+static uint32_t _alarm;
+static uint64_t _alarm_target;
+
+static ztimer_t _overflow_timer;
+static rtt_cb_t _overflow_cb;
+static void *_overflow_arg;
+static uint64_t _overflow_target;
+
+static uint64_t _now_ns(void)
+{
+    struct timespec t;
+
+    _native_syscall_enter();
+    if (clock_gettime(CLOCK_MONOTONIC, &t) == -1) {
+        core_panic(PANIC_GENERAL_ERROR, "Failed to read monotonic clock");
+    }
+    _native_syscall_leave();
+
+    return (uint64_t)t.tv_sec * NS_PER_SEC + t.tv_nsec;
+}
+
+static uint64_t _ticks64(void)
+{
+    uint64_t ns = _now_ns() - _epoch_ns;
+
+    /* split the conversion, ns * RTT_FREQUENCY overflows after 6.5 days */
+    return _start + (ns / NS_PER_SEC) * RTT_FREQUENCY +
+           (ns % NS_PER_SEC) * RTT_FREQUENCY / NS_PER_SEC;
+}
+
+/* ztimer can't wait for more than UINT32_MAX us, so long waits are split and
+ * the ISRs re-arm the timer until the target is reached */
+static void _arm(ztimer_t *timer, uint64_t target)
+{
+    uint64_t now = _ticks64();
+    uint64_t us = 0;
+
+    if (target > now) {
+        /* round up, so the target is reached after the wait */
+        us = ((target - now) * US_PER_SEC + RTT_FREQUENCY - 1) / RTT_FREQUENCY;
+    }
+    ztimer_set(ZTIMER_USEC, timer, (us > UINT32_MAX) ? UINT32_MAX : us);
+}
+
+static void _set_alarm_target(void)
+{
+    uint64_t now = _ticks64();
+
+    _alarm_target = now + (uint32_t)(_alarm - (uint32_t)now);
+}
+
+static void _alarm_isr(void *arg)
+{
+    (void)arg;
+
+    if (_ticks64() < _alarm_target) {
+        _arm(&_alarm_timer, _alarm_target);
+        return;
+    }
+
+    rtt_cb_t cb = _alarm_cb;
+    _alarm_cb = NULL;
+    if (cb) {
+        cb(_alarm_arg);
+    }
+}
+
+static void _overflow_isr(void *arg)
+{
+    (void)arg;
+
+    if (_ticks64() < _overflow_target) {
+        _arm(&_overflow_timer, _overflow_target);
+        return;
+    }
+
+    _overflow_target += (uint64_t)RTT_MAX_VALUE + 1;
+    if (_overflow_cb) {
+        _arm(&_overflow_timer, _overflow_target);
+        _overflow_cb(_overflow_arg);
+    }
+}
+
+void rtt_init(void)
+{
+    DEBUG("rtt_init\n");
+
+    _alarm_timer.callback = _alarm_isr;
+    _overflow_timer.callback = _overflow_isr;
+    _epoch_ns = _now_ns();
+    _start = 0;
+    _overflow_target = (uint64_t)RTT_MAX_VALUE + 1;
+
+    rtt_poweron();
+}
+
+void rtt_set_overflow_cb(rtt_cb_t cb, void *arg)
+{
+    unsigned state = irq_disable();
+
+    _overflow_cb = cb;
+    _overflow_arg = arg;
+    if (_powered) {
+        _arm(&_overflow_timer, _overflow_target);
+    }
+    irq_restore(state);
+}
+
+void rtt_clear_overflow_cb(void)
+{
+    unsigned state = irq_disable();
+
+    ztimer_remove(ZTIMER_USEC, &_overflow_timer);
+    _overflow_cb = NULL;
+    irq_restore(state);
+}
+
+uint32_t rtt_get_counter(void)
+{
+    return _ticks64();
+}
+
+void rtt_set_counter(uint32_t counter)
+{
+    unsigned state = irq_disable();
+
+    _epoch_ns = _now_ns();
+    _start = counter;
+    _overflow_target = (uint64_t)RTT_MAX_VALUE + 1;
+    _set_alarm_target();
+    if (_alarm_cb && _powered) {
+        _arm(&_alarm_timer, _alarm_target);
+    }
+    if (_overflow_cb && _powered) {
+        _arm(&_overflow_timer, _overflow_target);
+    }
+    irq_restore(state);
+}
+
+void rtt_set_alarm(uint32_t alarm, rtt_cb_t cb, void *arg)
+{
+    unsigned state = irq_disable();
+
+    _alarm = alarm;
+    _alarm_cb = cb;
+    _alarm_arg = arg;
+    _set_alarm_target();
+    if (_powered) {
+        _arm(&_alarm_timer, _alarm_target);
+    }
+    irq_restore(state);
+}
+
+uint32_t rtt_get_alarm(void)
+{
+    return _alarm;
+}
+
+void rtt_clear_alarm(void)
+{
+    unsigned state = irq_disable();
+
+    ztimer_remove(ZTIMER_USEC, &_alarm_timer);
+    _alarm_cb = NULL;
+    irq_restore(state);
+}
+
+void rtt_poweron(void)
+{
+    unsigned state = irq_disable();
+
+    _powered = true;
+    if (_alarm_cb) {
+        _arm(&_alarm_timer, _alarm_target);
+    }
+    if (_overflow_cb) {
+        _arm(&_overflow_timer, _overflow_target);
+    }
+    irq_restore(state);
+}
+
+void rtt_poweroff(void)
+{
+    unsigned state = irq_disable();
+
+    /* the counter keeps running, as it is derived from the system clock */
+    ztimer_remove(ZTIMER_USEC, &_alarm_timer);
+    ztimer_remove(ZTIMER_USEC, &_overflow_timer);
+    _powered = false;
+    irq_restore(state);
+}
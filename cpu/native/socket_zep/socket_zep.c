@@ -31,6 +31,7 @@
 
 #include "net/ieee802154/radio.h"
 #include "socket_zep.h"
+#include "socket_zep_shm.h"
 #include "random.h"
 
 #define ENABLE_DEBUG 0
@@ -67,6 +68,23 @@ static const uint8_t lqi_to_rssi[256] = {
     140, 141, 141, 142, 142, 143, 143, 144, 144, 145, 145, 146, 146, 147, 147, 148,
 };
 
+static inline bool _use_shm(const socket_zep_t *dev)
+{
+    return IS_USED(MODULE_SOCKET_ZEP_SHM) && (dev->params->shm_name != NULL);
+}
+
+static void _send_buf(socket_zep_t *dev, const void *buf, size_t len)
+{
+    if (_use_shm(dev)) {
+        socket_zep_shm_send(dev, buf, len);
+    }
+    else {
+        int res = real_write(dev->sock_fd, buf, len);
+        DEBUG("socket_zep::send_buf: wrote %d bytes\n", res);
+        (void)res;
+    }
+}
+
 static size_t _zep_hdr_fill_v2_data(socket_zep_t *dev, zep_v2_data_hdr_t *hdr,
                                     size_t payload_len)
 {
@@ -115,6 +133,10 @@ static void _continue_reading(socket_zep_t *dev)
 
     dev->state = ZEPDEV_STATE_RX_ON;
 
+    if (_use_shm(dev)) {
+        socket_zep_shm_continue(dev);
+    }
+
     if (real_select(dev->sock_fd + 1, &rfds, NULL, NULL, &t) == 1) {
         int sig = SIGIO;
         extern int _signal_pipe_fd[2];
@@ -128,6 +150,12 @@ static void _continue_reading(socket_zep_t *dev)
     _native_pending_syscalls_down();
 }
 
+static inline bool _is_promisc(ieee802154_filter_mode_t mode)
+{
+    return (mode == IEEE802154_FILTER_PROMISC) ||
+           (mode == IEEE802154_FILTER_SNIFFER);
+}
+
 static inline bool _dst_not_me(socket_zep_t *dev, const void *buf)
 {
     uint8_t dst_addr[IEEE802154_LONG_ADDRESS_LEN] = { 0 };
@@ -136,8 +164,7 @@ static inline bool _dst_not_me(socket_zep_t *dev, const void *buf)
     bool is_ack = *(uint8_t *)buf & IEEE802154_FCF_TYPE_ACK;
 
     /* no need to check address if we are in promiscuous mode */
-    if (dev->filter_mode == IEEE802154_FILTER_PROMISC ||
-        dev->filter_mode == IEEE802154_FILTER_SNIFFER) {
+    if (_is_promisc(dev->filter_mode)) {
         return false;
     }
 
@@ -262,8 +289,9 @@ static void _send_ack(void *arg)
     ieee802154_dev_t *dev = arg;
     socket_zep_t *zepdev = dev->priv;
     const uint8_t *rxbuf = &zepdev->rcv_buf[sizeof(zep_v2_data_hdr_t)];
-    uint8_t ack[3];
-    zep_v2_data_hdr_t hdr;
+    uint8_t frame[sizeof(zep_v2_data_hdr_t) + 3 + sizeof(uint16_t)];
+    zep_v2_data_hdr_t *hdr = (zep_v2_data_hdr_t *)frame;
+    uint8_t *ack = &frame[sizeof(*hdr)];
 
     /* sending ACK should only happen if we received a frame */
     assert(zepdev->state == ZEPDEV_STATE_RX_RECV);
@@ -272,7 +300,7 @@ static void _send_ack(void *arg)
 
     DEBUG("socket_zep::send_ack: seq_no: %u\n", rxbuf[2]);
 
-    _zep_hdr_fill(zepdev, &hdr.hdr, sizeof(ack) + IEEE802154_FCF_LEN);
+    _zep_hdr_fill(zepdev, &hdr->hdr, 3 + IEEE802154_FCF_LEN);
 
     ack[0] = IEEE802154_FCF_TYPE_ACK; /* FCF */
     ack[1] = 0; /* FCF */
@@ -280,10 +308,9 @@ static void _send_ack(void *arg)
 
     /* calculate checksum */
     uint16_t chksum = crc16_ccitt_false_update(0, ack, 3);
+    memcpy(&ack[3], &chksum, sizeof(chksum));
 
-    real_send(zepdev->sock_fd, &hdr, sizeof(hdr), MSG_MORE);
-    real_send(zepdev->sock_fd, ack, sizeof(ack), MSG_MORE);
-    real_send(zepdev->sock_fd, &chksum, sizeof(chksum), 0);
+    _send_buf(zepdev, frame, sizeof(frame));
 
     dev->cb(dev, IEEE802154_RADIO_INDICATION_RX_DONE);
 }
@@ -295,8 +322,7 @@ static void _send_frame(void *arg)
 
     assert(zepdev->state == ZEPDEV_STATE_TX);
 
-    int res = real_write(zepdev->sock_fd, zepdev->snd_buf, zepdev->snd_len);
-    DEBUG("socket_zep::send_frame: wrote %d bytes\n", res);
+    _send_buf(zepdev, zepdev->snd_buf, zepdev->snd_len);
 
     zepdev->state = ZEPDEV_STATE_IDLE;
     dev->cb(dev, IEEE802154_RADIO_CONFIRM_TX_DONE);
@@ -309,15 +335,35 @@ static void _socket_isr(int fd, void *arg)
     int res;
 
     if (zepdev->state != ZEPDEV_STATE_RX_ON) {
-        res = real_recv(zepdev->sock_fd, &res, sizeof(res), MSG_TRUNC);
+        if (_use_shm(zepdev)) {
+            res = socket_zep_shm_recv(zepdev, NULL, 0);
+        }
+        else {
+            res = real_recv(zepdev->sock_fd, &res, sizeof(res), MSG_TRUNC);
+        }
         DEBUG("socket_zep::_socket_isr: discard frame (%d bytes, state %u)\n", res, zepdev->state);
         return;
     }
 
+    if (_use_shm(zepdev)) {
+        res = socket_zep_shm_recv(zepdev, zepdev->rcv_buf, sizeof(zepdev->rcv_buf));
+        if (res == -EAGAIN) {
+            /* woken up after the ring was drained */
+            _continue_reading(zepdev);
+            return;
+        }
+        if (res == -EMSGSIZE) {
+            DEBUG("socket_zep::_socket_isr: frame exceeds the receive buffer\n");
+            _continue_reading(zepdev);
+            return;
+        }
+    }
+    else {
+        res = real_recv(zepdev->sock_fd, zepdev->rcv_buf, sizeof(zepdev->rcv_buf), 0);
+    }
+
     zepdev->rcv_len = 0;
     zepdev->state = ZEPDEV_STATE_RX_RECV;
-
-    res = real_recv(zepdev->sock_fd, zepdev->rcv_buf, sizeof(zepdev->rcv_buf), 0);
     DEBUG("socket_zep::_socket_isr: %d bytes on %d\n", res, fd);
 
     if (res < (int)sizeof(zep_v2_data_hdr_t)) {
@@ -375,7 +421,8 @@ out:
 void socket_zep_setup(socket_zep_t *dev, const socket_zep_params_t *params)
 {
     DEBUG("socket_zep_setup(%p, %p)\n", (void *)dev, (void *)params);
-    assert((params->remote_addr != NULL) && (params->remote_port != NULL));
+    assert((IS_USED(MODULE_SOCKET_ZEP_SHM) && (params->shm_name != NULL)) ||
+           ((params->remote_addr != NULL) && (params->remote_port != NULL)));
 
     dev->params = params;
 
@@ -387,6 +434,9 @@ void socket_zep_cleanup(socket_zep_t *dev)
     assert(dev != NULL);
     /* cleanup signal handling */
     native_async_read_cleanup();
+    if (_use_shm(dev)) {
+        socket_zep_shm_detach(dev);
+    }
     /* close the socket */
     close(dev->sock_fd);
     dev->sock_fd = 0;
@@ -398,6 +448,14 @@ static int _request_on(ieee802154_dev_t *dev)
 
     DEBUG("socket_zep::request_on()\n");
 
+    if (_use_shm(zepdev)) {
+        zepdev->sock_fd = socket_zep_shm_attach(zepdev);
+        native_async_read_add_handler(zepdev->sock_fd, dev, _socket_isr);
+        /* other nodes on the medium find us by our slot */
+        zepdev->send_hello = false;
+        return 0;
+    }
+
     int res = _bind_local(zepdev->params);
 
     if (res < 0) {
@@ -431,6 +489,9 @@ static int _off(ieee802154_dev_t *dev)
 
     DEBUG("socket_zep::off()\n");
 
+    if (_use_shm(zepdev)) {
+        socket_zep_shm_detach(zepdev);
+    }
     close(zepdev->sock_fd);
     zepdev->sock_fd = -1;
     return 0;
@@ -474,9 +535,15 @@ static int _config_addr_filter(ieee802154_dev_t *dev, ieee802154_af_cmd_t cmd, c
     switch (cmd) {
     case IEEE802154_AF_SHORT_ADDR:
         memcpy(zepdev->addr_short, value, IEEE802154_SHORT_ADDRESS_LEN);
+        if (_use_shm(zepdev)) {
+            socket_zep_shm_set_addr(zepdev);
+        }
         break;
     case IEEE802154_AF_EXT_ADDR:
         memcpy(zepdev->addr_long, value, IEEE802154_LONG_ADDRESS_LEN);
+        if (_use_shm(zepdev)) {
+            socket_zep_shm_set_addr(zepdev);
+        }
         _send_zep_hello(zepdev);
         break;
     case IEEE802154_AF_PANID:
@@ -501,7 +568,12 @@ static int _config_src_addr_match(ieee802154_dev_t *dev, ieee802154_src_match_t
 static int _set_frame_filter_mode(ieee802154_dev_t *dev, ieee802154_filter_mode_t mode)
 {
     socket_zep_t *zepdev = dev->priv;
+    bool promisc = _is_promisc(zepdev->filter_mode);
+
     zepdev->filter_mode = mode;
+    if (_use_shm(zepdev) && (_is_promisc(mode) != promisc)) {
+        socket_zep_shm_set_addr(zepdev);
+    }
     return 0;
 }
 
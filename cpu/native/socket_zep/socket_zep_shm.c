@@ -0,0 +1,449 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @file
+ * @brief   Shared memory medium for socket ZEP
+ */
+
+#include <assert.h>
+#include <err.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+
+#include "irq.h"
+#include "net/ieee802154.h"
+#include "random.h"
+#include "socket_zep_shm.h"
+/* must come after byteorder.h, which is included by socket_zep_shm.h */
+#include "native_internal.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* time to wait for a slot lock before checking whether its owner died */
+#define LOCK_TIMEOUT_NS     (10000000L)
+
+/* set in the lock word while other nodes wait for the lock */
+#define LOCK_WAITERS        (0x80000000U)
+
+/* time another node may take to set up the segment before it is assumed
+ * to have died while doing so */
+#define SETUP_TIMEOUT_NS    (1000000000LL)
+
+/* name of the segment is "/riot_zep_<name>" */
+#define SHM_NAME_PREFIX     "/riot_zep_"
+#define SHM_NAME_MAX        (64U)
+
+/* PID of this node, stored in the slots and locks it owns */
+static int32_t _pid;
+
+static bool _owner_alive(int32_t pid)
+{
+    return (pid != 0) && ((kill(pid, 0) == 0) || (errno != ESRCH));
+}
+
+/* The lock word holds the PID of the owner, so a lock left behind by a node
+ * that died can be taken over. Frames are only published or consumed by
+ * updating head or tail last, so a slot is consistent at any point.
+ *
+ * Must be called with interrupts disabled: a RIOT thread switched in while
+ * the lock is held would wait for it forever. */
+static void _lock(socket_zep_shm_node_t *node)
+{
+    const struct timespec timeout = { .tv_nsec = LOCK_TIMEOUT_NS };
+    uint32_t owner = 0;
+
+    while (!__atomic_compare_exchange_n(&node->lock, &owner, _pid, false,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        /* sleep instead of spinning, the owner may be waiting for the CPU */
+        if (!(owner & LOCK_WAITERS) &&
+            !__atomic_compare_exchange_n(&node->lock, &owner,
+                                         owner | LOCK_WAITERS, false,
+                                         __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            continue;
+        }
+        owner |= LOCK_WAITERS;
+        if ((syscall(SYS_futex, &node->lock, FUTEX_WAIT, owner, &timeout,
+                     NULL, 0) < 0) && (errno == ETIMEDOUT) &&
+            !_owner_alive(owner & ~LOCK_WAITERS)) {
+            DEBUG("socket_zep_shm: taking over lock of dead node %" PRIu32 "\n",
+                  owner & ~LOCK_WAITERS);
+            __atomic_compare_exchange_n(&node->lock, &owner, 0, false,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        }
+        owner = 0;
+    }
+}
+
+static void _unlock(socket_zep_shm_node_t *node)
+{
+    if (__atomic_exchange_n(&node->lock, 0, __ATOMIC_RELEASE) & LOCK_WAITERS) {
+        /* the waiters that lose the race will set the flag again */
+        syscall(SYS_futex, &node->lock, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+    }
+}
+
+static int64_t _now_ns(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (int64_t)t.tv_sec * 1000000000LL + t.tv_nsec;
+}
+
+static socket_zep_shm_t *_map(const char *name)
+{
+    char path[SHM_NAME_MAX];
+    struct stat st;
+    socket_zep_shm_t *shm;
+    int fd;
+
+    if (snprintf(path, sizeof(path), SHM_NAME_PREFIX "%s", name) >=
+        (int)sizeof(path)) {
+        errx(EXIT_FAILURE, "ZEP: shared memory name too long: %s", name);
+    }
+    if ((fd = shm_open(path, O_RDWR | O_CREAT, 0600)) < 0) {
+        err(EXIT_FAILURE, "ZEP: unable to open shared memory %s", path);
+    }
+    if (real_fstat(fd, &st) < 0) {
+        err(EXIT_FAILURE, "ZEP: unable to stat shared memory %s", path);
+    }
+    /* all nodes agree on the size, so concurrent creators are fine */
+    if ((st.st_size == 0) && (ftruncate(fd, sizeof(*shm)) < 0)) {
+        err(EXIT_FAILURE, "ZEP: unable to size shared memory %s", path);
+    }
+    else if ((st.st_size != 0) && (st.st_size != sizeof(*shm))) {
+        errx(EXIT_FAILURE, "ZEP: shared memory %s was created with a "
+             "different CONFIG_SOCKET_ZEP_SHM_NODES or _RING_LEN", path);
+    }
+    shm = mmap(NULL, sizeof(*shm), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    real_close(fd);
+    if (shm == MAP_FAILED) {
+        err(EXIT_FAILURE, "ZEP: unable to map shared memory %s", path);
+    }
+
+    uint32_t expected = 0;
+    if (__atomic_compare_exchange_n(&shm->init, &expected, 1, false,
+                                    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        DEBUG("socket_zep_shm: setting up %s\n", path);
+        shm->nodes = CONFIG_SOCKET_ZEP_SHM_NODES;
+        shm->ring_len = CONFIG_SOCKET_ZEP_SHM_RING_LEN;
+        shm->node_offset = offsetof(socket_zep_shm_t, node);
+        shm->node_size = sizeof(socket_zep_shm_node_t);
+        /* full mesh without losses */
+        memset(shm->link, SOCKET_ZEP_SHM_LINK_PERFECT, sizeof(shm->link));
+        __atomic_store_n(&shm->magic, SOCKET_ZEP_SHM_MAGIC, __ATOMIC_RELEASE);
+    }
+    else {
+        /* another node is setting up the segment right now */
+        int64_t deadline = _now_ns() + SETUP_TIMEOUT_NS;
+
+        while (__atomic_load_n(&shm->magic, __ATOMIC_ACQUIRE) !=
+               SOCKET_ZEP_SHM_MAGIC) {
+            if (_now_ns() > deadline) {
+                errx(EXIT_FAILURE, "ZEP: shared memory %s was never set up, "
+                     "remove /dev/shm%s if no other node uses it", path, path);
+            }
+            syscall(SYS_sched_yield);
+        }
+    }
+    if ((shm->nodes != CONFIG_SOCKET_ZEP_SHM_NODES) ||
+        (shm->ring_len != CONFIG_SOCKET_ZEP_SHM_RING_LEN)) {
+        errx(EXIT_FAILURE, "ZEP: shared memory %s was created with a "
+             "different CONFIG_SOCKET_ZEP_SHM_NODES or _RING_LEN", path);
+    }
+
+    return shm;
+}
+
+static int _doorbell_open(socket_zep_shm_node_t *node)
+{
+    static const struct addrinfo hints = { .ai_family = AF_INET,
+                                           .ai_socktype = SOCK_DGRAM,
+                                           .ai_flags = AI_NUMERICHOST };
+    struct sockaddr_storage addr;
+    socklen_t addr_len = sizeof(addr);
+    struct addrinfo *ai = NULL;
+    int fd = -1;
+
+    /* any free port on the loopback interface */
+    if ((real_getaddrinfo("127.0.0.1", "0", &hints, &ai) == 0) &&
+        ((fd = real_socket(ai->ai_family, ai->ai_socktype,
+                           ai->ai_protocol)) >= 0) &&
+        (real_bind(fd, ai->ai_addr, ai->ai_addrlen) == 0) &&
+        (real_getsockname(fd, (struct sockaddr *)&addr, &addr_len) == 0) &&
+        (addr_len <= sizeof(node->wake_addr))) {
+        memcpy(node->wake_addr, &addr, addr_len);
+        node->wake_addr_len = addr_len;
+    }
+    else {
+        err(EXIT_FAILURE, "ZEP: unable to open wake-up socket");
+    }
+    real_freeaddrinfo(ai);
+
+    return fd;
+}
+
+static void _doorbell_ring(socket_zep_t *dev, const socket_zep_shm_node_t *node)
+{
+    static const uint8_t bell;
+
+    real_sendto(dev->sock_fd, &bell, sizeof(bell), MSG_DONTWAIT,
+                (const struct sockaddr *)node->wake_addr, node->wake_addr_len);
+}
+
+static void _doorbell_drain(socket_zep_t *dev)
+{
+    uint8_t bell;
+
+    while (real_recv(dev->sock_fd, &bell, sizeof(bell), MSG_DONTWAIT) >= 0) {}
+}
+
+int socket_zep_shm_attach(socket_zep_t *dev)
+{
+    /* slots of this PID are left over from the image before a reboot */
+    static bool reclaim_own = true;
+    socket_zep_shm_t *shm = _map(dev->params->shm_name);
+    unsigned state = irq_disable();
+
+    if (reclaim_own) {
+        _pid = real_getpid();
+        for (unsigned i = 0; i < CONFIG_SOCKET_ZEP_SHM_NODES; i++) {
+            int32_t owner = _pid;
+            __atomic_compare_exchange_n(&shm->node[i].pid, &owner, 0, false,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+            /* the image may have been replaced while holding a lock */
+            uint32_t locked = _pid;
+            if (!__atomic_compare_exchange_n(&shm->node[i].lock, &locked, 0,
+                                             false, __ATOMIC_RELEASE,
+                                             __ATOMIC_RELAXED) &&
+                (locked == (_pid | LOCK_WAITERS))) {
+                _unlock(&shm->node[i]);
+            }
+        }
+        reclaim_own = false;
+    }
+
+    for (unsigned i = 0; i < CONFIG_SOCKET_ZEP_SHM_NODES; i++) {
+        socket_zep_shm_node_t *node = &shm->node[i];
+        int32_t owner = __atomic_load_n(&node->pid, __ATOMIC_ACQUIRE);
+
+        if (_owner_alive(owner)) {
+            continue;
+        }
+        if (!__atomic_compare_exchange_n(&node->pid, &owner, _pid, false,
+                                         __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+            continue;
+        }
+        int fd = _doorbell_open(node);
+
+        _lock(node);
+        node->armed = 1;
+        memset(node->addr_long, 0, sizeof(node->addr_long));
+        memset(node->addr_short, 0, sizeof(node->addr_short));
+        node->promisc = 0;
+        node->head = 0;
+        node->tail = 0;
+        node->dropped = 0;
+        _unlock(node);
+        irq_restore(state);
+
+        DEBUG("socket_zep_shm: attached to %s as node %u\n",
+              dev->params->shm_name, i);
+        dev->shm = shm;
+        dev->shm_slot = i;
+        return fd;
+    }
+    errx(EXIT_FAILURE, "ZEP: no free slot on shared memory %s",
+         dev->params->shm_name);
+}
+
+void socket_zep_shm_detach(socket_zep_t *dev)
+{
+    socket_zep_shm_t *shm = dev->shm;
+
+    if (shm == NULL) {
+        return;
+    }
+    __atomic_store_n(&shm->node[dev->shm_slot].pid, 0, __ATOMIC_RELEASE);
+    munmap(shm, sizeof(*shm));
+    dev->shm = NULL;
+}
+
+void socket_zep_shm_set_addr(socket_zep_t *dev)
+{
+    socket_zep_shm_t *shm = dev->shm;
+
+    if (shm == NULL) {
+        return;
+    }
+
+    socket_zep_shm_node_t *node = &shm->node[dev->shm_slot];
+    unsigned state = irq_disable();
+
+    _lock(node);
+    memcpy(node->addr_long, dev->addr_long, sizeof(node->addr_long));
+    memcpy(node->addr_short, dev->addr_short, sizeof(node->addr_short));
+    node->promisc = (dev->filter_mode == IEEE802154_FILTER_PROMISC) ||
+                    (dev->filter_mode == IEEE802154_FILTER_SNIFFER);
+    _unlock(node);
+    irq_restore(state);
+}
+
+/* Waking up a node costs a context switch on the host, so only nodes that
+ * would accept the frame get it. The receiver still filters the frames, so
+ * nodes are skipped only if they are certainly not addressed. */
+static bool _addressed(const socket_zep_t *dev, unsigned slot,
+                       const socket_zep_shm_node_t *node, const uint8_t *mhr,
+                       const uint8_t *dst, int dst_len)
+{
+    if (__atomic_load_n(&node->promisc, __ATOMIC_RELAXED)) {
+        return true;
+    }
+    /* ACKs carry no address, they go back to the sender of the frame */
+    if ((mhr[0] & IEEE802154_FCF_TYPE_MASK) == IEEE802154_FCF_TYPE_ACK) {
+        return slot == dev->shm_peer;
+    }
+
+    switch (dst_len) {
+    case IEEE802154_LONG_ADDRESS_LEN:
+        return memcmp(dst, node->addr_long, dst_len) == 0;
+    case IEEE802154_SHORT_ADDRESS_LEN:
+        return (memcmp(dst, ieee802154_addr_bcast, dst_len) == 0) ||
+               (memcmp(dst, node->addr_short, dst_len) == 0);
+    default:
+        return true;
+    }
+}
+
+void socket_zep_shm_send(socket_zep_t *dev, const void *frame, size_t len)
+{
+    socket_zep_shm_t *shm = dev->shm;
+    const uint8_t *link = shm->link[dev->shm_slot];
+    const uint8_t *mhr = (const uint8_t *)frame + sizeof(zep_v2_data_hdr_t);
+    uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];
+    le_uint16_t dst_pan;
+    int dst_len;
+
+    assert(len <= sizeof(((socket_zep_shm_frame_t *)0)->data));
+    assert(len > sizeof(zep_v2_data_hdr_t));
+
+    dst_len = ieee802154_get_dst(mhr, dst, &dst_pan);
+
+    for (unsigned i = 0; i < CONFIG_SOCKET_ZEP_SHM_NODES; i++) {
+        socket_zep_shm_node_t *node = &shm->node[i];
+        uint8_t quality = link[i];
+
+        if ((i == dev->shm_slot) || (quality == 0) ||
+            (__atomic_load_n(&node->pid, __ATOMIC_RELAXED) == 0) ||
+            !_addressed(dev, i, node, mhr, dst, dst_len)) {
+            continue;
+        }
+        if ((quality != SOCKET_ZEP_SHM_LINK_PERFECT) &&
+            ((random_uint32() & 0xff) >= quality)) {
+            DEBUG("socket_zep_shm: frame to node %u lost\n", i);
+            continue;
+        }
+
+        unsigned state = irq_disable();
+
+        _lock(node);
+        if (node->head - node->tail >= CONFIG_SOCKET_ZEP_SHM_RING_LEN) {
+            node->dropped++;
+            _unlock(node);
+            irq_restore(state);
+            continue;
+        }
+
+        socket_zep_shm_frame_t *f =
+            &node->ring[node->head % CONFIG_SOCKET_ZEP_SHM_RING_LEN];
+        memcpy(f->data, frame, len);
+        f->len = len;
+        f->src = dev->shm_slot;
+        ((zep_v2_data_hdr_t *)f->data)->lqi_val = quality;
+        node->head++;
+        /* only wake up the receiver if it drained its ring */
+        bool wake = node->armed;
+        node->armed = 0;
+        _unlock(node);
+        irq_restore(state);
+
+        if (wake) {
+            _doorbell_ring(dev, node);
+        }
+    }
+}
+
+int socket_zep_shm_recv(socket_zep_t *dev, void *buf, size_t max_len)
+{
+    socket_zep_shm_node_t *node = &((socket_zep_shm_t *)dev->shm)->node[dev->shm_slot];
+    int res = -EAGAIN;
+
+    /* no system calls while holding the lock, senders would have to wait
+     * for them */
+    _doorbell_drain(dev);
+
+    unsigned state = irq_disable();
+
+    _lock(node);
+    if (node->head != node->tail) {
+        socket_zep_shm_frame_t *f =
+            &node->ring[node->tail % CONFIG_SOCKET_ZEP_SHM_RING_LEN];
+
+        res = f->len;
+        if (buf != NULL) {
+            /* the frame an ACK would be sent for */
+            dev->shm_peer = f->src;
+            if (f->len > max_len) {
+                /* drop the frame instead of passing on a truncated one */
+                res = -EMSGSIZE;
+            }
+            else {
+                memcpy(buf, f->data, f->len);
+            }
+        }
+        node->tail++;
+    }
+    /* the next frame has to wake us up */
+    node->armed = (node->head == node->tail);
+    _unlock(node);
+    irq_restore(state);
+
+    return res;
+}
+
+void socket_zep_shm_continue(socket_zep_t *dev)
+{
+    socket_zep_shm_node_t *node = &((socket_zep_shm_t *)dev->shm)->node[dev->shm_slot];
+
+    unsigned state = irq_disable();
+
+    _lock(node);
+    /* frames left in the ring won't wake us up */
+    bool pending = (node->head != node->tail);
+    _unlock(node);
+    irq_restore(state);
+
+    if (pending) {
+        _doorbell_ring(dev, node);
+    }
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup drivers_socket_zep
+ * @{
+ *
+ * @file
+ * @brief   Shared memory medium for socket ZEP
+ *
+ * The segment starts with a @ref socket_zep_shm_t header, followed by
+ * @ref CONFIG_SOCKET_ZEP_SHM_NODES slots of type @ref socket_zep_shm_node_t.
+ * External tools should use the offsets and sizes stored in the header.
+ */
+#ifndef SOCKET_ZEP_SHM_H
+#define SOCKET_ZEP_SHM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "socket_zep.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Magic number of an initialized segment ("ZEPS")
+ */
+#define SOCKET_ZEP_SHM_MAGIC        (0x5a455053U)
+
+/**
+ * @brief   Link value of a link without any losses
+ */
+#define SOCKET_ZEP_SHM_LINK_PERFECT (0xffU)
+
+/**
+ * @brief   A frame in a receive ring, including its ZEP header
+ */
+typedef struct {
+    uint16_t len;                   /**< length of the frame */
+    uint16_t src;                   /**< slot of the sender */
+    uint8_t data[sizeof(zep_v2_data_hdr_t) + IEEE802154_FRAME_LEN_MAX]; /**< frame */
+} socket_zep_shm_frame_t;
+
+/**
+ * @brief   Slot of a node on the medium
+ */
+typedef struct {
+    uint32_t lock;                  /**< PID of the node holding the slot lock */
+    int32_t pid;                    /**< PID of the owner, 0 if unused */
+    uint8_t wake_addr[28];          /**< socket address to wake the owner up */
+    uint8_t wake_addr_len;          /**< length of the socket address */
+    uint8_t armed;                  /**< owner waits for a wake-up */
+    uint8_t addr_long[IEEE802154_LONG_ADDRESS_LEN]; /**< EUI-64 of the owner */
+    uint8_t addr_short[IEEE802154_SHORT_ADDRESS_LEN]; /**< short address */
+    uint8_t promisc;                /**< owner wants frames to other nodes */
+    uint32_t head;                  /**< frames written to the ring */
+    uint32_t tail;                  /**< frames read from the ring */
+    uint32_t dropped;               /**< frames dropped due to a full ring */
+    socket_zep_shm_frame_t ring[CONFIG_SOCKET_ZEP_SHM_RING_LEN]; /**< ring */
+} socket_zep_shm_node_t;
+
+/**
+ * @brief   Header of the shared memory segment
+ */
+typedef struct {
+    uint32_t magic;                 /**< @ref SOCKET_ZEP_SHM_MAGIC when set up */
+    uint32_t init;                  /**< set by the node setting it up */
+    uint16_t nodes;                 /**< number of slots */
+    uint16_t ring_len;              /**< frames per receive ring */
+    uint32_t node_offset;           /**< offset of the first slot */
+    uint32_t node_size;             /**< size of a slot */
+    /**
+     * @brief   Link matrix, indexed by sending and receiving slot
+     *
+     * Probability of a frame reaching the receiver in 1/256, 0 for no link
+     * and @ref SOCKET_ZEP_SHM_LINK_PERFECT for a link without losses. The
+     * value is also reported as LQI by the receiver.
+     */
+    uint8_t link[CONFIG_SOCKET_ZEP_SHM_NODES][CONFIG_SOCKET_ZEP_SHM_NODES];
+    socket_zep_shm_node_t node[CONFIG_SOCKET_ZEP_SHM_NODES]; /**< slots */
+} socket_zep_shm_t;
+
+/**
+ * @brief   Attach to the medium named in the device parameters
+ *
+ * Creates the segment if it doesn't exist yet and claims a free slot.
+ *
+ * @param[in] dev   device to attach
+ *
+ * @return  file descriptor that becomes readable when frames are pending
+ */
+int socket_zep_shm_attach(socket_zep_t *dev);
+
+/**
+ * @brief   Release the slot of @p dev on the medium
+ *
+ * @param[in] dev   device to detach
+ */
+void socket_zep_shm_detach(socket_zep_t *dev);
+
+/**
+ * @brief   Publish the addresses and the filter mode of @p dev on the medium
+ *
+ * Senders only deliver frames addressed to @p dev, unless it is in
+ * promiscuous or sniffer mode.
+ *
+ * @param[in] dev   device
+ */
+void socket_zep_shm_set_addr(socket_zep_t *dev);
+
+/**
+ * @brief   Deliver a frame to the nodes linked to @p dev
+ *
+ * Unicast frames are only delivered to their destination and ACKs only to
+ * the sender of the last frame received by @p dev, promiscuous nodes get
+ * all frames.
+ *
+ * @param[in] dev   sending device
+ * @param[in] frame frame including its ZEP header
+ * @param[in] len   length of @p frame
+ */
+void socket_zep_shm_send(socket_zep_t *dev, const void *frame, size_t len);
+
+/**
+ * @brief   Take the next frame from the receive ring of @p dev
+ *
+ * @param[in] dev       receiving device
+ * @param[out] buf      buffer for the frame, NULL to drop it
+ * @param[in] max_len   size of @p buf
+ *
+ * @return  length of the frame
+ * @return  -EAGAIN if the ring is empty. The file descriptor returned by
+ *          @ref socket_zep_shm_attach becomes readable with the next frame.
+ * @return  -EMSGSIZE if the frame did not fit into @p buf. The frame is
+ *          dropped.
+ */
+int socket_zep_shm_recv(socket_zep_t *dev, void *buf, size_t max_len);
+
+/**
+ * @brief   Make the file descriptor returned by @ref socket_zep_shm_attach
+ *          readable if frames are left in the receive ring of @p dev
+ *
+ * @param[in] dev   receiving device
+ */
+void socket_zep_shm_continue(socket_zep_t *dev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SOCKET_ZEP_SHM_H */
+/** @} */
@@ -339,6 +339,11 @@ void usage_exit(int status)
 "        on a local address.\n"
 "        Required to be provided SOCKET_ZEP_MAX times\n"
 #endif
+#ifdef MODULE_SOCKET_ZEP_SHM
+"    -z shm:<name> --zep=shm:<name>\n"
+"        provide a ZEP interface on the shared memory medium <name> instead\n"
+"        of a ZEP dispatcher. All nodes using the same <name> share a medium.\n"
+#endif
 #ifdef MODULE_NATIVE_CLI_EUI_PROVIDER
 "    -U <eui64>, --eui64=<eui64>\n"
 "        provide a ZEP interface with EUI-64 (MAC address)\n"
@@ -422,6 +427,14 @@ static void _zep_params_setup(char *zep_str, int zep)
     /* reboot uses execve() so we need to preserve argv */
     zep_str = strdup(zep_str);
 
+    if (IS_USED(MODULE_SOCKET_ZEP_SHM) && (strncmp(zep_str, "shm:", 4) == 0)) {
+        if (zep_str[4] == '\0') {
+            usage_exit(EXIT_FAILURE);
+        }
+        socket_zep_params[zep].shm_name = &zep_str[4];
+        return;
+    }
+
     if ((first_ep = strtok_r(zep_str, ",", &save_ptr)) == NULL) {
         usage_exit(EXIT_FAILURE);
     }
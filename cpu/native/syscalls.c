@@ -470,6 +470,7 @@ void _native_init_syscalls(void)
     *(void **)(&real_gai_strerror) = dlsym(RTLD_NEXT, "gai_strerror");
     *(void **)(&real_getaddrinfo) = dlsym(RTLD_NEXT, "getaddrinfo");
     *(void **)(&real_getifaddrs) = dlsym(RTLD_NEXT, "getifaddrs");
+    *(void **)(&real_getsockname) = dlsym(RTLD_NEXT, "getsockname");
     *(void **)(&real_getpid) = dlsym(RTLD_NEXT, "getpid");
     *(void **)(&real_gettimeofday) = dlsym(RTLD_NEXT, "gettimeofday");
     *(void **)(&real_pipe) = dlsym(RTLD_NEXT, "pipe");
@@ -499,6 +500,7 @@ void _native_init_syscalls(void)
     *(void **)(&real_umask) = dlsym(RTLD_NEXT, "umask");
     *(void **)(&real_writev) = dlsym(RTLD_NEXT, "writev");
     *(void **)(&real_send) = dlsym(RTLD_NEXT, "send");
+    *(void **)(&real_sendto) = dlsym(RTLD_NEXT, "sendto");
     *(void **)(&real_fclose) = dlsym(RTLD_NEXT, "fclose");
     *(void **)(&real_fseek) = dlsym(RTLD_NEXT, "fseek");
     *(void **)(&real_ftell) = dlsym(RTLD_NEXT, "ftell");
@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""Inspect a socket_zep_shm medium or load a topology into its link matrix."""
+
+import argparse
+import mmap
+import os
+import struct
+import sys
+
+MAGIC = 0x5A455053
+HEADER = struct.Struct("<IIHHII")
+LINK_OFFSET = HEADER.size
+NODE = struct.Struct("<Ii28sBB8s2sB3xIII")
+
+
+class Medium:
+    def __init__(self, name):
+        path = os.path.join("/dev/shm", "riot_zep_" + name)
+        try:
+            fd = os.open(path, os.O_RDWR)
+        except FileNotFoundError:
+            sys.exit("%s doesn't exist, start a node with -z shm:%s first" % (path, name))
+        self.mem = mmap.mmap(fd, 0)
+        os.close(fd)
+        magic, _, self.nodes, self.ring_len, self.node_offset, self.node_size = \
+            HEADER.unpack_from(self.mem, 0)
+        if magic != MAGIC:
+            sys.exit("%s is not a socket_zep_shm medium" % path)
+
+    def node(self, slot):
+        _, pid, _, _, _, addr, _, _, head, tail, dropped = \
+            NODE.unpack_from(self.mem, self.node_offset + slot * self.node_size)
+        return pid, addr, head - tail, dropped
+
+    def set_link(self, tx, rx, quality):
+        self.mem[LINK_OFFSET + tx * self.nodes + rx] = quality
+
+    def link(self, tx, rx):
+        return self.mem[LINK_OFFSET + tx * self.nodes + rx]
+
+
+def parse_mac(mac):
+    return bytes(int(x, 16) for x in mac.split(":"))
+
+
+def quality(weight):
+    return max(0, min(255, round(float(weight) * 255)))
+
+
+def load_topology(medium, topo):
+    """Parse a topology in the format of zep_dispatch."""
+    pinned = {}
+    links = []
+    names = []
+    for line in topo:
+        line = line.split("#", 1)[0].strip()
+        if not line:
+            continue
+        if ":=" in line:
+            name, mac = (x.strip() for x in line.split(":=", 1))
+            pinned[name] = parse_mac(mac)
+            continue
+        fields = line.split()
+        a, b = fields[0], fields[1]
+        w_ab = fields[2] if len(fields) > 2 else "1"
+        w_ba = fields[3] if len(fields) > 3 else w_ab
+        links.append((a, b, quality(w_ab), quality(w_ba)))
+        names += [n for n in (a, b) if n not in names]
+
+    # pinned nodes are found by their address, all others get the remaining
+    # slots in order of their appearance
+    by_addr = {}
+    for slot in range(medium.nodes):
+        pid, addr, _, _ = medium.node(slot)
+        if pid:
+            by_addr[addr] = slot
+    slots = {}
+    for name, mac in pinned.items():
+        if mac not in by_addr:
+            sys.exit("no node with address %s on the medium" % mac.hex(":"))
+        slots[name] = by_addr[mac]
+    free = (s for s in range(medium.nodes) if s not in slots.values())
+    for name in names:
+        if name not in slots:
+            slots[name] = next(free, None)
+            if slots[name] is None:
+                sys.exit("too many nodes in topology")
+
+    for tx in range(medium.nodes):
+        for rx in range(medium.nodes):
+            medium.set_link(tx, rx, 0)
+    for a, b, q_ab, q_ba in links:
+        medium.set_link(slots[a], slots[b], q_ab)
+        medium.set_link(slots[b], slots[a], q_ba)
+
+    for name in names:
+        print("%s\tslot %u" % (name, slots[name]))
+
+
+def show(medium):
+    for slot in range(medium.nodes):
+        pid, addr, pending, dropped = medium.node(slot)
+        if not pid:
+            continue
+        neigh = ["%u(%u)" % (rx, medium.link(slot, rx))
+                 for rx in range(medium.nodes)
+                 if rx != slot and medium.link(slot, rx) and medium.node(rx)[0]]
+        print("slot %u: pid %u, %s, %u pending, %u dropped -> %s" %
+              (slot, pid, addr.hex(":"), pending, dropped, " ".join(neigh)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("name", help="name of the medium, as in -z shm:<name>")
+    parser.add_argument("-t", "--topology", type=argparse.FileType("r"),
+                        help="topology file in the format of zep_dispatch")
+    args = parser.parse_args()
+
+    medium = Medium(args.name)
+    if args.topology:
+        load_topology(medium, args.topology)
+    else:
+        show(medium)
+
+
+if __name__ == "__main__":
+    main()
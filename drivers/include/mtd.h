@@ -314,6 +314,18 @@ struct mtd_desc {
      */
     int (*power)(mtd_dev_t *dev, enum mtd_power_state power);
 
+    /**
+     * @brief   Write back data the driver holds in RAM
+     *
+     * Optional, only needed by drivers that defer writes (e.g. a cache).
+     *
+     * @param[in] dev       Pointer to the selected driver
+     *
+     * @retval 0 on success
+     * @retval <0 value on error
+     */
+    int (*flush)(mtd_dev_t *dev);
+
     /**
      * @brief   Properties of the MTD driver
      */
@@ -524,6 +536,21 @@ int mtd_write_sector(mtd_dev_t *mtd, const void *src, uint32_t sector, uint32_t
  */
 int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power);
 
+/**
+ * @brief   Write back all data that is held back by the driver
+ *
+ * Writes are complete on return of the write functions, unless the driver
+ * defers them (e.g. @ref drivers_mtd_cache). File systems call this when
+ * they are asked to sync.
+ *
+ * @param      mtd   the device to flush
+ *
+ * @retval 0 on success, or if the driver doesn't defer writes
+ * @retval <0 if an error occurred
+ * @retval -ENODEV if @p mtd is not a valid device
+ */
+int mtd_flush(mtd_dev_t *mtd);
+
 /**
  * @brief   Get an MTD device by index
  *
@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef MTD_ASYNC_H
+#define MTD_ASYNC_H
+
+/**
+ * @defgroup    drivers_mtd_async  Asynchronous MTD operations
+ * @ingroup     drivers_storage
+ * @brief       Run MTD operations in the background and get notified by an
+ *              event when they are done
+ *
+ * Erasing a sector of a SPI NOR flash takes tens to hundreds of milliseconds,
+ * during which the blocking @ref drivers_mtd functions don't return. This
+ * module lets the caller submit read, write and erase requests instead. They
+ * are executed one after another, in the order of submission, by a dedicated
+ * thread, while the submitting thread goes on with its work (e.g. receiving
+ * the next block of a firmware update). The completion of a request is
+ * signalled by posting an event to an event queue of the caller's choice.
+ *
+ * This works with every MTD driver. Drivers that sleep while waiting for the
+ * device (e.g. @ref drivers_mtd_spi_nor) also let lower priority threads run
+ * in the meantime.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_async
+ * ```
+ *
+ * ```
+ * static void _erased(event_t *event)
+ * {
+ *     mtd_async_req_t *req = container_of(event, mtd_async_req_t, done);
+ *     printf("erase done: %d\n", req->res);
+ * }
+ *
+ * static mtd_async_req_t req = {
+ *     .done.handler = _erased,
+ *     .queue = EVENT_PRIO_MEDIUM,
+ * };
+ *
+ * mtd_async_erase_sector(&req, MTD_0, 0, 1);
+ * ```
+ *
+ * The thread is started by auto_init, or by calling @ref mtd_async_init
+ * when auto_init is not used.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for asynchronous MTD operations
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "mtd.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Priority of the thread executing the requests
+ *
+ * The default is below the priority of the main thread, so a submitting
+ * thread keeps running until it blocks, e.g. waiting for a completion
+ * event. With a higher priority than the submitter, drivers that busy-wait
+ * for the device (e.g. @ref drivers_mtd_emulated, mtd_native or
+ * mtd_flashpage) complete the whole operation before the submitting call
+ * returns, so nothing overlaps.
+ */
+#ifndef MTD_ASYNC_PRIO
+#define MTD_ASYNC_PRIO          (THREAD_PRIORITY_MAIN + 1)
+#endif
+
+/**
+ * @brief   Stack size of the thread executing the requests
+ */
+#ifndef MTD_ASYNC_STACKSIZE
+#define MTD_ASYNC_STACKSIZE     (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Asynchronous MTD operations
+ */
+typedef enum {
+    MTD_ASYNC_OP_READ_PAGE,         /**< @ref mtd_read_page */
+    MTD_ASYNC_OP_WRITE_PAGE_RAW,    /**< @ref mtd_write_page_raw */
+    MTD_ASYNC_OP_ERASE_SECTOR,      /**< @ref mtd_erase_sector */
+} mtd_async_op_t;
+
+/**
+ * @brief   Asynchronous MTD request
+ *
+ * Set @p queue and the handler of @p done before submitting the request. The
+ * request must not be modified until it is completed.
+ */
+typedef struct {
+    event_t submit;                 /**< queued for execution, internal */
+    event_t done;                   /**< posted to @p queue on completion */
+    event_queue_t *queue;           /**< queue to post @p done to, may be NULL */
+    mtd_dev_t *mtd;                 /**< device the request operates on */
+    void *buf;                      /**< data to read or write */
+    uint32_t page;                  /**< page, or sector to erase */
+    uint32_t offset;                /**< offset within the page */
+    uint32_t count;                 /**< bytes to read or write, or sectors
+                                         to erase */
+    int res;                        /**< result of the operation */
+    uint8_t op;                     /**< @ref mtd_async_op_t */
+    volatile bool pending;          /**< request is submitted but not
+                                         completed */
+} mtd_async_req_t;
+
+/**
+ * @brief   Start the thread executing the requests
+ *
+ * Called by auto_init.
+ */
+void mtd_async_init(void);
+
+/**
+ * @brief   Submit reading data from a page
+ *
+ * See @ref mtd_read_page for the parameters.
+ *
+ * @param[in,out]   req     request to submit
+ * @param[in]       mtd     device to read from
+ * @param[out]      dest    buffer for the data, must stay valid until
+ *                          completion
+ * @param[in]       page    page number to start reading from
+ * @param[in]       offset  offset within the page
+ * @param[in]       count   number of bytes to read
+ *
+ * @retval  0       request submitted, the result is in @p req->res on
+ *                  completion
+ * @retval  -EBUSY  @p req is still pending, see @ref mtd_async_pending
+ */
+int mtd_async_read_page(mtd_async_req_t *req, mtd_dev_t *mtd, void *dest,
+                        uint32_t page, uint32_t offset, uint32_t count);
+
+/**
+ * @brief   Submit writing data to a page without erasing it first
+ *
+ * See @ref mtd_write_page_raw for the parameters.
+ *
+ * @param[in,out]   req     request to submit
+ * @param[in]       mtd     device to write to
+ * @param[in]       src     data to write, must stay valid until completion
+ * @param[in]       page    page number to start writing to
+ * @param[in]       offset  offset within the page
+ * @param[in]       count   number of bytes to write
+ *
+ * @retval  0       request submitted, the result is in @p req->res on
+ *                  completion
+ * @retval  -EBUSY  @p req is still pending, see @ref mtd_async_pending
+ */
+int mtd_async_write_page_raw(mtd_async_req_t *req, mtd_dev_t *mtd,
+                             const void *src, uint32_t page, uint32_t offset,
+                             uint32_t count);
+
+/**
+ * @brief   Submit erasing sectors
+ *
+ * See @ref mtd_erase_sector for the parameters.
+ *
+ * @param[in,out]   req     request to submit
+ * @param[in]       mtd     device to erase
+ * @param[in]       sector  first sector to erase
+ * @param[in]       count   number of sectors to erase
+ *
+ * @retval  0       request submitted, the result is in @p req->res on
+ *                  completion
+ * @retval  -EBUSY  @p req is still pending, see @ref mtd_async_pending
+ */
+int mtd_async_erase_sector(mtd_async_req_t *req, mtd_dev_t *mtd,
+                           uint32_t sector, uint32_t count);
+
+/**
+ * @brief   Check whether a request is still pending
+ *
+ * A request is pending from its submission until its completion event has
+ * been taken from the event queue. It can't be submitted again before.
+ *
+ * @param[in]   req     request to check
+ *
+ * @return  true if @p req is submitted, or its completion event is queued
+ */
+static inline bool mtd_async_pending(const mtd_async_req_t *req)
+{
+    return req->pending || req->done.list_node.next;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+#endif /* MTD_ASYNC_H */
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef MTD_CACHE_H
+#define MTD_CACHE_H
+
+/**
+ * @defgroup    drivers_mtd_cache  MTD block cache
+ * @ingroup     drivers_storage
+ * @brief       RAM cache with read-ahead and write-back for MTD devices
+ *
+ * This MTD module sits between a file system and the MTD device backing it.
+ * It keeps a small number of cache lines in RAM, so small and repeated
+ * accesses (e.g. a file read byte by byte) don't each turn into a transfer
+ * on a slow bus.
+ *
+ * - Reads are served from the cache lines. On a miss, a whole line is
+ *   fetched. If the miss continues a sequential access, the following
+ *   @ref CONFIG_MTD_CACHE_READAHEAD lines are fetched with the same
+ *   transfer.
+ * - Writes are collected in the cache lines and written back once per line
+ *   when the line is evicted, when the device is flushed with
+ *   @ref mtd_flush() or before it is powered down. Consecutive small writes
+ *   are coalesced into a single write.
+ * - Reads and writes that cover a whole uncached line bypass the cache.
+ *
+ * @warning Written data is only persistent after @ref mtd_flush(). The
+ *          littlefs, littlefs2 and FatFs glue call it when a file is synced.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_cache
+ * ```
+ *
+ * ```
+ * static mtd_cache_t cache = MTD_CACHE_INIT(MTD_0);
+ *
+ * mtd_dev_t *dev = &cache.mtd;
+ * ```
+ *
+ * The geometry of the cache device is the one of the backing device. The
+ * backing device is initialized by @ref mtd_init() on the cache device.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for the MTD block cache
+ */
+
+#include <stdint.h>
+
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup drivers_mtd_cache_config  MTD block cache configuration
+ * @ingroup config_drivers_storage
+ * @{
+ */
+/**
+ * @brief   Number of cache lines
+ */
+#ifndef CONFIG_MTD_CACHE_LINES
+#define CONFIG_MTD_CACHE_LINES          (4U)
+#endif
+
+/**
+ * @brief   Size of a cache line in bytes
+ *
+ * Must be a multiple of the page size of the backing device and divide its
+ * sector size.
+ */
+#ifndef CONFIG_MTD_CACHE_LINE_SIZE
+#define CONFIG_MTD_CACHE_LINE_SIZE      (256U)
+#endif
+
+/**
+ * @brief   Number of lines fetched in addition on a sequential miss
+ *
+ * Set to 0 to disable read-ahead. Must be less than
+ * @ref CONFIG_MTD_CACHE_LINES.
+ */
+#ifndef CONFIG_MTD_CACHE_READAHEAD
+#define CONFIG_MTD_CACHE_READAHEAD      (1U)
+#endif
+/** @} */
+
+/**
+ * @brief   Shortcut macro for initializing an @ref mtd_cache_t
+ *
+ * @param   _parent     backing MTD device
+ */
+#define MTD_CACHE_INIT(_parent) \
+{ \
+    .mtd = { \
+        .driver = &mtd_cache_driver, \
+    }, \
+    .parent = _parent, \
+    .lock = MUTEX_INIT, \
+}
+
+/**
+ * @brief   MTD block cache statistics
+ */
+typedef struct {
+    uint32_t hits;          /**< accesses served by a cached line */
+    uint32_t misses;        /**< lines fetched on demand */
+    uint32_t readahead;     /**< lines fetched ahead of a sequential access */
+    uint32_t bypass;        /**< whole lines accessed without the cache */
+    uint32_t writebacks;    /**< writes issued to the backing device */
+} mtd_cache_stats_t;
+
+/**
+ * @brief   MTD cache line
+ */
+typedef struct {
+    uint32_t addr;          /**< start address, UINT32_MAX if unused */
+    uint32_t last_used;     /**< time stamp of the last access */
+    uint32_t dirty_start;   /**< start of the range not written back yet */
+    uint32_t dirty_end;     /**< end of the range, equal to start if clean */
+} mtd_cache_line_t;
+
+/**
+ * @brief   MTD block cache
+ */
+typedef struct {
+    mtd_dev_t mtd;          /**< MTD context */
+    mtd_dev_t *parent;      /**< backing MTD device */
+    mutex_t lock;           /**< guards the cache and the backing device */
+    uint32_t clock;         /**< time stamp of the last access */
+    uint32_t next_addr;     /**< address following the last fetched line */
+    mtd_cache_stats_t stats;                    /**< cache statistics */
+    mtd_cache_line_t lines[CONFIG_MTD_CACHE_LINES]; /**< cache lines */
+    /**
+     * @brief   line data, consecutive lines can be fetched at once
+     */
+    uint8_t data[CONFIG_MTD_CACHE_LINES * CONFIG_MTD_CACHE_LINE_SIZE]
+        __attribute__((aligned(sizeof(uint32_t))));
+} mtd_cache_t;
+
+/**
+ * @brief   Cache MTD device operations table
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+/**
+ * @brief   Get the statistics of a cache and reset them
+ *
+ * @param[in]   cache   MTD block cache
+ * @param[out]  stats   statistics since the last call
+ */
+void mtd_cache_stats(mtd_cache_t *cache, mtd_cache_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+#endif /* MTD_CACHE_H */
@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef MTD_FTL_H
+#define MTD_FTL_H
+
+/**
+ * @defgroup    drivers_mtd_ftl  MTD flash translation layer
+ * @ingroup     drivers_storage
+ * @brief       Wear-leveling and bad block aware translation layer for MTD
+ *              devices
+ *
+ * File systems that update their data in place (e.g. FAT) or applications
+ * that repeatedly write the same location (e.g. a log or a metrics buffer)
+ * erase the same sectors of a flash over and over again, until they wear
+ * out. This MTD module maps the pages of a logical device to the pages of
+ * the flash, so that the writes are spread over all sectors:
+ *
+ * - Every write of a page goes to the next free page of the flash sector
+ *   that is currently filled ("log-structured"). The previous copy of the
+ *   page becomes stale.
+ * - When free sectors run out, the sector with the fewest valid pages is
+ *   garbage collected: its valid pages are copied and the sector is erased.
+ * - New sectors are taken in the order of their erase counts (dynamic wear
+ *   leveling). If a sector holding data that never changes falls
+ *   @ref CONFIG_MTD_FTL_WEAR_THRESHOLD erases behind the most worn sector,
+ *   its data is moved, so the sector takes part in the wear leveling again
+ *   (static wear leveling).
+ * - A sector that fails to erase or program is marked bad and is never used
+ *   again.
+ *
+ * The logical device accepts overwriting data without erasing it first
+ * (@ref MTD_DRIVER_FLAG_DIRECT_WRITE). Erasing a logical sector discards its
+ * data, which then reads as `0xff`.
+ *
+ * ## On-flash layout
+ *
+ * The first page(s) of each flash sector hold a header with the erase count
+ * and a sequence number, followed by one entry per remaining page naming the
+ * logical page stored there. The entry is written after the page data, so
+ * the mapping is rebuilt by @ref mtd_init() after a reset or power loss,
+ * where a write that was interrupted is lost as a whole.
+ *
+ * A logical sector consists of as many pages as each flash sector has left
+ * after its header. @ref CONFIG_MTD_FTL_SPARE_SECTORS flash sectors are not
+ * exposed, they make room for the garbage collection and replace bad
+ * sectors.
+ *
+ * The erase of a logical sector is recorded by an entry as well. The
+ * garbage collection carries such a record over as long as older sectors
+ * still hold copies of the erased pages, so they don't reappear after a
+ * reset.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_ftl
+ * ```
+ *
+ * ```
+ * MTD_FTL_DEV(0, NULL, 64, 16, 256);
+ *
+ * mtd_ftl_dev0.parent = MTD_0;
+ * mtd_dev_t *dev = &mtd_ftl_dev0.mtd;
+ * ```
+ *
+ * The translation table is kept in RAM and takes two bytes per page of the
+ * logical device. Garbage collection normally happens while writing, when
+ * a new sector is needed. Calling @ref mtd_ftl_gc() from a low priority
+ * thread when the system is idle moves this work out of the write path.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for the MTD flash translation layer
+ */
+
+#include <stdint.h>
+
+#include "container.h"
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup drivers_mtd_ftl_config  MTD flash translation layer configuration
+ * @ingroup config_drivers_storage
+ * @{
+ */
+/**
+ * @brief   Number of flash sectors not exposed by the logical device
+ *
+ * At least two are required for the garbage collection, additional sectors
+ * replace sectors that turn bad and reduce the write amplification.
+ */
+#ifndef CONFIG_MTD_FTL_SPARE_SECTORS
+#define CONFIG_MTD_FTL_SPARE_SECTORS    (4U)
+#endif
+
+/**
+ * @brief   Difference in erase counts that triggers static wear leveling
+ */
+#ifndef CONFIG_MTD_FTL_WEAR_THRESHOLD
+#define CONFIG_MTD_FTL_WEAR_THRESHOLD   (16U)
+#endif
+
+/**
+ * @brief   Number of free sectors below which @ref mtd_ftl_gc() collects
+ *          garbage
+ */
+#ifndef CONFIG_MTD_FTL_GC_FREE_SECTORS
+#define CONFIG_MTD_FTL_GC_FREE_SECTORS  (CONFIG_MTD_FTL_SPARE_SECTORS)
+#endif
+/** @} */
+
+/**
+ * @brief   Macro to define a flash translation layer on top of a MTD device
+ *
+ * For example, using
+ * ```
+ * MTD_FTL_DEV(0, &mtd_emulated_dev0.base, 16, 4, 256);
+ * ```
+ * creates the device `mtd_ftl_dev0` on a backing device with 16 sectors of
+ * 4 pages of 256 bytes.
+ *
+ * @param   n       index of the device (results into symbol `mtd_ftl_dev<n>`)
+ * @param   _parent backing MTD device, can be set at runtime before
+ *                  @ref mtd_init()
+ * @param   sc      sectors of the backing device
+ * @param   pps     pages per sector of the backing device
+ * @param   ps      page size of the backing device in bytes
+ */
+#define MTD_FTL_DEV(n, _parent, sc, pps, ps)                                \
+    static uint16_t _mtd_ftl_map ## n[((sc) - CONFIG_MTD_FTL_SPARE_SECTORS) \
+                                      * ((pps) - 1)];                       \
+    static mtd_ftl_sector_t _mtd_ftl_sectors ## n[sc];                      \
+    static uint8_t _mtd_ftl_buf ## n[ps]                                    \
+        __attribute__((aligned(sizeof(uint32_t))));                         \
+                                                                            \
+    mtd_ftl_t mtd_ftl_dev ## n = {                                          \
+        .mtd = {                                                            \
+            .driver = &mtd_ftl_driver,                                      \
+        },                                                                  \
+        .parent = _parent,                                                  \
+        .lock = MUTEX_INIT,                                                 \
+        .map = _mtd_ftl_map ## n,                                           \
+        .map_numof = ARRAY_SIZE(_mtd_ftl_map ## n),                         \
+        .sectors = _mtd_ftl_sectors ## n,                                   \
+        .sectors_numof = ARRAY_SIZE(_mtd_ftl_sectors ## n),                 \
+        .buf = _mtd_ftl_buf ## n,                                           \
+        .buf_size = sizeof(_mtd_ftl_buf ## n),                              \
+    }
+
+/**
+ * @brief   State of a flash sector
+ */
+typedef enum {
+    MTD_FTL_SECTOR_DIRTY,   /**< contents unknown, must be erased before use */
+    MTD_FTL_SECTOR_FREE,    /**< erased */
+    MTD_FTL_SECTOR_USED,    /**< holds data */
+    MTD_FTL_SECTOR_RETIRED, /**< holds data, but failed to program */
+    MTD_FTL_SECTOR_BAD,     /**< must not be used */
+} mtd_ftl_sector_state_t;
+
+/**
+ * @brief   Flash sector information kept in RAM
+ */
+typedef struct {
+    uint32_t erase_count;   /**< number of times the sector was erased */
+    uint32_t seq;           /**< order in which the sectors were filled */
+    uint16_t valid;         /**< pages holding the current copy of data */
+    uint8_t state;          /**< @ref mtd_ftl_sector_state_t */
+} mtd_ftl_sector_t;
+
+/**
+ * @brief   Flash translation layer statistics
+ */
+typedef struct {
+    uint32_t erase_min;     /**< lowest erase count of a good sector */
+    uint32_t erase_max;     /**< highest erase count of a good sector */
+    uint32_t erase_total;   /**< erases of all sectors */
+    uint16_t free;          /**< free sectors */
+    uint16_t bad;           /**< bad sectors */
+    uint32_t gc_runs;       /**< sectors garbage collected */
+    uint32_t gc_copies;     /**< pages copied by the garbage collection */
+    uint32_t wl_moves;      /**< sectors moved for static wear leveling */
+} mtd_ftl_stats_t;
+
+/**
+ * @brief   MTD flash translation layer
+ */
+typedef struct {
+    mtd_dev_t mtd;              /**< MTD context */
+    mtd_dev_t *parent;          /**< backing MTD device */
+    mutex_t lock;               /**< guards the state and the backing device */
+    uint16_t *map;              /**< logical page to flash page */
+    mtd_ftl_sector_t *sectors;  /**< flash sector information */
+    uint8_t *buf;               /**< buffer for a single page */
+    uint32_t map_numof;         /**< number of entries of @p map */
+    uint16_t sectors_numof;     /**< number of entries of @p sectors */
+    uint16_t buf_size;          /**< size of @p buf */
+    uint16_t head_pages;        /**< pages per sector taken by the header */
+    uint16_t head;              /**< sector currently filled */
+    uint16_t pos;               /**< next page to fill in @p head */
+    uint32_t seq;               /**< sequence number of @p head */
+    uint32_t gc_runs;           /**< see @ref mtd_ftl_stats_t */
+    uint32_t gc_copies;         /**< see @ref mtd_ftl_stats_t */
+    uint32_t wl_moves;          /**< see @ref mtd_ftl_stats_t */
+} mtd_ftl_t;
+
+/**
+ * @brief   Flash translation layer MTD device operations table
+ */
+extern const mtd_desc_t mtd_ftl_driver;
+
+/**
+ * @brief   Do garbage collection or static wear leveling in the background
+ *
+ * Collects the sector with the fewest valid pages, if there are less than
+ * @ref CONFIG_MTD_FTL_GC_FREE_SECTORS free sectors, or moves the data of a
+ * sector that fell behind in wear leveling. Does one step at a time.
+ *
+ * @param[in]   ftl     flash translation layer
+ *
+ * @retval  1       a sector was collected or moved
+ * @retval  0       nothing to do
+ * @retval  <0      error
+ */
+int mtd_ftl_gc(mtd_ftl_t *ftl);
+
+/**
+ * @brief   Get the wear and garbage collection statistics
+ *
+ * @param[in]   ftl     flash translation layer
+ * @param[out]  stats   statistics
+ */
+void mtd_ftl_stats(mtd_ftl_t *ftl, mtd_ftl_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+#endif /* MTD_FTL_H */
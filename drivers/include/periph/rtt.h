@@ -124,7 +124,7 @@ extern "C" {
  * @param[in]   sec     number of seconds
  * @return              rtt ticks
  */
-#define RTT_SEC_TO_TICKS(sec)   (sec * RTT_FREQUENCY)
+#define RTT_SEC_TO_TICKS(sec)   ((sec) * RTT_FREQUENCY)
 
 /**
  * @brief       Convert minutes to rtt ticks
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_async
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous MTD operations
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+
+#include "architecture.h"
+#include "container.h"
+#include "event.h"
+#include "irq.h"
+#include "mtd.h"
+#include "mtd_async.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static char WORD_ALIGNED _stack[MTD_ASYNC_STACKSIZE];
+static event_queue_t _queue = EVENT_QUEUE_INIT_DETACHED;
+
+static void _run(event_t *event)
+{
+    mtd_async_req_t *req = container_of(event, mtd_async_req_t, submit);
+
+    DEBUG("mtd_async: op %u, page %" PRIu32 " + %" PRIu32 ", count %" PRIu32 "\n",
+          req->op, req->page, req->offset, req->count);
+
+    switch (req->op) {
+    case MTD_ASYNC_OP_READ_PAGE:
+        req->res = mtd_read_page(req->mtd, req->buf, req->page, req->offset,
+                                 req->count);
+        break;
+    case MTD_ASYNC_OP_WRITE_PAGE_RAW:
+        req->res = mtd_write_page_raw(req->mtd, req->buf, req->page,
+                                      req->offset, req->count);
+        break;
+    case MTD_ASYNC_OP_ERASE_SECTOR:
+        req->res = mtd_erase_sector(req->mtd, req->page, req->count);
+        break;
+    default:
+        req->res = -EINVAL;
+    }
+
+    /* a caller polling mtd_async_pending() must not see the request
+     * completed before done is queued */
+    unsigned state = irq_disable();
+    req->pending = false;
+    if (req->queue) {
+        event_post(req->queue, &req->done);
+    }
+    irq_restore(state);
+}
+
+static int _submit(mtd_async_req_t *req, mtd_dev_t *mtd, mtd_async_op_t op,
+                   void *buf, uint32_t page, uint32_t offset, uint32_t count)
+{
+    unsigned state = irq_disable();
+    if (mtd_async_pending(req)) {
+        irq_restore(state);
+        return -EBUSY;
+    }
+    req->pending = true;
+    irq_restore(state);
+
+    req->submit.handler = _run;
+    req->mtd = mtd;
+    req->op = op;
+    req->buf = buf;
+    req->page = page;
+    req->offset = offset;
+    req->count = count;
+
+    event_post(&_queue, &req->submit);
+    return 0;
+}
+
+int mtd_async_read_page(mtd_async_req_t *req, mtd_dev_t *mtd, void *dest,
+                        uint32_t page, uint32_t offset, uint32_t count)
+{
+    return _submit(req, mtd, MTD_ASYNC_OP_READ_PAGE, dest, page, offset, count);
+}
+
+int mtd_async_write_page_raw(mtd_async_req_t *req, mtd_dev_t *mtd,
+                             const void *src, uint32_t page, uint32_t offset,
+                             uint32_t count)
+{
+    return _submit(req, mtd, MTD_ASYNC_OP_WRITE_PAGE_RAW, (void *)src, page,
+                   offset, count);
+}
+
+int mtd_async_erase_sector(mtd_async_req_t *req, mtd_dev_t *mtd,
+                           uint32_t sector, uint32_t count)
+{
+    return _submit(req, mtd, MTD_ASYNC_OP_ERASE_SECTOR, NULL, sector, 0, count);
+}
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+
+    event_queue_claim(&_queue);
+    event_loop(&_queue);
+
+    /* should never be reached */
+    return NULL;
+}
+
+void mtd_async_init(void)
+{
+    thread_create(_stack, sizeof(_stack), MTD_ASYNC_PRIO, 0,
+                  _thread, NULL, "mtd_async");
+}
@@ -0,0 +1,354 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       MTD block cache with read-ahead and write-back
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mutex.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define LINE_SIZE       CONFIG_MTD_CACHE_LINE_SIZE
+#define LINE_INVALID    UINT32_MAX
+
+static_assert(CONFIG_MTD_CACHE_READAHEAD < CONFIG_MTD_CACHE_LINES,
+              "Read-ahead must leave a line for the demanded data");
+
+static inline uint8_t *_data(mtd_cache_t *cache, unsigned idx)
+{
+    return &cache->data[idx * LINE_SIZE];
+}
+
+static inline uint32_t _dev_size(const mtd_dev_t *mtd)
+{
+    return mtd->sector_count * mtd->pages_per_sector * mtd->page_size;
+}
+
+static int _find(const mtd_cache_t *cache, uint32_t addr)
+{
+    for (unsigned i = 0; i < CONFIG_MTD_CACHE_LINES; i++) {
+        if (cache->lines[i].addr == addr) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int _write_back(mtd_cache_t *cache, unsigned idx)
+{
+    mtd_cache_line_t *line = &cache->lines[idx];
+
+    if (line->dirty_start == line->dirty_end) {
+        return 0;
+    }
+
+    DEBUG("mtd_cache: write back 0x%" PRIx32 " + %" PRIu32 "\n",
+          line->addr + line->dirty_start, line->dirty_end - line->dirty_start);
+
+    int res = mtd_write_page_raw(cache->parent,
+                                 _data(cache, idx) + line->dirty_start, 0,
+                                 line->addr + line->dirty_start,
+                                 line->dirty_end - line->dirty_start);
+    if (res < 0) {
+        return res;
+    }
+
+    cache->stats.writebacks++;
+    line->dirty_start = 0;
+    line->dirty_end = 0;
+    return 0;
+}
+
+/* Free @p count consecutive lines, the group whose most recently used line
+ * is the oldest is chosen */
+static int _evict(mtd_cache_t *cache, unsigned count)
+{
+    unsigned victim = 0;
+    uint32_t victim_used = UINT32_MAX;
+
+    for (unsigned i = 0; i + count <= CONFIG_MTD_CACHE_LINES; i++) {
+        uint32_t used = 0;
+        for (unsigned j = i; j < i + count; j++) {
+            if (cache->lines[j].addr == LINE_INVALID) {
+                continue;
+            }
+            used = MAX(used, cache->lines[j].last_used + 1);
+        }
+        if (used < victim_used) {
+            victim = i;
+            victim_used = used;
+        }
+    }
+
+    for (unsigned j = victim; j < victim + count; j++) {
+        int res = _write_back(cache, j);
+        if (res < 0) {
+            return res;
+        }
+        cache->lines[j].addr = LINE_INVALID;
+    }
+
+    return victim;
+}
+
+static void _use(mtd_cache_t *cache, unsigned idx, uint32_t addr)
+{
+    cache->lines[idx].addr = addr;
+    cache->lines[idx].last_used = ++cache->clock;
+}
+
+/* Fetch the line at @p addr. If this continues a sequential access, the
+ * following lines are fetched with the same transfer. */
+static int _fetch(mtd_cache_t *cache, uint32_t addr)
+{
+    uint32_t size = _dev_size(&cache->mtd);
+    unsigned count = 1;
+
+    if (addr == cache->next_addr) {
+        /* a line must never be cached twice */
+        while ((count <= CONFIG_MTD_CACHE_READAHEAD) &&
+               (addr + (count + 1) * LINE_SIZE <= size) &&
+               (_find(cache, addr + count * LINE_SIZE) < 0)) {
+            count++;
+        }
+    }
+
+    int idx = _evict(cache, count);
+    if (idx < 0) {
+        return idx;
+    }
+
+    int res = mtd_read_page(cache->parent, _data(cache, idx), 0, addr,
+                            count * LINE_SIZE);
+    if (res < 0) {
+        return res;
+    }
+
+    for (unsigned i = 0; i < count; i++) {
+        _use(cache, idx + i, addr + i * LINE_SIZE);
+    }
+    cache->stats.misses++;
+    cache->stats.readahead += count - 1;
+    cache->next_addr = addr + count * LINE_SIZE;
+
+    return idx;
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    mtd_dev_t *parent = cache->parent;
+
+    int res = mtd_init(parent);
+    if (res < 0) {
+        return res;
+    }
+
+    /* inherit physical properties */
+    mtd->sector_count = parent->sector_count;
+    mtd->pages_per_sector = parent->pages_per_sector;
+    mtd->page_size = parent->page_size;
+    mtd->write_size = parent->write_size;
+
+    /* Lines must consist of whole pages and never span two sectors */
+    assert((LINE_SIZE % parent->page_size) == 0);
+    assert(((parent->pages_per_sector * parent->page_size) % LINE_SIZE) == 0);
+
+    mutex_lock(&cache->lock);
+    for (unsigned i = 0; i < CONFIG_MTD_CACHE_LINES; i++) {
+        cache->lines[i] = (mtd_cache_line_t){ .addr = LINE_INVALID };
+    }
+    cache->clock = 0;
+    cache->next_addr = LINE_INVALID;
+    memset(&cache->stats, 0, sizeof(cache->stats));
+    mutex_unlock(&cache->lock);
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    uint32_t addr = page * mtd->page_size + offset;
+    uint32_t pos = addr % LINE_SIZE;
+    int res = 0;
+
+    count = MIN(count, LINE_SIZE - pos);
+
+    mutex_lock(&cache->lock);
+
+    int idx = _find(cache, addr - pos);
+    if ((idx < 0) && (count == LINE_SIZE)) {
+        /* don't evict anything for data that is read once */
+        cache->stats.bypass++;
+        res = mtd_read_page(cache->parent, dest, 0, addr, count);
+        goto out;
+    }
+
+    if (idx < 0) {
+        idx = _fetch(cache, addr - pos);
+        if (idx < 0) {
+            res = idx;
+            goto out;
+        }
+    }
+    else {
+        cache->stats.hits++;
+        cache->lines[idx].last_used = ++cache->clock;
+    }
+    memcpy(dest, _data(cache, idx) + pos, count);
+
+out:
+    mutex_unlock(&cache->lock);
+    return (res < 0) ? res : (int)count;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    uint32_t addr = page * mtd->page_size + offset;
+    uint32_t pos = addr % LINE_SIZE;
+    int res = 0;
+
+    count = MIN(count, LINE_SIZE - pos);
+
+    mutex_lock(&cache->lock);
+
+    int idx = _find(cache, addr - pos);
+    if ((idx < 0) && (count == LINE_SIZE)) {
+        cache->stats.bypass++;
+        res = mtd_write_page_raw(cache->parent, src, 0, addr, count);
+        goto out;
+    }
+
+    if (idx < 0) {
+        idx = _fetch(cache, addr - pos);
+        if (idx < 0) {
+            res = idx;
+            goto out;
+        }
+    }
+    else {
+        cache->stats.hits++;
+        cache->lines[idx].last_used = ++cache->clock;
+    }
+
+    mtd_cache_line_t *line = &cache->lines[idx];
+    if (line->dirty_start == line->dirty_end) {
+        line->dirty_start = pos;
+        line->dirty_end = pos + count;
+    }
+    else if ((pos > line->dirty_end) || (pos + count < line->dirty_start)) {
+        /* only coalesce adjacent writes, the gap must not be written */
+        res = _write_back(cache, idx);
+        if (res < 0) {
+            goto out;
+        }
+        line->dirty_start = pos;
+        line->dirty_end = pos + count;
+    }
+    else {
+        line->dirty_start = MIN(line->dirty_start, pos);
+        line->dirty_end = MAX(line->dirty_end, pos + count);
+    }
+    memcpy(_data(cache, idx) + pos, src, count);
+
+out:
+    mutex_unlock(&cache->lock);
+    return (res < 0) ? res : (int)count;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    uint32_t sector_size = mtd->pages_per_sector * mtd->page_size;
+    uint32_t start = sector * sector_size;
+    uint32_t end = start + count * sector_size;
+
+    mutex_lock(&cache->lock);
+
+    /* pending writes to the erased sectors are obsolete */
+    for (unsigned i = 0; i < CONFIG_MTD_CACHE_LINES; i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+        if ((line->addr != LINE_INVALID) &&
+            (line->addr >= start) && (line->addr < end)) {
+            *line = (mtd_cache_line_t){ .addr = LINE_INVALID };
+        }
+    }
+    int res = mtd_erase_sector(cache->parent, sector, count);
+
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _flush(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+    for (unsigned i = 0; (i < CONFIG_MTD_CACHE_LINES) && (res == 0); i++) {
+        res = _write_back(cache, i);
+    }
+    if (res == 0) {
+        res = mtd_flush(cache->parent);
+    }
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    if (power == MTD_POWER_DOWN) {
+        int res = _flush(mtd);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    return mtd_power(cache->parent, power);
+}
+
+void mtd_cache_stats(mtd_cache_t *cache, mtd_cache_stats_t *stats)
+{
+    mutex_lock(&cache->lock);
+    *stats = cache->stats;
+    memset(&cache->stats, 0, sizeof(cache->stats));
+    mutex_unlock(&cache->lock);
+}
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .power = _power,
+    .flush = _flush,
+};
@@ -0,0 +1,806 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_ftl
+ * @{
+ *
+ * @file
+ * @brief       Wear-leveling and bad block aware MTD translation layer
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mtd_ftl.h"
+#include "mutex.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define MAGIC           (0x4c544621UL)  /* "!FTL" */
+#define ERASED          UINT32_MAX
+#define NONE            UINT16_MAX
+#define UNMAPPED        UINT16_MAX
+
+/* entry recording the erase of a logical sector instead of a page */
+#define ENTRY_TRIM      (0x80000000UL)
+/* with ENTRY_TRIM: erase of a single logical page */
+#define ENTRY_PAGE      (0x40000000UL)
+#define ENTRY_INDEX     (0x3fffffffUL)
+
+/* Header at the start of each flash sector. The fields are written in pairs
+ * of 32 bit words, which suits all write sizes up to 8 bytes. */
+typedef struct {
+    uint32_t magic;         /* written after each erase */
+    uint32_t erase_count;
+    uint32_t seq;           /* written when filling of the sector starts */
+    uint32_t seq_check;     /* ~seq, detects an interrupted write */
+    uint32_t bad;           /* written to 0 when the sector failed */
+    uint32_t reserved;
+} _header_t;
+
+/* Entry naming the logical page stored in a flash page, one per page
+ * following the header */
+typedef struct {
+    uint32_t val;
+    uint32_t check;         /* ~val, detects an interrupted write */
+} _entry_t;
+
+static inline uint32_t _pps(const mtd_ftl_t *ftl)
+{
+    return ftl->parent->pages_per_sector;
+}
+
+static inline unsigned _data_pages(const mtd_ftl_t *ftl)
+{
+    return ftl->mtd.pages_per_sector;
+}
+
+static inline uint32_t _data_page(const mtd_ftl_t *ftl, unsigned s, unsigned i)
+{
+    return s * _pps(ftl) + ftl->head_pages + i;
+}
+
+static inline uint32_t _entry_offset(unsigned i)
+{
+    return sizeof(_header_t) + i * sizeof(_entry_t);
+}
+
+static int _read_meta(mtd_ftl_t *ftl, unsigned s, void *dest,
+                      uint32_t offset, uint32_t count)
+{
+    return mtd_read_page(ftl->parent, dest, s * _pps(ftl), offset, count);
+}
+
+static int _write_meta(mtd_ftl_t *ftl, unsigned s, const void *src,
+                       uint32_t offset, uint32_t count)
+{
+    return mtd_write_page_raw(ftl->parent, src, s * _pps(ftl), offset, count);
+}
+
+static bool _is_good(const mtd_ftl_sector_t *sector)
+{
+    return sector->state != MTD_FTL_SECTOR_BAD;
+}
+
+static bool _is_free(const mtd_ftl_sector_t *sector)
+{
+    return (sector->state == MTD_FTL_SECTOR_FREE) ||
+           (sector->state == MTD_FTL_SECTOR_DIRTY);
+}
+
+static unsigned _free_count(const mtd_ftl_t *ftl)
+{
+    unsigned count = 0;
+
+    for (unsigned s = 0; s < ftl->parent->sector_count; s++) {
+        count += _is_free(&ftl->sectors[s]);
+    }
+    return count;
+}
+
+static void _map(mtd_ftl_t *ftl, uint32_t page, uint16_t target)
+{
+    uint16_t old = ftl->map[page];
+
+    if (old != UNMAPPED) {
+        ftl->sectors[old / _pps(ftl)].valid--;
+    }
+    ftl->map[page] = target;
+    if (target != UNMAPPED) {
+        ftl->sectors[target / _pps(ftl)].valid++;
+    }
+}
+
+static void _mark_bad(mtd_ftl_t *ftl, unsigned s)
+{
+    static const uint32_t bad[2] = { 0, 0 };
+
+    DEBUG("mtd_ftl: sector %u is bad\n", s);
+
+    ftl->sectors[s].state = MTD_FTL_SECTOR_BAD;
+    if (ftl->head == s) {
+        ftl->head = NONE;
+    }
+
+    /* best effort, the sector failed already */
+    _write_meta(ftl, s, bad, offsetof(_header_t, bad), sizeof(bad));
+}
+
+static int _erase(mtd_ftl_t *ftl, unsigned s)
+{
+    mtd_ftl_sector_t *sector = &ftl->sectors[s];
+    uint32_t hdr[2] = { MAGIC, sector->erase_count + 1 };
+
+    if ((mtd_erase_sector(ftl->parent, s, 1) < 0) ||
+        (_write_meta(ftl, s, hdr, 0, sizeof(hdr)) < 0)) {
+        _mark_bad(ftl, s);
+        return -EIO;
+    }
+
+    sector->erase_count++;
+    sector->state = MTD_FTL_SECTOR_FREE;
+    sector->valid = 0;
+    return 0;
+}
+
+/* Start filling the free sector with the lowest erase count */
+static int _open(mtd_ftl_t *ftl)
+{
+    while (1) {
+        int s = -1;
+
+        for (unsigned i = 0; i < ftl->parent->sector_count; i++) {
+            if (_is_free(&ftl->sectors[i]) &&
+                ((s < 0) ||
+                 (ftl->sectors[i].erase_count < ftl->sectors[s].erase_count))) {
+                s = i;
+            }
+        }
+        if (s < 0) {
+            return -ENOSPC;
+        }
+
+        if ((ftl->sectors[s].state == MTD_FTL_SECTOR_DIRTY) &&
+            (_erase(ftl, s) < 0)) {
+            continue;
+        }
+
+        uint32_t seq[2] = { ftl->seq + 1, ~(ftl->seq + 1) };
+        if (_write_meta(ftl, s, seq, offsetof(_header_t, seq), sizeof(seq)) < 0) {
+            _mark_bad(ftl, s);
+            continue;
+        }
+
+        DEBUG("mtd_ftl: filling sector %d, seq %" PRIu32 "\n", s, seq[0]);
+
+        ftl->seq = seq[0];
+        ftl->sectors[s].seq = seq[0];
+        ftl->sectors[s].state = MTD_FTL_SECTOR_USED;
+        ftl->head = s;
+        ftl->pos = 0;
+        return 0;
+    }
+}
+
+static bool _head_has_room(const mtd_ftl_t *ftl)
+{
+    return (ftl->head != NONE) && (ftl->pos < _data_pages(ftl));
+}
+
+/* Write @p data (NULL for a trim entry) to the next free page and record
+ * @p val for it. Never collects garbage, so it can be used for the copies
+ * made by the garbage collection. */
+static int _append(mtd_ftl_t *ftl, uint32_t val, const void *data)
+{
+    while (1) {
+        if (!_head_has_room(ftl)) {
+            int res = _open(ftl);
+            if (res < 0) {
+                return res;
+            }
+        }
+
+        unsigned s = ftl->head;
+        uint32_t page = _data_page(ftl, s, ftl->pos);
+        _entry_t entry = { .val = val, .check = ~val };
+        int res = 0;
+
+        if (data) {
+            res = mtd_write_page_raw(ftl->parent, data, page, 0,
+                                     ftl->parent->page_size);
+        }
+        if (res == 0) {
+            res = _write_meta(ftl, s, &entry, _entry_offset(ftl->pos),
+                              sizeof(entry));
+        }
+        ftl->pos++;
+
+        if (res < 0) {
+            DEBUG("mtd_ftl: writing page %" PRIu32 " failed\n", page);
+            /* the valid pages are moved by the garbage collection */
+            ftl->sectors[s].state = MTD_FTL_SECTOR_RETIRED;
+            ftl->head = NONE;
+            continue;
+        }
+
+        if (!(val & ENTRY_TRIM)) {
+            _map(ftl, val, page);
+        }
+        return 0;
+    }
+}
+
+/* Sector with the fewest valid pages, failed sectors first */
+static int _victim(const mtd_ftl_t *ftl)
+{
+    int victim = -1;
+    unsigned valid = _data_pages(ftl);
+
+    for (unsigned s = 0; s < ftl->parent->sector_count; s++) {
+        const mtd_ftl_sector_t *sector = &ftl->sectors[s];
+        if (s == ftl->head) {
+            continue;
+        }
+        if (sector->state == MTD_FTL_SECTOR_RETIRED) {
+            return s;
+        }
+        if ((sector->state == MTD_FTL_SECTOR_USED) && (sector->valid < valid)) {
+            victim = s;
+            valid = sector->valid;
+        }
+    }
+
+    return victim;
+}
+
+/* Sector holding data that fell behind in wear leveling */
+static int _cold(const mtd_ftl_t *ftl)
+{
+    int cold = -1;
+    uint32_t max = 0;
+
+    for (unsigned s = 0; s < ftl->parent->sector_count; s++) {
+        const mtd_ftl_sector_t *sector = &ftl->sectors[s];
+        if (!_is_good(sector)) {
+            continue;
+        }
+        max = MAX(max, sector->erase_count);
+        if ((s != ftl->head) && (sector->state == MTD_FTL_SECTOR_USED) &&
+            ((cold < 0) || (sector->erase_count < ftl->sectors[cold].erase_count))) {
+            cold = s;
+        }
+    }
+
+    if ((cold < 0) ||
+        (max - ftl->sectors[cold].erase_count <= CONFIG_MTD_FTL_WEAR_THRESHOLD)) {
+        return -1;
+    }
+    return cold;
+}
+
+/* Check whether a sector filled before sector @p s holds a copy of a page in
+ * [@p first, @p first + @p count), the pages found are flagged in @p found */
+static int _stale_copies(mtd_ftl_t *ftl, unsigned s, uint32_t first,
+                         uint32_t count, uint8_t *found)
+{
+    memset(found, 0, (count + 7) / 8);
+
+    for (unsigned o = 0; o < ftl->parent->sector_count; o++) {
+        const mtd_ftl_sector_t *older = &ftl->sectors[o];
+        if (((older->state != MTD_FTL_SECTOR_USED) &&
+             (older->state != MTD_FTL_SECTOR_RETIRED)) ||
+            (older->seq >= ftl->sectors[s].seq)) {
+            continue;
+        }
+
+        for (unsigned i = 0; i < _data_pages(ftl); i++) {
+            _entry_t entry;
+
+            int res = _read_meta(ftl, o, &entry, _entry_offset(i), sizeof(entry));
+            if (res < 0) {
+                return res;
+            }
+            if ((entry.val != ~entry.check) || (entry.val & ENTRY_TRIM) ||
+                (entry.val < first) || (entry.val >= first + count)) {
+                continue;
+            }
+            found[(entry.val - first) / 8] |= 1 << ((entry.val - first) % 8);
+        }
+    }
+
+    return 0;
+}
+
+/* An erase recorded in sector @p s must survive the garbage collection of
+ * @p s as long as older sectors hold copies of the erased pages, or they
+ * are mapped again on the next scan */
+static int _keep_trim(mtd_ftl_t *ftl, unsigned s, uint32_t val)
+{
+    uint32_t first = val & ENTRY_INDEX;
+    uint32_t count = 1;
+    uint32_t needed = 0;
+
+    if (!(val & ENTRY_PAGE)) {
+        first *= _data_pages(ftl);
+        count = _data_pages(ftl);
+    }
+
+    /* the page buffer is not in use between two copies */
+    uint8_t *found = ftl->buf;
+    assert((count + 7) / 8 <= ftl->buf_size);
+
+    int res = _stale_copies(ftl, s, first, count, found);
+    if (res < 0) {
+        return res;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        /* a page written again after the erase doesn't need it anymore */
+        if (ftl->map[first + i] != UNMAPPED) {
+            found[i / 8] &= ~(1 << (i % 8));
+        }
+        needed += (found[i / 8] >> (i % 8)) & 1;
+    }
+
+    if (needed == 0) {
+        return 0;
+    }
+    if (needed == count) {
+        return _append(ftl, val, NULL);
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (found[i / 8] & (1 << (i % 8))) {
+            res = _append(ftl, ENTRY_TRIM | ENTRY_PAGE | (first + i), NULL);
+            if (res < 0) {
+                return res;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/* Move the valid pages and the erase records of sector @p s and erase it */
+static int _collect(mtd_ftl_t *ftl, unsigned s)
+{
+    mtd_ftl_sector_t *sector = &ftl->sectors[s];
+
+    DEBUG("mtd_ftl: collecting sector %u, %u valid\n", s, sector->valid);
+
+    for (unsigned i = 0; i < _data_pages(ftl); i++) {
+        uint32_t page = _data_page(ftl, s, i);
+        _entry_t entry;
+
+        int res = _read_meta(ftl, s, &entry, _entry_offset(i), sizeof(entry));
+        if (res < 0) {
+            return res;
+        }
+        if (entry.val != ~entry.check) {
+            continue;
+        }
+        if (entry.val & ENTRY_TRIM) {
+            res = _keep_trim(ftl, s, entry.val);
+            if (res < 0) {
+                return res;
+            }
+            continue;
+        }
+        if ((entry.val >= ftl->map_numof) || (ftl->map[entry.val] != page)) {
+            continue;
+        }
+
+        res = mtd_read_page(ftl->parent, ftl->buf, page, 0,
+                            ftl->parent->page_size);
+        if (res < 0) {
+            return res;
+        }
+        res = _append(ftl, entry.val, ftl->buf);
+        if (res < 0) {
+            return res;
+        }
+        ftl->gc_copies++;
+    }
+
+    ftl->gc_runs++;
+
+    if (sector->state == MTD_FTL_SECTOR_RETIRED) {
+        _mark_bad(ftl, s);
+    }
+    else {
+        /* a sector that failed to erase was marked bad, no data is lost */
+        _erase(ftl, s);
+    }
+    return 0;
+}
+
+/* Collect garbage until a free sector is left in reserve for the garbage
+ * collection */
+static int _make_room(mtd_ftl_t *ftl)
+{
+    while (_free_count(ftl) <= 1) {
+        int s = _victim(ftl);
+        if (s < 0) {
+            return -ENOSPC;
+        }
+        int res = _collect(ftl, s);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    return 0;
+}
+
+/* Make sure the next page can be written */
+static int _prepare(mtd_ftl_t *ftl)
+{
+    if (_head_has_room(ftl)) {
+        return 0;
+    }
+    ftl->head = NONE;
+
+    int res = _make_room(ftl);
+    if (res < 0) {
+        return res;
+    }
+
+    int s = _cold(ftl);
+    if (s >= 0) {
+        /* takes the free sector for the data and frees the cold one */
+        res = _collect(ftl, s);
+        if (res == 0) {
+            ftl->wl_moves++;
+            res = _make_room(ftl);
+        }
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    return _head_has_room(ftl) ? 0 : _open(ftl);
+}
+
+static int _replay(mtd_ftl_t *ftl, unsigned s)
+{
+    for (unsigned i = 0; i < _data_pages(ftl); i++) {
+        _entry_t entry;
+
+        int res = _read_meta(ftl, s, &entry, _entry_offset(i), sizeof(entry));
+        if (res < 0) {
+            return res;
+        }
+        if (entry.val != ~entry.check) {
+            /* unused or interrupted */
+            continue;
+        }
+
+        if (entry.val & ENTRY_TRIM) {
+            uint32_t first = entry.val & ENTRY_INDEX;
+            uint32_t count = 1;
+            if (!(entry.val & ENTRY_PAGE)) {
+                first *= _data_pages(ftl);
+                count = _data_pages(ftl);
+            }
+            if (first + count > ftl->mtd.sector_count * _data_pages(ftl)) {
+                continue;
+            }
+            for (unsigned j = 0; j < count; j++) {
+                _map(ftl, first + j, UNMAPPED);
+            }
+        }
+        else if (entry.val < ftl->mtd.sector_count * _data_pages(ftl)) {
+            _map(ftl, entry.val, _data_page(ftl, s, i));
+        }
+    }
+
+    return 0;
+}
+
+/* Rebuild the state from the sector headers and the entries */
+static int _scan(mtd_ftl_t *ftl)
+{
+    unsigned sector_count = ftl->parent->sector_count;
+    uint32_t erase_max = 0;
+
+    ftl->seq = 0;
+    ftl->head = NONE;
+    ftl->pos = 0;
+    memset(ftl->map, 0xff, ftl->map_numof * sizeof(ftl->map[0]));
+
+    for (unsigned s = 0; s < sector_count; s++) {
+        mtd_ftl_sector_t *sector = &ftl->sectors[s];
+        _header_t hdr;
+
+        int res = _read_meta(ftl, s, &hdr, 0, sizeof(hdr));
+        if (res < 0) {
+            return res;
+        }
+
+        *sector = (mtd_ftl_sector_t){
+            .erase_count = hdr.erase_count,
+            .seq = hdr.seq,
+        };
+
+        if (hdr.magic != MAGIC) {
+            /* never used or erase was interrupted, count is unknown */
+            sector->state = MTD_FTL_SECTOR_DIRTY;
+            sector->erase_count = ERASED;
+            continue;
+        }
+
+        erase_max = MAX(erase_max, hdr.erase_count);
+
+        if (hdr.bad != ERASED) {
+            sector->state = MTD_FTL_SECTOR_BAD;
+        }
+        else if ((hdr.seq == ERASED) && (hdr.seq_check == ERASED)) {
+            sector->state = MTD_FTL_SECTOR_FREE;
+        }
+        else if (hdr.seq != ~hdr.seq_check) {
+            sector->state = MTD_FTL_SECTOR_DIRTY;
+        }
+        else {
+            sector->state = MTD_FTL_SECTOR_USED;
+            ftl->seq = MAX(ftl->seq, hdr.seq);
+        }
+    }
+
+    for (unsigned s = 0; s < sector_count; s++) {
+        if (ftl->sectors[s].erase_count == ERASED) {
+            ftl->sectors[s].erase_count = erase_max;
+        }
+    }
+
+    /* replay the sectors in the order they were filled, so the latest copy
+     * of each page wins */
+    uint32_t last = 0;
+    while (1) {
+        int next = -1;
+
+        for (unsigned s = 0; s < sector_count; s++) {
+            const mtd_ftl_sector_t *sector = &ftl->sectors[s];
+            if ((sector->state == MTD_FTL_SECTOR_USED) && (sector->seq > last) &&
+                ((next < 0) || (sector->seq < ftl->sectors[next].seq))) {
+                next = s;
+            }
+        }
+        if (next < 0) {
+            break;
+        }
+
+        int res = _replay(ftl, next);
+        if (res < 0) {
+            return res;
+        }
+        last = ftl->sectors[next].seq;
+    }
+
+    /* The page following the last entry might have been written partially
+     * before a reset, so filling continues in a fresh sector. */
+    return 0;
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_ftl_t *ftl = container_of(mtd, mtd_ftl_t, mtd);
+    mtd_dev_t *parent = ftl->parent;
+
+    int res = mtd_init(parent);
+    if (res < 0) {
+        return res;
+    }
+
+    /* the header and one entry per remaining page */
+    unsigned head_pages = 1;
+    while (sizeof(_header_t)
+           + (parent->pages_per_sector - head_pages) * sizeof(_entry_t)
+           > head_pages * parent->page_size) {
+        head_pages++;
+    }
+
+    assert(head_pages < parent->pages_per_sector);
+    assert(parent->write_size <= sizeof(_entry_t));
+    assert(parent->page_size <= ftl->buf_size);
+    assert(parent->sector_count <= ftl->sectors_numof);
+    assert(parent->sector_count > CONFIG_MTD_FTL_SPARE_SECTORS);
+    assert(parent->sector_count * parent->pages_per_sector < UNMAPPED);
+
+    ftl->head_pages = head_pages;
+    mtd->sector_count = parent->sector_count - CONFIG_MTD_FTL_SPARE_SECTORS;
+    mtd->pages_per_sector = parent->pages_per_sector - head_pages;
+    mtd->page_size = parent->page_size;
+    mtd->write_size = 1;
+
+    assert(mtd->sector_count * mtd->pages_per_sector <= ftl->map_numof);
+
+    mutex_lock(&ftl->lock);
+    ftl->gc_runs = 0;
+    ftl->gc_copies = 0;
+    ftl->wl_moves = 0;
+    res = _scan(ftl);
+    mutex_unlock(&ftl->lock);
+
+    return res;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t count)
+{
+    mtd_ftl_t *ftl = container_of(mtd, mtd_ftl_t, mtd);
+    int res = 0;
+
+    count = MIN(count, mtd->page_size - offset);
+
+    mutex_lock(&ftl->lock);
+    uint16_t target = ftl->map[page];
+    if (target == UNMAPPED) {
+        memset(dest, 0xff, count);
+    }
+    else {
+        res = mtd_read_page(ftl->parent, dest, target, offset, count);
+    }
+    mutex_unlock(&ftl->lock);
+
+    return (res < 0) ? res : (int)count;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t count)
+{
+    mtd_ftl_t *ftl = container_of(mtd, mtd_ftl_t, mtd);
+    const void *data = src;
+
+    count = MIN(count, mtd->page_size - offset);
+
+    mutex_lock(&ftl->lock);
+
+    /* the garbage collection uses the page buffer as well */
+    int res = _prepare(ftl);
+    if (res < 0) {
+        goto out;
+    }
+
+    if (count < mtd->page_size) {
+        uint16_t target = ftl->map[page];
+        if (target == UNMAPPED) {
+            memset(ftl->buf, 0xff, mtd->page_size);
+        }
+        else {
+            res = mtd_read_page(ftl->parent, ftl->buf, target, 0,
+                                mtd->page_size);
+            if (res < 0) {
+                goto out;
+            }
+        }
+        memcpy(ftl->buf + offset, src, count);
+        data = ftl->buf;
+    }
+
+    res = _append(ftl, page, data);
+
+out:
+    mutex_unlock(&ftl->lock);
+    return (res < 0) ? res : (int)count;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_ftl_t *ftl = container_of(mtd, mtd_ftl_t, mtd);
+    int res = 0;
+
+    mutex_lock(&ftl->lock);
+
+    for (; count && (res == 0); sector++, count--) {
+        bool mapped = false;
+
+        for (unsigned i = 0; i < mtd->pages_per_sector; i++) {
+            uint32_t page = sector * mtd->pages_per_sector + i;
+            if (ftl->map[page] != UNMAPPED) {
+                _map(ftl, page, UNMAPPED);
+                mapped = true;
+            }
+        }
+
+        /* erasing an erased sector is common, don't waste a page on it */
+        if (mapped) {
+            res = _prepare(ftl);
+            if (res == 0) {
+                res = _append(ftl, ENTRY_TRIM | sector, NULL);
+            }
+        }
+    }
+
+    mutex_unlock(&ftl->lock);
+    return res;
+}
+
+static int _flush(mtd_dev_t *mtd)
+{
+    mtd_ftl_t *ftl = container_of(mtd, mtd_ftl_t, mtd);
+
+    return mtd_flush(ftl->parent);
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_ftl_t *ftl = container_of(mtd, mtd_ftl_t, mtd);
+
+    return mtd_power(ftl->parent, power);
+}
+
+int mtd_ftl_gc(mtd_ftl_t *ftl)
+{
+    int res = 0;
+    int s;
+
+    mutex_lock(&ftl->lock);
+
+    if ((_free_count(ftl) > 1) && ((s = _cold(ftl)) >= 0)) {
+        res = _collect(ftl, s);
+        if (res == 0) {
+            ftl->wl_moves++;
+            res = 1;
+        }
+    }
+    else if ((_free_count(ftl) < CONFIG_MTD_FTL_GC_FREE_SECTORS) &&
+             ((s = _victim(ftl)) >= 0)) {
+        res = _collect(ftl, s);
+        if (res == 0) {
+            res = 1;
+        }
+    }
+
+    mutex_unlock(&ftl->lock);
+    return res;
+}
+
+void mtd_ftl_stats(mtd_ftl_t *ftl, mtd_ftl_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+    stats->erase_min = UINT32_MAX;
+
+    mutex_lock(&ftl->lock);
+    for (unsigned s = 0; s < ftl->parent->sector_count; s++) {
+        const mtd_ftl_sector_t *sector = &ftl->sectors[s];
+
+        stats->erase_total += sector->erase_count;
+        if (!_is_good(sector)) {
+            stats->bad++;
+            continue;
+        }
+        stats->free += _is_free(sector);
+        stats->erase_min = MIN(stats->erase_min, sector->erase_count);
+        stats->erase_max = MAX(stats->erase_max, sector->erase_count);
+    }
+    stats->gc_runs = ftl->gc_runs;
+    stats->gc_copies = ftl->gc_copies;
+    stats->wl_moves = ftl->wl_moves;
+    mutex_unlock(&ftl->lock);
+}
+
+const mtd_desc_t mtd_ftl_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .power = _power,
+    .flush = _flush,
+    .flags = MTD_DRIVER_FLAG_DIRECT_WRITE,
+};
@@ -180,6 +180,16 @@ static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
     return res;
 }
 
+static int _flush(mtd_dev_t *mtd)
+{
+    mtd_mapper_region_t *region = container_of(mtd, mtd_mapper_region_t, mtd);
+
+    _lock(region);
+    int res = mtd_flush(region->parent->mtd);
+    _unlock(region);
+    return res;
+}
+
 const mtd_desc_t mtd_mapper_driver = {
     .init = _init,
     .read = _read,
@@ -187,4 +197,5 @@ const mtd_desc_t mtd_mapper_driver = {
     .write_page = _write_page,
     .erase = _erase,
     .erase_sector = _erase_sector,
+    .flush = _flush,
 };
@@ -59,6 +59,10 @@ static int _get(netdev_t *netdev, netopt_t opt, void *value, size_t max_len)
         case NETOPT_IEEE802154_PHY:
             *((uint8_t*) value) = ieee802154_get_phy_mode(submac);
             return 1;
+        case NETOPT_CSMA:
+            /* the SubMAC always performs CSMA-CA before transmitting a frame */
+            *((netopt_enable_t*) value) = NETOPT_ENABLE;
+            return sizeof(netopt_enable_t);
         default:
             break;
     }
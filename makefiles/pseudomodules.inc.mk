@@ -81,6 +81,11 @@ PSEUDOMODULES += fatfs_vfs_format
 PSEUDOMODULES += fdcan
 PSEUDOMODULES += fmt_%
 PSEUDOMODULES += gcoap_forward_proxy
+## @addtogroup net_gcoap_forward_proxy
+## @{
+## Coalesce concurrent requests for the same resource into one upstream request
+PSEUDOMODULES += gcoap_forward_proxy_coalesce
+## @}
 PSEUDOMODULES += gcoap_forward_proxy_thread
 PSEUDOMODULES += gcoap_fileserver
 PSEUDOMODULES += gcoap_dtls
@@ -123,6 +128,7 @@ PSEUDOMODULES += gnrc_ipv6_nib_rio
 PSEUDOMODULES += gnrc_ipv6_nib_router
 PSEUDOMODULES += gnrc_ipv6_nib_rtr_adv_pio_cb
 PSEUDOMODULES += gnrc_lorawan_1_1
+PSEUDOMODULES += gnrc_lwmac_adaptive
 PSEUDOMODULES += gnrc_neterr
 PSEUDOMODULES += gnrc_netapi_callbacks
 PSEUDOMODULES += gnrc_netapi_mbox
@@ -130,7 +136,10 @@ PSEUDOMODULES += gnrc_netif_bus
 PSEUDOMODULES += gnrc_netif_timestamp
 PSEUDOMODULES += gnrc_netif_6lo
 PSEUDOMODULES += gnrc_netif_ipv6
+PSEUDOMODULES += gnrc_netif_ipv6_src_cache
 PSEUDOMODULES += gnrc_netif_mac
+PSEUDOMODULES += gnrc_netif_pktq_sched
+PSEUDOMODULES += gnrc_netif_rx_poll
 PSEUDOMODULES += gnrc_netif_single
 PSEUDOMODULES += gnrc_netif_dedup
 
@@ -254,9 +263,12 @@ PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
+PSEUDOMODULES += gnrc_sock_stats
 PSEUDOMODULES += gnrc_txtsnd
 PSEUDOMODULES += ieee802154_security
+PSEUDOMODULES += ieee802154_security_key_cache
 PSEUDOMODULES += ieee802154_submac
+PSEUDOMODULES += ieee802154_submac_pipeline
 PSEUDOMODULES += ipv4
 PSEUDOMODULES += ipv6
 PSEUDOMODULES += l2filter_blacklist
@@ -304,6 +316,7 @@ PSEUDOMODULES += nanocoap_%
 PSEUDOMODULES += nanocoap_fileserver_callback
 PSEUDOMODULES += nanocoap_fileserver_delete
 PSEUDOMODULES += nanocoap_fileserver_put
+PSEUDOMODULES += native_async_read_epoll
 PSEUDOMODULES += netdev_default
 PSEUDOMODULES += netdev_ieee802154_%
 PSEUDOMODULES += netdev_ieee802154_rx_timestamp
@@ -313,6 +326,7 @@ PSEUDOMODULES += netdev_layer
 PSEUDOMODULES += netdev_legacy_api
 PSEUDOMODULES += netdev_new_api
 PSEUDOMODULES += netdev_register
+PSEUDOMODULES += netdev_tap_rx_batch
 PSEUDOMODULES += netstats
 PSEUDOMODULES += netstats_l2
 PSEUDOMODULES += netstats_neighbor_etx
@@ -426,6 +440,7 @@ PSEUDOMODULES += shell_cmd_gnrc_pktbuf
 PSEUDOMODULES += shell_cmd_gnrc_rpl
 PSEUDOMODULES += shell_cmd_gnrc_sixlowpan_ctx
 PSEUDOMODULES += shell_cmd_gnrc_sixlowpan_frag_stats
+PSEUDOMODULES += shell_cmd_gnrc_sock_stats
 PSEUDOMODULES += shell_cmd_gnrc_txtsnd
 PSEUDOMODULES += shell_cmd_gnrc_udp
 PSEUDOMODULES += shell_cmd_heap
@@ -475,6 +490,7 @@ PSEUDOMODULES += sock_ip
 PSEUDOMODULES += sock_tcp
 PSEUDOMODULES += sock_udp
 PSEUDOMODULES += socket_zep_hello
+PSEUDOMODULES += socket_zep_shm
 PSEUDOMODULES += soft_uart_modecfg
 PSEUDOMODULES += stdin
 PSEUDOMODULES += stdio_available
@@ -503,6 +519,14 @@ PSEUDOMODULES += stm32_eth_auto
 PSEUDOMODULES += stm32_eth_link_up
 PSEUDOMODULES += stm32_eth_tracing
 PSEUDOMODULES += stm32mp1_eng_mode
+## @defgroup pseudomodule_suit_digest_stream suit_digest_stream
+## @brief Compute the SUIT payload digest while fetching the payload
+##
+## Each chunk is hashed while it is still in the receive buffer, before it
+## is written to storage. The image match condition rejects a mismatching
+## payload without reading it back from storage. A matching payload is still
+## read back, unless `CONFIG_SUIT_DIGEST_STREAM_SKIP_READBACK` is set.
+PSEUDOMODULES += suit_digest_stream
 PSEUDOMODULES += suit_transport_%
 PSEUDOMODULES += suit_storage_%
 PSEUDOMODULES += sys_bus_%
@@ -543,6 +567,17 @@ PSEUDOMODULES += vfs_auto_mount
 ## backends.
 PSEUDOMODULES += vfs_default
 
+## @defgroup pseudomodule_vfs_mount_cache vfs_mount_cache
+## @brief Cache the mount point lookup of VFS
+##
+## Every path based VFS call compares the path against all mount points. With
+## this module, the mount found for a path is cached by the first component of
+## the path, so further calls for paths below the same mount point (e.g. the
+## files served by the nanoCoAP file server) find it without iterating the
+## mount points. The number of entries is set with
+## @ref CONFIG_VFS_MOUNT_CACHE_SIZE.
+PSEUDOMODULES += vfs_mount_cache
+
 PSEUDOMODULES += wakaama_objects_%
 PSEUDOMODULES += wifi_scan_list
 PSEUDOMODULES += wifi_enterprise
@@ -601,6 +636,8 @@ PSEUDOMODULES += crypto_aes_256
 PSEUDOMODULES += crypto_aes_precalculated
 # This pseudomodule causes a loop in AES to be unrolled (more flash, less CPU)
 PSEUDOMODULES += crypto_aes_unroll
+# Bitsliced, constant-time AES kernel for encrypting multiple blocks
+PSEUDOMODULES += crypto_aes_ct
 
 # declare shell version of test_utils_interactive_sync
 PSEUDOMODULES += test_utils_interactive_sync_shell
@@ -197,6 +197,68 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock, const iolist_t *snips,
                            (struct _sock_tl_ep *)remote, NETCONN_UDP);
 }
 
+int sock_udp_recv_batch(sock_udp_t *sock, sock_udp_mmsg_t *msgs,
+                        unsigned num, uint32_t timeout)
+{
+    unsigned count = 0;
+    bool nobufs = false;
+
+    assert((sock != NULL) && ((msgs != NULL) || (num == 0)));
+    while (count < num) {
+        sock_udp_mmsg_t *msg = &msgs[count];
+        void *data, *ctx = NULL;
+        /* only block for the first datagram, then drain what is queued */
+        ssize_t res = sock_udp_recv_buf_aux(sock, &data, &ctx,
+                                            (count || nobufs) ? 0 : timeout,
+                                            msg->remote, NULL);
+        struct netbuf *buf = ctx;
+
+        if (res < 0) {
+            if ((count == 0) && !nobufs) {
+                return res;
+            }
+            break;
+        }
+        if (netbuf_len(buf) > msg->max_len) {
+            /* drop datagram just like sock_udp_recv() does */
+            nobufs = true;
+        }
+        else {
+            /* copy the whole pbuf chain at once */
+            msg->len = netbuf_copy(buf, msg->data, msg->max_len);
+            count++;
+        }
+        netbuf_delete(buf);
+    }
+    return ((count == 0) && nobufs) ? -ENOBUFS : (int)count;
+}
+
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_mmsg_t *msgs,
+                        unsigned num)
+{
+    unsigned count;
+
+    assert((sock != NULL) && ((msgs != NULL) || (num == 0)));
+    for (count = 0; count < num; count++) {
+        const sock_udp_mmsg_t *msg = &msgs[count];
+        iolist_t snip = {
+            .iol_base = msg->data,
+            .iol_len = msg->len,
+        };
+        ssize_t res = -EINVAL;
+
+        if ((msg->remote == NULL) || (msg->remote->port != 0)) {
+            res = lwip_sock_sendv(sock->base.conn, &snip, 0,
+                                  (struct _sock_tl_ep *)msg->remote,
+                                  NETCONN_UDP);
+        }
+        if (res < 0) {
+            return (count == 0) ? res : (int)count;
+        }
+    }
+    return count;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
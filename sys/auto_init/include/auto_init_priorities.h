@@ -185,6 +185,12 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_GCOAP                        1240
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_MTD_ASYNC
+/**
+ * @brief   Asynchronous MTD operations priority
+ */
+#define AUTO_INIT_PRIO_MOD_MTD_ASYNC                    1245
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_DEVFS
 /**
  * @brief   DEVFS priority
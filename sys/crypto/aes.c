@@ -38,6 +38,7 @@
 #include "crypto/aes.h"
 #include "crypto/ciphers.h"
 #include "kernel_defines.h"
+#include "aes_internal.h"
 
 #if !IS_USED(MODULE_CRYPTO_AES_128) && !IS_USED(MODULE_CRYPTO_AES_192) && \
     !IS_USED(MODULE_CRYPTO_AES_256)
@@ -60,16 +61,6 @@
 #  define AES_KEY_SIZE(ctx) ctx->key_size
 #endif
 
-/**
- * @brief AES key
- * @see cipher_context_t
- */
-typedef struct {
-    /** @cond INTERNAL */
-    uint32_t rd_key[4 * (AES_MAXNR + 1)];
-    int rounds;
-    /** @endcond */
-} aes_key_t;
 /**
  * Interface to the aes cipher
  */
@@ -77,7 +68,8 @@ static const cipher_interface_t aes_interface = {
     AES_BLOCK_SIZE,
     aes_init,
     aes_encrypt,
-    aes_decrypt
+    aes_decrypt,
+    aes_encrypt_blocks,
 };
 
 const cipher_id_t CIPHER_AES = &aes_interface;
@@ -1062,23 +1054,12 @@ static int aes_set_decrypt_key(const unsigned char *userKey, const int bits,
 
 #ifndef AES_ASM
 /*
- * Encrypt a single block
+ * Encrypt a single block with an expanded key
  * in and out can overlap
  */
-int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
-                uint8_t *cipherBlock)
+static int _encrypt_block(const aes_key_t *key, const uint8_t *plainBlock,
+                          uint8_t *cipherBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    aes_key_t aeskey;
-    const aes_key_t *key = &aeskey;
-
-    res = aes_set_encrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE(context) * 8, &aeskey);
-    if (res < 0) {
-        return res;
-    }
-
     const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 
@@ -1330,6 +1311,83 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
     return 1;
 }
 
+/*
+ * Encrypt a single block
+ * in and out can overlap
+ */
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
+                uint8_t *cipherBlock)
+{
+    /* setup AES_KEY */
+    int res;
+    aes_key_t aeskey;
+
+    res = aes_set_encrypt_key((unsigned char *)context->context,
+                              AES_KEY_SIZE(context) * 8, &aeskey);
+    if (res < 0) {
+        return res;
+    }
+
+    return _encrypt_block(&aeskey, plainBlock, cipherBlock);
+}
+
+/*
+ * Encrypt multiple blocks, the key is only expanded once
+ * in and out can be the same
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *in,
+                       uint8_t *out, size_t nblocks)
+{
+    int res;
+    aes_key_t aeskey;
+
+    res = aes_expand_key(&aeskey, context->context, AES_KEY_SIZE(context));
+    if (res < 0) {
+        return res;
+    }
+
+    return aes_encrypt_expanded(&aeskey, in, out, nblocks);
+}
+
+int aes_expand_key(aes_key_t *key, const uint8_t *raw_key, uint8_t key_size)
+{
+    int res;
+
+    res = aes_set_encrypt_key(raw_key, key_size * 8, key);
+    if (res < 0) {
+        return res;
+    }
+#if IS_USED(MODULE_CRYPTO_AES_CT)
+    memcpy(key->raw_key, raw_key, key_size);
+    key->key_size = key_size;
+#endif
+
+    return 1;
+}
+
+int aes_encrypt_expanded(const aes_key_t *key, const uint8_t *in,
+                         uint8_t *out, size_t nblocks)
+{
+#if IS_USED(MODULE_CRYPTO_AES_CT)
+    /* an explicit choice, so it is used even where AES-NI is available */
+    return aes_ct_encrypt_blocks(key->raw_key, key->key_size, in, out,
+                                 nblocks);
+#else
+#if AES_HAVE_AESNI
+    if (aes_ni_supported()) {
+        return aes_ni_encrypt_blocks(key->rd_key, key->rounds, in, out,
+                                     nblocks);
+    }
+#endif
+
+    for (size_t i = 0; i < nblocks; i++) {
+        _encrypt_block(key, in + i * AES_BLOCK_SIZE,
+                       out + i * AES_BLOCK_SIZE);
+    }
+    return 1;
+#endif
+}
+
 /*
  * Decrypt a single block
  * in and out can overlap
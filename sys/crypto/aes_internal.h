@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_crypto
+ * @{
+ *
+ * @file
+ * @brief       Internal multi-block AES kernels
+ */
+
+#ifndef AES_INTERNAL_H
+#define AES_INTERNAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "kernel_defines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   AES-NI is available on native for x86-64 hosts
+ */
+#if defined(CPU_NATIVE) && defined(__x86_64__) && defined(__GNUC__)
+#define AES_HAVE_AESNI  1
+#else
+#define AES_HAVE_AESNI  0
+#endif
+
+/**
+ * @brief   Encrypt @p nblocks blocks with the bitsliced, constant-time kernel
+ *
+ * @param[in]   key         raw AES key
+ * @param[in]   key_size    size of @p key in bytes
+ * @param[in]   in          plaintext blocks
+ * @param[out]  out         ciphertext blocks, may be equal to @p in
+ * @param[in]   nblocks     number of blocks
+ *
+ * @return  1 on success
+ */
+int aes_ct_encrypt_blocks(const uint8_t *key, unsigned key_size,
+                          const uint8_t *in, uint8_t *out, size_t nblocks);
+
+/**
+ * @brief   Check whether the host CPU supports the AES-NI instructions
+ */
+bool aes_ni_supported(void);
+
+/**
+ * @brief   Encrypt @p nblocks blocks using AES-NI
+ *
+ * @param[in]   rd_key      expanded encryption key schedule, as big endian
+ *                          words
+ * @param[in]   rounds      number of rounds
+ * @param[in]   in          plaintext blocks
+ * @param[out]  out         ciphertext blocks, may be equal to @p in
+ * @param[in]   nblocks     number of blocks
+ *
+ * @return  1 on success
+ */
+int aes_ni_encrypt_blocks(const uint32_t *rd_key, unsigned rounds,
+                          const uint8_t *in, uint8_t *out, size_t nblocks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AES_INTERNAL_H */
+/** @} */
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_crypto
+ * @{
+ *
+ * @file
+ * @brief       AES encryption of multiple blocks using AES-NI
+ *
+ * Only built on native for x86-64 hosts. The instructions are enabled per
+ * function, their availability is checked at run time.
+ *
+ * @}
+ */
+
+#include "aes_internal.h"
+
+#if AES_HAVE_AESNI
+
+#include <immintrin.h>
+
+#include "crypto/aes.h"
+
+#define AESNI_PARALLEL  (4U)
+
+bool aes_ni_supported(void)
+{
+    static int supported = -1;
+
+    if (supported < 0) {
+        __builtin_cpu_init();
+        supported = __builtin_cpu_supports("aes");
+    }
+    return supported;
+}
+
+__attribute__((target("aes,sse2")))
+static inline __m128i _load_round_key(const uint32_t *rk)
+{
+    /* the T-table key schedule stores the round keys as big endian words */
+    return _mm_set_epi32(__builtin_bswap32(rk[3]), __builtin_bswap32(rk[2]),
+                         __builtin_bswap32(rk[1]), __builtin_bswap32(rk[0]));
+}
+
+__attribute__((target("aes,sse2")))
+int aes_ni_encrypt_blocks(const uint32_t *rd_key, unsigned rounds,
+                          const uint8_t *in, uint8_t *out, size_t nblocks)
+{
+    __m128i rk[AES_MAXNR + 1];
+
+    for (unsigned r = 0; r <= rounds; r++) {
+        rk[r] = _load_round_key(rd_key + 4 * r);
+    }
+
+    /* interleave independent blocks to hide the latency of aesenc */
+    while (nblocks >= AESNI_PARALLEL) {
+        __m128i b[AESNI_PARALLEL];
+
+        for (unsigned i = 0; i < AESNI_PARALLEL; i++) {
+            b[i] = _mm_loadu_si128((const __m128i *)(in + i * AES_BLOCK_SIZE));
+            b[i] = _mm_xor_si128(b[i], rk[0]);
+        }
+        for (unsigned r = 1; r < rounds; r++) {
+            for (unsigned i = 0; i < AESNI_PARALLEL; i++) {
+                b[i] = _mm_aesenc_si128(b[i], rk[r]);
+            }
+        }
+        for (unsigned i = 0; i < AESNI_PARALLEL; i++) {
+            b[i] = _mm_aesenclast_si128(b[i], rk[rounds]);
+            _mm_storeu_si128((__m128i *)(out + i * AES_BLOCK_SIZE), b[i]);
+        }
+        in += AESNI_PARALLEL * AES_BLOCK_SIZE;
+        out += AESNI_PARALLEL * AES_BLOCK_SIZE;
+        nblocks -= AESNI_PARALLEL;
+    }
+
+    while (nblocks--) {
+        __m128i b = _mm_loadu_si128((const __m128i *)in);
+
+        b = _mm_xor_si128(b, rk[0]);
+        for (unsigned r = 1; r < rounds; r++) {
+            b = _mm_aesenc_si128(b, rk[r]);
+        }
+        b = _mm_aesenclast_si128(b, rk[rounds]);
+        _mm_storeu_si128((__m128i *)out, b);
+        in += AES_BLOCK_SIZE;
+        out += AES_BLOCK_SIZE;
+    }
+
+    return 1;
+}
+
+#endif /* AES_HAVE_AESNI */
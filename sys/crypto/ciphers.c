@@ -31,6 +31,27 @@ int cipher_encrypt(const cipher_t *cipher, const uint8_t *input,
     return cipher->interface->encrypt(&cipher->context, input, output);
 }
 
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t nblocks)
+{
+    uint8_t block_size = cipher->interface->block_size;
+
+    if (cipher->interface->encrypt_blocks) {
+        return cipher->interface->encrypt_blocks(&cipher->context, input,
+                                                 output, nblocks);
+    }
+
+    for (size_t i = 0; i < nblocks; i++) {
+        int res = cipher->interface->encrypt(&cipher->context,
+                                             input + i * block_size,
+                                             output + i * block_size);
+        if (res != 1) {
+            return res;
+        }
+    }
+    return 1;
+}
+
 int cipher_decrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output)
 {
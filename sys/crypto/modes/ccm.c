@@ -21,10 +21,54 @@
 #include <assert.h>
 #include <string.h>
 #include "debug.h"
+#include "kernel_defines.h"
+#include "crypto/aes.h"
 #include "crypto/helper.h"
 #include "crypto/modes/ctr.h"
 #include "crypto/modes/ccm.h"
 
+#define CCM_EXPAND_AES  (IS_USED(MODULE_CRYPTO_AES_128) || \
+                         IS_USED(MODULE_CRYPTO_AES_192) || \
+                         IS_USED(MODULE_CRYPTO_AES_256))
+
+/**
+ * @brief   Cipher of one CCM operation
+ *
+ * cipher_encrypt() expands the AES key schedule for every block. The
+ * CBC-MAC is chained and can't use cipher_encrypt_blocks(), so for AES the
+ * key is expanded once per message instead.
+ */
+typedef struct {
+    const cipher_t *cipher;         /**< cipher used for the CTR mode */
+#if CCM_EXPAND_AES
+    aes_key_t aes;                  /**< expanded key, if cipher is AES */
+#endif
+} ccm_cipher_t;
+
+static int ccm_cipher_init(ccm_cipher_t *ccm, const cipher_t *cipher)
+{
+    ccm->cipher = cipher;
+#if CCM_EXPAND_AES
+    if ((cipher->interface == CIPHER_AES) &&
+        (aes_expand_key(&ccm->aes, cipher->context.context,
+                        cipher->context.key_size) != 1)) {
+        return CIPHER_ERR_ENC_FAILED;
+    }
+#endif
+    return 0;
+}
+
+static int ccm_encrypt_block(const ccm_cipher_t *ccm, const uint8_t *input,
+                             uint8_t *output)
+{
+#if CCM_EXPAND_AES
+    if (ccm->cipher->interface == CIPHER_AES) {
+        return aes_encrypt_expanded(&ccm->aes, input, output, 1);
+    }
+#endif
+    return cipher_encrypt(ccm->cipher, input, output);
+}
+
 static inline int min(int a, int b)
 {
     if (a < b) {
@@ -35,13 +79,13 @@ static inline int min(int a, int b)
     }
 }
 
-static int ccm_compute_cbc_mac(const cipher_t *cipher, const uint8_t iv[16],
+static int ccm_compute_cbc_mac(const ccm_cipher_t *ccm, const uint8_t iv[16],
                                const uint8_t *input, size_t length, uint8_t *mac)
 {
     uint8_t block_size, mac_enc[16] = { 0 };
     uint32_t offset;
 
-    block_size = cipher_get_block_size(cipher);
+    block_size = cipher_get_block_size(ccm->cipher);
     memmove(mac, iv, 16);
     offset = 0;
 
@@ -59,7 +103,7 @@ static int ccm_compute_cbc_mac(const cipher_t *cipher, const uint8_t iv[16],
             mac[i] ^= input[offset + i];
         }
 
-        if (cipher_encrypt(cipher, mac, mac_enc) != 1) {
+        if (ccm_encrypt_block(ccm, mac, mac_enc) != 1) {
             return CIPHER_ERR_ENC_FAILED;
         }
 
@@ -70,7 +114,7 @@ static int ccm_compute_cbc_mac(const cipher_t *cipher, const uint8_t iv[16],
     return offset;
 }
 
-static int ccm_create_mac_iv(const cipher_t *cipher, uint8_t auth_data_len, uint8_t M,
+static int ccm_create_mac_iv(const ccm_cipher_t *ccm, uint8_t auth_data_len, uint8_t M,
                              uint8_t L, const uint8_t *nonce, uint8_t nonce_len,
                              size_t plaintext_len, uint8_t X1[16])
 {
@@ -100,13 +144,13 @@ static int ccm_create_mac_iv(const cipher_t *cipher, uint8_t auth_data_len, uint
         return CIPHER_ERR_INVALID_LENGTH;
     }
 
-    if (cipher_encrypt(cipher, X1, X1) != 1) {
+    if (ccm_encrypt_block(ccm, X1, X1) != 1) {
         return CIPHER_ERR_ENC_FAILED;
     }
     return 0;
 }
 
-static int ccm_compute_adata_mac(const cipher_t *cipher, const uint8_t *auth_data,
+static int ccm_compute_adata_mac(const ccm_cipher_t *ccm, const uint8_t *auth_data,
                                  uint32_t auth_data_len, uint8_t X1[16])
 {
     if (auth_data_len > 0) {
@@ -139,7 +183,7 @@ static int ccm_compute_adata_mac(const cipher_t *cipher, const uint8_t *auth_dat
         memcpy(auth_data_encoded + len_encoding, auth_data,
                auth_data_len_in_encoded);
         /* Calculate the MAC over the first block of AAD + heading length encoding */
-        len = ccm_compute_cbc_mac(cipher, X1, auth_data_encoded,
+        len = ccm_compute_cbc_mac(ccm, X1, auth_data_encoded,
                                   auth_data_len_in_encoded + len_encoding, X1);
 
         if (len < 0) {
@@ -148,7 +192,7 @@ static int ccm_compute_adata_mac(const cipher_t *cipher, const uint8_t *auth_dat
 
         /* Calculate the MAC for the remainder of the AAD (if there is one) */
         if (auth_data_len_in_encoded < auth_data_len) {
-            len = ccm_compute_cbc_mac(cipher, X1,
+            len = ccm_compute_cbc_mac(ccm, X1,
                                       auth_data + auth_data_len_in_encoded,
                                       auth_data_len - auth_data_len_in_encoded,
                                       X1);
@@ -182,6 +226,7 @@ int cipher_encrypt_ccm(const cipher_t *cipher,
     int len = -1;
     uint8_t nonce_counter[16] = { 0 }, mac_iv[16] = { 0 }, mac[16] = { 0 },
             stream_block[16] = { 0 }, zero_block[16] = { 0 }, block_size;
+    ccm_cipher_t ccm;
 
     if (mac_length % 2 != 0  || mac_length < 4 || mac_length > 16) {
         return CCM_ERR_INVALID_MAC_LENGTH;
@@ -192,21 +237,26 @@ int cipher_encrypt_ccm(const cipher_t *cipher,
         return CCM_ERR_INVALID_LENGTH_ENCODING;
     }
 
-    /* Create B0, encrypt it (X1) and use it as mac_iv */
     block_size = cipher_get_block_size(cipher);
     assert(block_size == CCM_BLOCK_SIZE);
-    if (ccm_create_mac_iv(cipher, auth_data_len, mac_length, length_encoding,
+    len = ccm_cipher_init(&ccm, cipher);
+    if (len < 0) {
+        return len;
+    }
+
+    /* Create B0, encrypt it (X1) and use it as mac_iv */
+    if (ccm_create_mac_iv(&ccm, auth_data_len, mac_length, length_encoding,
                           nonce, nonce_len, input_len, mac_iv) < 0) {
         return CCM_ERR_INVALID_DATA_LENGTH;
     }
 
     /* MAC calculation (T) with additional data and plaintext */
-    len = ccm_compute_adata_mac(cipher, auth_data, auth_data_len, mac_iv);
+    len = ccm_compute_adata_mac(&ccm, auth_data, auth_data_len, mac_iv);
     if (len < 0) {
         return len;
     }
 
-    len = ccm_compute_cbc_mac(cipher, mac_iv, input, input_len, mac);
+    len = ccm_compute_cbc_mac(&ccm, mac_iv, input, input_len, mac);
     if (len < 0) {
         return len;
     }
@@ -250,6 +300,7 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
             zero_block[16] = { 0 },
             block_size;
     size_t plain_len;
+    ccm_cipher_t ccm;
 
     if (mac_length % 2 != 0  || mac_length < 4 || mac_length > 16) {
         return CCM_ERR_INVALID_MAC_LENGTH;
@@ -281,18 +332,23 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
         return len;
     }
 
+    len = ccm_cipher_init(&ccm, cipher);
+    if (len < 0) {
+        return len;
+    }
+
     /* Create B0, encrypt it (X1) and use it as mac_iv */
-    if (ccm_create_mac_iv(cipher, auth_data_len, mac_length, length_encoding,
+    if (ccm_create_mac_iv(&ccm, auth_data_len, mac_length, length_encoding,
                           nonce, nonce_len, plain_len, mac_iv) < 0) {
         return CCM_ERR_INVALID_DATA_LENGTH;
     }
 
     /* MAC calculation (T) with additional data and plaintext */
-    len = ccm_compute_adata_mac(cipher, auth_data, auth_data_len, mac_iv);
+    len = ccm_compute_adata_mac(&ccm, auth_data, auth_data_len, mac_iv);
     if (len < 0) {
         return len;
     }
-    len = ccm_compute_cbc_mac(cipher, mac_iv, plain, plain_len, mac);
+    len = ccm_compute_cbc_mac(&ccm, mac_iv, plain, plain_len, mac);
     if (len < 0) {
         return len;
     }
@@ -18,32 +18,49 @@
  * @}
  */
 
+#include <string.h>
+
 #include "crypto/helper.h"
 #include "crypto/modes/ctr.h"
 
+/**
+ * @brief   Number of key stream blocks computed at once
+ */
+#define CTR_BLOCKS_PER_ROUND    (4U)
+
 int cipher_encrypt_ctr(const cipher_t *cipher, uint8_t nonce_counter[16],
                        uint8_t nonce_len, const uint8_t *input, size_t length,
                        uint8_t *output)
 {
     size_t offset = 0;
-    uint8_t stream_block[16] = { 0 }, block_size;
+    uint8_t stream[CTR_BLOCKS_PER_ROUND * CIPHER_MAX_BLOCK_SIZE], block_size;
 
     block_size = cipher_get_block_size(cipher);
     do {
-        uint8_t block_size_input;
+        size_t chunk = length - offset;
+        unsigned nblocks = 0;
+
+        /* prepare the counter blocks of this round, at least one block is
+         * encrypted even for an empty input */
+        do {
+            memcpy(&stream[nblocks * block_size], nonce_counter, block_size);
+            crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+            nblocks++;
+        } while ((nblocks < CTR_BLOCKS_PER_ROUND) &&
+                 (nblocks * block_size < chunk));
 
-        if (cipher_encrypt(cipher, nonce_counter, stream_block) != 1) {
+        if (cipher_encrypt_blocks(cipher, stream, stream, nblocks) != 1) {
             return CIPHER_ERR_ENC_FAILED;
         }
 
-        block_size_input = (length - offset > block_size) ?
-                           block_size : length - offset;
-        for (uint8_t i = 0; i < block_size_input; ++i) {
-            output[offset + i] = stream_block[i] ^ input[offset + i];
+        if (chunk > nblocks * block_size) {
+            chunk = nblocks * block_size;
+        }
+        for (size_t i = 0; i < chunk; ++i) {
+            output[offset + i] = stream[i] ^ input[offset + i];
         }
 
-        offset += block_size_input;
-        crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+        offset += chunk;
     } while (offset < length);
 
     return offset;
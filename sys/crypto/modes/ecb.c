@@ -34,14 +34,12 @@ int cipher_encrypt_ecb(const cipher_t *cipher, const uint8_t *input,
         return CIPHER_ERR_INVALID_LENGTH;
     }
 
-    offset = 0;
-    do {
-        if (cipher_encrypt(cipher, input + offset, output + offset) != 1) {
-            return CIPHER_ERR_ENC_FAILED;
-        }
-
-        offset += block_size;
-    } while (offset < length);
+    /* keep encrypting one block for an empty input, as before */
+    offset = (length > 0) ? length : block_size;
+    if (cipher_encrypt_blocks(cipher, input, output,
+                              offset / block_size) != 1) {
+        return CIPHER_ERR_ENC_FAILED;
+    }
 
     return offset;
 }
@@ -42,6 +42,7 @@ static int constfs_fstat(vfs_file_t *filp, struct stat *buf);
 static off_t constfs_lseek(vfs_file_t *filp, off_t off, int whence);
 static int constfs_open(vfs_file_t *filp, const char *name, int flags, mode_t mode);
 static ssize_t constfs_read(vfs_file_t *filp, void *dest, size_t nbytes);
+static ssize_t constfs_read_ptr(vfs_file_t *filp, const void **dest, size_t nbytes);
 
 /* Directory operations */
 static int constfs_opendir(vfs_DIR *dirp, const char *dirname);
@@ -57,6 +58,7 @@ static const vfs_file_ops_t constfs_file_ops = {
     .lseek = constfs_lseek,
     .open  = constfs_open,
     .read  = constfs_read,
+    .read_ptr = constfs_read_ptr,
 };
 
 static const vfs_dir_ops_t constfs_dir_ops = {
@@ -203,6 +205,23 @@ static ssize_t constfs_read(vfs_file_t *filp, void *dest, size_t nbytes)
     return nbytes;
 }
 
+static ssize_t constfs_read_ptr(vfs_file_t *filp, const void **dest, size_t nbytes)
+{
+    constfs_file_t *fp = filp->private_data.ptr;
+    DEBUG("constfs_read_ptr: %p, %p, %" PRIuSIZE "\n", (void *)filp, (void *)dest, nbytes);
+    if ((size_t)filp->pos >= fp->size) {
+        /* Current offset is at or beyond end of file */
+        return 0;
+    }
+
+    if (nbytes > (fp->size - filp->pos)) {
+        nbytes = fp->size - filp->pos;
+    }
+    *dest = (const uint8_t *)fp->data + filp->pos;
+    filp->pos += nbytes;
+    return nbytes;
+}
+
 static int constfs_opendir(vfs_DIR *dirp, const char *dirname)
 {
     DEBUG("constfs_opendir: %p, \"%s\"\n", (void *)dirp, dirname);
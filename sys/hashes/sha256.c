@@ -78,6 +78,33 @@ void sha256(const void *data, size_t len, void *digest)
     sha256_final(&c, digest);
 }
 
+void sha256_iolist(const iolist_t *iolist, void *digest)
+{
+    sha256_context_t c;
+    assert(digest);
+
+    sha256_init(&c);
+    for (; iolist; iolist = iolist->iol_next) {
+        sha256_update(&c, iolist->iol_base, iolist->iol_len);
+    }
+    sha256_final(&c, digest);
+}
+
+void sha256_mb(const void *const data[], const size_t len[], size_t count,
+               uint8_t digests[][SHA256_DIGEST_LENGTH])
+{
+#if SHA256_MB_LANES > 1
+    sha256_context_t c;
+
+    sha256_init(&c);
+    sha2xx_mb(c.state, data, len, count, digests[0], SHA256_DIGEST_LENGTH);
+#else
+    for (size_t i = 0; i < count; i++) {
+        sha256(data[i], len[i], digests[i]);
+    }
+#endif
+}
+
 void hmac_sha256_init(hmac_context_t *ctx, const void *key, size_t key_length)
 {
     unsigned char k[SHA256_INTERNAL_BLOCK_SIZE];
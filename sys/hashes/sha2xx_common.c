@@ -168,6 +168,148 @@ static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
     }
 }
 
+#if SHA2XX_MB_LANES > 1
+/** @brief One 32 bit word of each lane */
+typedef uint32_t sha2xx_vec_t __attribute__((vector_size(SHA2XX_MB_LANES * 4)));
+
+/* blocks of the messages, including the padding */
+static inline size_t _mb_blocks(size_t len)
+{
+    return (len + 9 + 63) / 64;
+}
+
+/*
+ * SHA256 block compression function for all lanes at once.  Lanes whose
+ * bits in @p active are cleared keep their state.
+ */
+static void sha2xx_transform_mb(sha2xx_vec_t *state,
+                                const unsigned char *block[SHA2XX_MB_LANES],
+                                const sha2xx_vec_t *active)
+{
+    sha2xx_vec_t W[16];
+    sha2xx_vec_t S[8];
+
+    /* 1. Prepare message schedule W, transposed to one vector per word */
+    for (int i = 0; i < 16; i++) {
+        for (int l = 0; l < SHA2XX_MB_LANES; l++) {
+            const unsigned char *p = &block[l][i * 4];
+            W[i][l] = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+                      ((uint32_t)p[2] << 8) | p[3];
+        }
+    }
+
+    /* 2. Initialize working variables. */
+    memcpy(S, state, sizeof(S));
+
+    /* 3. Mix, expanding the message schedule on the fly. */
+    for (int i = 0; i < 64; ++i) {
+        sha2xx_vec_t w;
+        if (i < 16) {
+            w = W[i];
+        }
+        else {
+            w = s1(W[(i - 2) & 15]) + W[(i - 7) & 15] +
+                s0(W[(i - 15) & 15]) + W[i & 15];
+            W[i & 15] = w;
+        }
+
+        sha2xx_vec_t e = S[(68 - i) % 8], f = S[(69 - i) % 8];
+        sha2xx_vec_t g = S[(70 - i) % 8], h = S[(71 - i) % 8];
+        sha2xx_vec_t t0 = h + S1(e) + Ch(e, f, g) + w + K[i];
+
+        sha2xx_vec_t a = S[(64 - i) % 8], b = S[(65 - i) % 8];
+        sha2xx_vec_t c = S[(66 - i) % 8], d = S[(67 - i) % 8];
+        sha2xx_vec_t t1 = S0(a) + Maj(a, b, c);
+
+        S[(67 - i) % 8] = d + t0;
+        S[(71 - i) % 8] = t0 + t1;
+    }
+
+    /* 4. Mix local working variables into the state of the active lanes */
+    for (int i = 0; i < 8; i++) {
+        state[i] += S[i] & *active;
+    }
+}
+
+void sha2xx_mb(const uint32_t iv[8], const void *const data[],
+               const size_t len[], size_t count, uint8_t *digests,
+               size_t dig_len)
+{
+    /* the last one or two blocks of each message, holding the padding */
+    unsigned char tail[SHA2XX_MB_LANES][128];
+
+    for (size_t first = 0; first < count; first += SHA2XX_MB_LANES) {
+        const unsigned char *block[SHA2XX_MB_LANES];
+        size_t full[SHA2XX_MB_LANES];
+        size_t blocks[SHA2XX_MB_LANES];
+        size_t max_blocks = 0;
+        sha2xx_vec_t state[8];
+
+        for (int l = 0; l < SHA2XX_MB_LANES; l++) {
+            if (first + l >= count) {
+                /* unused lane, never active */
+                full[l] = blocks[l] = 0;
+                continue;
+            }
+
+            size_t n = len[first + l];
+            size_t r = n % 64;
+            uint64_t bits = (uint64_t)n << 3;
+
+            full[l] = n / 64;
+            blocks[l] = _mb_blocks(n);
+            if (blocks[l] > max_blocks) {
+                max_blocks = blocks[l];
+            }
+
+            memset(tail[l], 0, sizeof(tail[l]));
+            if (r) {
+                memcpy(tail[l], (const unsigned char *)data[first + l] + n - r, r);
+            }
+            tail[l][r] = 0x80;
+            for (unsigned i = 0; i < 8; i++) {
+                tail[l][(blocks[l] - full[l]) * 64 - 1 - i] = bits >> (8 * i);
+            }
+        }
+
+        for (int i = 0; i < 8; i++) {
+            for (int l = 0; l < SHA2XX_MB_LANES; l++) {
+                state[i][l] = iv[i];
+            }
+        }
+
+        for (size_t b = 0; b < max_blocks; b++) {
+            sha2xx_vec_t active;
+
+            for (int l = 0; l < SHA2XX_MB_LANES; l++) {
+                active[l] = (b < blocks[l]) ? UINT32_MAX : 0;
+                if (b < full[l]) {
+                    block[l] = (const unsigned char *)data[first + l] + b * 64;
+                }
+                else if (b < blocks[l]) {
+                    block[l] = &tail[l][(b - full[l]) * 64];
+                }
+                else {
+                    block[l] = tail[l];
+                }
+            }
+            sha2xx_transform_mb(state, block, &active);
+        }
+
+        for (int l = 0; l < SHA2XX_MB_LANES && first + l < count; l++) {
+            uint8_t *digest = &digests[(first + l) * dig_len];
+            for (size_t i = 0; i < dig_len / 4; i++) {
+                uint32_t w = state[i][l];
+                digest[4 * i] = w >> 24;
+                digest[4 * i + 1] = w >> 16;
+                digest[4 * i + 2] = w >> 8;
+                digest[4 * i + 3] = w;
+            }
+        }
+    }
+}
+#endif /* SHA2XX_MB_LANES > 1 */
+
 static const unsigned char PAD[64] = {
     0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
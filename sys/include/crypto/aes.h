@@ -32,6 +32,7 @@
 
 #include <stdint.h>
 #include "crypto/ciphers.h"
+#include "kernel_defines.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -68,6 +69,23 @@ typedef struct {
     uint32_t context[(4 * (AES_MAXNR + 1)) + 1];
 } aes_context_t;
 
+/**
+ * @brief   expanded AES encryption key
+ *
+ * Holds the key schedule computed by aes_expand_key(), so that it can be
+ * reused for any number of aes_encrypt_expanded() calls.
+ */
+typedef struct {
+    /** @cond INTERNAL */
+    uint32_t rd_key[4 * (AES_MAXNR + 1)];
+    int rounds;
+#if IS_USED(MODULE_CRYPTO_AES_CT)
+    uint8_t raw_key[AES_KEY_SIZE_256];
+    uint8_t key_size;
+#endif
+    /** @endcond */
+} aes_key_t;
+
 /**
  * @brief   initializes the AES Cipher-algorithm with the passed parameters
  *
@@ -105,6 +123,63 @@ int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize);
 int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
                 uint8_t *cipher_block);
 
+/**
+ * @brief   encrypts @p nblocks independent blocks
+ *
+ * The key schedule is only computed once for all blocks. With the
+ * `crypto_aes_ct` module, a bitsliced constant-time implementation encrypts
+ * two blocks at a time. Otherwise, on native for x86-64, AES-NI is used if
+ * the host supports it.
+ *
+ * @param       context       the cipher_context_t-struct to use for this
+ *                            encryption
+ * @param       plain_blocks  the plaintext blocks, @p nblocks * blocksize
+ *                            bytes
+ * @param       cipher_blocks where the ciphertext blocks will be stored, may
+ *                            be equal to @p plain_blocks
+ * @param       nblocks       number of blocks
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_encrypt_blocks(const cipher_context_t *context,
+                       const uint8_t *plain_blocks, uint8_t *cipher_blocks,
+                       size_t nblocks);
+
+/**
+ * @brief   expands @p raw_key into the encryption key schedule
+ *
+ * @param[out]  key           the expanded key
+ * @param       raw_key       the cipher key
+ * @param       key_size      size of @p raw_key in bytes, one of
+ *                            AES_KEY_SIZE_128, AES_KEY_SIZE_192 or
+ *                            AES_KEY_SIZE_256
+ *
+ * @return  1 on success
+ * @return  A negative value if @p key_size is invalid
+ */
+int aes_expand_key(aes_key_t *key, const uint8_t *raw_key, uint8_t key_size);
+
+/**
+ * @brief   encrypts @p nblocks independent blocks with an expanded key
+ *
+ * Same as aes_encrypt_blocks(), but without computing the key schedule.
+ * With the `crypto_aes_ct` module, the bitsliced implementation still
+ * derives its own key schedule on every call.
+ *
+ * @param       key           key expanded by aes_expand_key()
+ * @param       plain_blocks  the plaintext blocks, @p nblocks * blocksize
+ *                            bytes
+ * @param       cipher_blocks where the ciphertext blocks will be stored, may
+ *                            be equal to @p plain_blocks
+ * @param       nblocks       number of blocks
+ *
+ * @return  1 on success
+ */
+int aes_encrypt_expanded(const aes_key_t *key, const uint8_t *plain_blocks,
+                         uint8_t *cipher_blocks, size_t nblocks);
+
 /**
  * @brief   decrypts one cipher-block and saves the plain-block in plainBlock.
  *          decrypts one blocksize long block of ciphertext pointed to by
@@ -22,6 +22,7 @@
 #ifndef CRYPTO_CIPHERS_H
 #define CRYPTO_CIPHERS_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "modules.h"
 
@@ -102,6 +103,16 @@ typedef struct cipher_interface_st {
     /** @brief the decrypt function */
     int (*decrypt)(const cipher_context_t *ctx, const uint8_t *cipher_block,
                    uint8_t *plain_block);
+
+    /**
+     * @brief the function encrypting multiple independent blocks at once
+     *
+     * Optional, may be NULL. @p plain_blocks and @p cipher_blocks may be the
+     * same buffer.
+     */
+    int (*encrypt_blocks)(const cipher_context_t *ctx,
+                          const uint8_t *plain_blocks, uint8_t *cipher_blocks,
+                          size_t nblocks);
 } cipher_interface_t;
 
 /** Pointer type to BlockCipher-Interface for the Cipher-Algorithms */
@@ -157,6 +168,26 @@ int cipher_init(cipher_t *cipher, cipher_id_t cipher_id, const uint8_t *key,
 int cipher_encrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output);
 
+/**
+ * @brief Encrypt @p nblocks independent blocks of BLOCK_SIZE length
+ *
+ * This is equivalent to calling @ref cipher_encrypt for each block, but
+ * ciphers may prepare the key only once and process several blocks in
+ * parallel.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to input data to encrypt, of size
+ *                   @p nblocks * BLOCK_SIZE
+ * @param output     pointer to allocated memory for encrypted data, of size
+ *                   @p nblocks * BLOCK_SIZE. May be equal to @p input.
+ * @param nblocks    number of blocks to encrypt
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t nblocks);
+
 /**
  * @brief Decrypt data of BLOCK_SIZE length
  * *
@@ -51,6 +51,7 @@
 #include <stddef.h>
 
 #include "hashes/sha2xx_common.h"
+#include "iolist.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -66,6 +67,11 @@ extern "C" {
  */
 #define SHA256_INTERNAL_BLOCK_SIZE (64)
 
+/**
+ * @brief Number of messages sha256_mb() hashes concurrently
+ */
+#define SHA256_MB_LANES SHA2XX_MB_LANES
+
 /**
  * @brief Context for cipher operations based on sha256
  */
@@ -133,6 +139,32 @@ static inline void sha256_final(sha256_context_t *ctx, void *digest)
  */
 void sha256(const void *data, size_t len, void *digest);
 
+/**
+ * @brief Generate the hash of the concatenation of all buffers in @p iolist
+ *
+ * @param[in] iolist  list of buffers to generate the hash from
+ * @param[out] digest Pointer to an array for the result, length must
+ *                    be SHA256_DIGEST_LENGTH
+ */
+void sha256_iolist(const iolist_t *iolist, void *digest);
+
+/**
+ * @brief Generate the hashes of @p count independent buffers
+ *
+ * On native, up to @ref SHA256_MB_LANES messages are hashed concurrently
+ * using the vector extensions of the compiler. The messages of a batch are
+ * processed until the longest one is done, so this works best for messages
+ * of similar length. Elsewhere, the messages are hashed one after the
+ * other.
+ *
+ * @param[in] data     buffers to generate the hashes from
+ * @param[in] len      lengths of the buffers in @p data
+ * @param[in] count    number of buffers
+ * @param[out] digests resulting digests, one for each buffer
+ */
+void sha256_mb(const void *const data[], const size_t len[], size_t count,
+               uint8_t digests[][SHA256_DIGEST_LENGTH]);
+
 /**
  * @brief hmac_sha256_init HMAC SHA-256 calculation. Initiate calculation of a HMAC
  * @param[in] ctx hmac_context_t handle to use
@@ -56,6 +56,17 @@
 extern "C" {
 #endif
 
+/**
+ * @brief    Number of messages processed concurrently by sha2xx_mb()
+ */
+#ifndef SHA2XX_MB_LANES
+#if defined(CPU_NATIVE) && defined(__GNUC__)
+#define SHA2XX_MB_LANES (8)
+#else
+#define SHA2XX_MB_LANES (1)
+#endif
+#endif
+
 /**
  * @brief    Structure to hold the SHA-2XX context.
  */
@@ -94,6 +105,23 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len);
  */
 void sha2xx_final(sha2xx_context_t *ctx, void *digest, size_t dig_len);
 
+/**
+ * @brief SHA-2XX hashing of multiple independent messages
+ *
+ * Each group of @ref SHA2XX_MB_LANES messages is processed in parallel
+ * lanes. Only available if @ref SHA2XX_MB_LANES is greater than one.
+ *
+ * @param iv          initial hash value
+ * @param[in] data    messages
+ * @param[in] len     lengths of the messages
+ * @param count       number of messages
+ * @param digests     @p count digests of @p dig_len bytes each
+ * @param dig_len     Length of a digest
+ */
+void sha2xx_mb(const uint32_t iv[8], const void *const data[],
+               const size_t len[], size_t count, uint8_t *digests,
+               size_t dig_len);
+
 #ifdef __cplusplus
 }
 #endif
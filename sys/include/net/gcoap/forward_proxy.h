@@ -11,6 +11,20 @@
  * @ingroup     net_gcoap
  * @brief       Forward proxy implementation for GCoAP
  * @note Does not support CoAPS yet.
+ *
+ * Request coalescing
+ * ------------------
+ *
+ * With the `gcoap_forward_proxy_coalesce` module, a GET or FETCH request that
+ * arrives while an upstream request for the same resource is still
+ * outstanding is not forwarded again. Instead, it is attached to the
+ * outstanding request and answered from its response, each client with its
+ * own token and message ID. Requests are considered equal when their
+ * @ref nanocoap_cache_key_generate "nanocoap cache keys" match. Observe
+ * registrations are never coalesced. Each coalesced client occupies a slot
+ * of the @ref CONFIG_GCOAP_REQ_WAITING_MAX client endpoints until the
+ * response arrives.
+ *
  * @see <a href="https://tools.ietf.org/html/rfc7252#section-5.7.2">
  *          RFC 7252
  *      </a>
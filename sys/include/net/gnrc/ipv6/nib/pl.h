@@ -90,6 +90,21 @@ int gnrc_ipv6_nib_pl_set(unsigned iface,
 void gnrc_ipv6_nib_pl_del(unsigned iface,
                           const ipv6_addr_t *pfx, unsigned pfx_len);
 
+/**
+ * @brief   Gets the generation of the prefix list
+ *
+ * Lets users of the prefix list tell whether results they derived from it
+ * are still current. Updating the lifetimes of a prefix does not change the
+ * generation.
+ *
+ * Does not acquire the NIB lock, so it can be called with a network
+ * interface locked.
+ *
+ * @return  A number that changes whenever a prefix is added to or removed
+ *          from the prefix list.
+ */
+uint32_t gnrc_ipv6_nib_pl_gen(void);
+
 /**
  * @brief   Iterates over all prefix list entries in the NIB.
  *
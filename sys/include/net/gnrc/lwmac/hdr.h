@@ -24,6 +24,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "modules.h"
 #include "net/ieee802154.h"
 
 #ifdef __cplusplus
@@ -81,6 +82,9 @@ typedef struct {
 typedef struct __attribute__((packed)) {
     gnrc_lwmac_hdr_t header;        /**< WR packet header type */
     gnrc_lwmac_l2_addr_t dst_addr;  /**< WR is broadcast, so destination address needed */
+#if IS_USED(MODULE_GNRC_LWMAC_ADAPTIVE) || defined(DOXYGEN)
+    uint8_t queue_len;              /**< Packets queued for the destination */
+#endif
 } gnrc_lwmac_frame_wr_t;
 
 /**
@@ -90,6 +94,9 @@ typedef struct __attribute__((packed)) {
     gnrc_lwmac_hdr_t header;        /**< WA packet header type */
     gnrc_lwmac_l2_addr_t dst_addr;  /**< WA is broadcast, so destination address needed */
     uint32_t current_phase;         /**< Node's current phase value */
+#if IS_USED(MODULE_GNRC_LWMAC_ADAPTIVE) || defined(DOXYGEN)
+    uint8_t wakeup_level;           /**< Node's current wake-up interval level */
+#endif
 } gnrc_lwmac_frame_wa_t;
 
 /**
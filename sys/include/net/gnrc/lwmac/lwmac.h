@@ -63,6 +63,29 @@
  * receiver's phase is too close to its own phase, it will run a backoff scheme to
  * randomly reselect a new wake-up phase for itself.
  *
+ * ## Adaptive wake-up interval
+ * With the `gnrc_lwmac_adaptive` module, a node adapts its wake-up interval to
+ * the traffic it receives. Each WR carries the number of packets the sender
+ * has queued for the receiver. If that queue occupancy reaches
+ * @ref CONFIG_GNRC_LWMAC_ADAPTIVE_QUEUE_HIGH, the receiver halves its wake-up
+ * interval, down to @ref CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US >>
+ * @ref CONFIG_GNRC_LWMAC_ADAPTIVE_LEVEL_MAX. After
+ * @ref CONFIG_GNRC_LWMAC_ADAPTIVE_IDLE_CYCLES wake-ups without a WR, it
+ * doubles the interval again.
+ *
+ * The wake-up interval is a property of the receiver, not of a link: a node
+ * has a single level for all its senders, raised by the largest queue
+ * occupancy any of them reports. A sender with little traffic for the node
+ * hence also meets it at the shorter interval while another sender is
+ * busy.
+ *
+ * The wake-ups at a shorter interval always include those at all longer
+ * intervals, and the phase reported in the WA refers to the base interval.
+ * Hence, phase-locking keeps working while the interval changes. The WA also
+ * carries the current level, which the senders keep per neighbor to meet the
+ * receiver at its next wake-up instead of its next base wake-up. All nodes of
+ * a network need to use the module, as it extends the WR and WA frames.
+ *
  * @{
  *
  * @file
@@ -330,6 +353,37 @@ extern "C" {
 #define CONFIG_GNRC_LWMAC_RADIO_REINIT_THRESHOLD     (10U)
 #endif
 
+/**
+ * @brief Maximum level of the adaptive wake-up interval
+ *
+ * With the `gnrc_lwmac_adaptive` module, the wake-up interval at level `n` is
+ * @ref CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US >> `n`. The shortest interval
+ * should leave room for a few @ref GNRC_LWMAC_WAKEUP_DURATION_US.
+ */
+#ifndef CONFIG_GNRC_LWMAC_ADAPTIVE_LEVEL_MAX
+#define CONFIG_GNRC_LWMAC_ADAPTIVE_LEVEL_MAX         (3U)
+#endif
+
+/**
+ * @brief Queue occupancy of a sender to shorten the wake-up interval
+ *
+ * If a WR reports at least this many packets queued for this node, it halves
+ * its wake-up interval (`gnrc_lwmac_adaptive` module only).
+ */
+#ifndef CONFIG_GNRC_LWMAC_ADAPTIVE_QUEUE_HIGH
+#define CONFIG_GNRC_LWMAC_ADAPTIVE_QUEUE_HIGH        (2U)
+#endif
+
+/**
+ * @brief Idle wake-ups to lengthen the wake-up interval
+ *
+ * After this many consecutive wake-ups without receiving a WR, a node doubles
+ * its wake-up interval (`gnrc_lwmac_adaptive` module only).
+ */
+#ifndef CONFIG_GNRC_LWMAC_ADAPTIVE_IDLE_CYCLES
+#define CONFIG_GNRC_LWMAC_ADAPTIVE_IDLE_CYCLES       (4U)
+#endif
+
 /**
  * @brief   Creates an IEEE 802.15.4 LWMAC network interface
  *
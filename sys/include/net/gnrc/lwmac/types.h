@@ -201,6 +201,13 @@ typedef struct lwmac {
     uint8_t lwmac_info;                                         /**< LWMAC's internal information (flags) */
     gnrc_lwmac_timeout_t timeouts[CONFIG_GNRC_LWMAC_TIMEOUT_COUNT];    /**< Store timeouts used for protocol */
 
+#if IS_USED(MODULE_GNRC_LWMAC_ADAPTIVE) || defined(DOXYGEN)
+    /* Parameters for adapting the wake-up interval */
+    uint32_t wakeup_anchor;                                     /**< A wake-up of the base interval in ticks */
+    uint8_t wakeup_level;                                       /**< Current wake-up interval level */
+    uint8_t idle_wakeups;                                       /**< Consecutive wake-ups without a WR */
+#endif
+
 #if (GNRC_MAC_ENABLE_DUTYCYCLE_RECORD == 1)
     /* Parameters for recording duty-cycle */
     uint32_t last_radio_on_time_ticks;                          /**< The last time in ticks when radio is on */
@@ -209,6 +216,9 @@ typedef struct lwmac {
     uint32_t awake_duration_sum_ticks;                          /**< The sum of time in ticks when radio is on */
     uint32_t pkt_start_sending_time_ticks;                      /**< The time in ticks when the packet is started
                                                                      to be sent */
+    uint32_t tx_delay_sum_ticks;                                /**< The sum of MAC delays in ticks of sent packets */
+    uint32_t tx_delay_max_ticks;                                /**< The largest MAC delay in ticks of a sent packet */
+    uint32_t tx_count;                                          /**< The number of sent unicast packets */
 #endif
 } gnrc_lwmac_t;
 
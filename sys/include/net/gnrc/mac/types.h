@@ -125,6 +125,10 @@ typedef struct {
     gnrc_priority_pktqueue_t queue;                  /**< TX queue for this particular Neighbor */
 #endif /* (GNRC_MAC_TX_QUEUE_SIZE != 0) || defined(DOXYGEN) */
 
+#ifdef MODULE_GNRC_LWMAC_ADAPTIVE
+    uint8_t wakeup_level;   /**< Neighbor's wake-up interval level. */
+#endif
+
 #ifdef MODULE_GNRC_GOMACH
     uint16_t pub_chanseq;   /**< Neighbor's current public channel sequence. */
     uint32_t cp_phase;      /**< Neighbor's wake-up phase. */
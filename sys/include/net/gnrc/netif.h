@@ -216,6 +216,28 @@ typedef struct {
      * @note    Only available with @ref net_gnrc_netif_pktq.
      */
     gnrc_netif_pktq_t send_queue;
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_RX_POLL) || defined(DOXYGEN)
+    /**
+     * @brief   Frames received while polling the device, passed up once
+     *          polling is done
+     *
+     * @note    Only available with module `gnrc_netif_rx_poll`.
+     */
+    gnrc_pktsnip_t *rx_polled[CONFIG_GNRC_NETIF_RX_POLL_BUDGET];
+    /**
+     * @brief   Number of frames in gnrc_netif_t::rx_polled
+     *
+     * @note    Only available with module `gnrc_netif_rx_poll`.
+     */
+    uint8_t rx_polled_len;
+    /**
+     * @brief   The device is currently polled from
+     *          gnrc_netif_t::event_isr
+     *
+     * @note    Only available with module `gnrc_netif_rx_poll`.
+     */
+    bool rx_polling;
 #endif
     /**
      * @brief   Message queue for the netif thread
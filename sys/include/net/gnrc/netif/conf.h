@@ -79,6 +79,57 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_PKTQ_TIMER_US       (5000U)
 #endif
 
+/**
+ * @brief       Deficit round robin quantum in bytes for
+ *              @ref GNRC_NETIF_PKTQ_CLASS_INTERACTIVE
+ *
+ * The quanta of the round robin classes set their share of the send
+ * capacity left over by @ref GNRC_NETIF_PKTQ_CLASS_CONTROL when all of them
+ * are backlogged.
+ *
+ * @note        Only used with module `gnrc_netif_pktq_sched`.
+ * @see         net_gnrc_netif_pktq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_SCHED_QUANTUM_INTERACTIVE
+#define CONFIG_GNRC_NETIF_PKTQ_SCHED_QUANTUM_INTERACTIVE    (512U)
+#endif
+
+/**
+ * @brief       Deficit round robin quantum in bytes for
+ *              @ref GNRC_NETIF_PKTQ_CLASS_DEFAULT
+ *
+ * @note        Only used with module `gnrc_netif_pktq_sched`.
+ * @see         net_gnrc_netif_pktq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_SCHED_QUANTUM_DEFAULT
+#define CONFIG_GNRC_NETIF_PKTQ_SCHED_QUANTUM_DEFAULT        (256U)
+#endif
+
+/**
+ * @brief       Deficit round robin quantum in bytes for
+ *              @ref GNRC_NETIF_PKTQ_CLASS_BULK
+ *
+ * @note        Only used with module `gnrc_netif_pktq_sched`.
+ * @see         net_gnrc_netif_pktq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_SCHED_QUANTUM_BULK
+#define CONFIG_GNRC_NETIF_PKTQ_SCHED_QUANTUM_BULK           (128U)
+#endif
+
+/**
+ * @brief   Number of destinations to remember the selected source address for
+ *
+ * @ref gnrc_netif_ipv6_addr_best_src() runs the RFC 6724 source address
+ * selection over all addresses of the interface. With module
+ * `gnrc_netif_ipv6_src_cache` its result is remembered for this many
+ * destinations per interface, until the addresses of the interface change.
+ *
+ * @note    Only used with module `gnrc_netif_ipv6_src_cache`.
+ */
+#ifndef CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE
+#define CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE   (4U)
+#endif
+
 /**
  * @brief   Number of multicast addresses needed for @ref net_gnrc_rpl "RPL".
  *
@@ -173,6 +224,25 @@ extern "C" {
 #ifndef CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US
 #define CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US   (0U)
 #endif
+
+/**
+ * @brief   Maximum number of frames received per device interrupt
+ *
+ * With module `gnrc_netif_rx_poll` the network interface thread keeps
+ * polling devices that support @ref NETOPT_RX_POLL after an interrupt
+ * until either the device stops delivering frames or this budget is used up.
+ * This is budgeted polling, not batched dispatch: the frames collected this
+ * way are still handed to the upper layers one by one afterwards, with one
+ * @ref net_gnrc_netapi dispatch each. Only the event loop iteration is saved, a
+ * flood of frames costs one per budget instead of one per frame. Events of
+ * other network interfaces and pending sends are serviced at the latest after
+ * this many frames.
+ *
+ * @note    Only used with module `gnrc_netif_rx_poll`.
+ */
+#ifndef CONFIG_GNRC_NETIF_RX_POLL_BUDGET
+#define CONFIG_GNRC_NETIF_RX_POLL_BUDGET           (8U)
+#endif
 /** @} */
 
 /**
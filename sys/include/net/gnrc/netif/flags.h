@@ -146,6 +146,12 @@ enum {
  */
 #define GNRC_NETIF_FLAGS_TX_FROM_PKTQUEUE          (0x00020000U)
 
+/**
+ * @brief   Used when module gnrc_netif_rx_poll is used to indicate that the
+ *          device can be polled for received frames (see @ref NETOPT_RX_POLL)
+ */
+#define GNRC_NETIF_FLAGS_RX_POLL                   (0x00040000U)
+
 /** @} */
 
 #ifdef __cplusplus
@@ -119,6 +119,10 @@ void gnrc_netif_ipv6_addr_remove_internal(gnrc_netif_t *netif,
  *
  * Can be used to check if an address is assigned to an interface.
  *
+ * Does not acquire @p netif unless its addresses are changed concurrently,
+ * so it can be used on the receive path without contending with
+ * configuration changes.
+ *
  * @param[in] netif the network interface
  * @param[in] addr  the address to check
  *
@@ -215,6 +219,9 @@ ipv6_addr_t *gnrc_netif_ipv6_addr_best_src(gnrc_netif_t *netif,
  * @brief   Gets an interface by an address (incl. multicast groups) assigned
  *          to it.
  *
+ * The interfaces are not acquired unless their addresses are changed
+ * concurrently.
+ *
  * @pre `addr != NULL`
  *
  * @param[in] addr  an IPv6 address
@@ -273,6 +280,8 @@ void gnrc_netif_ipv6_group_leave_internal(gnrc_netif_t *netif,
  *
  * Can be used to check if a multicast address is assigned to an interface.
  *
+ * Does not acquire @p netif unless its groups are changed concurrently.
+ *
  * @param[in] netif the network interface
  * @param[in] addr  the multicast address to check
  *
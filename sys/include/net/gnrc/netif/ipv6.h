@@ -18,6 +18,9 @@
 #ifndef NET_GNRC_NETIF_IPV6_H
 #define NET_GNRC_NETIF_IPV6_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "modules.h"
 
 #include "evtimer_msg.h"
@@ -70,6 +73,20 @@ extern "C" {
 #define GNRC_NETIF_IPV6_ADDRS_FLAGS_ANYCAST                (0x20U)
 /** @} */
 
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_SRC_CACHE) || defined(DOXYGEN)
+/**
+ * @brief   Memoized result of the source address selection for a destination
+ *
+ * @note    Only available with module `gnrc_netif_ipv6_src_cache`.
+ */
+typedef struct {
+    ipv6_addr_t dst;    /**< destination address */
+    int8_t src;         /**< index of the selected source address, -1 if none */
+    bool ll_only;       /**< only link-local addresses were considered */
+    bool used;          /**< entry holds a result */
+} gnrc_netif_ipv6_src_cache_t;
+#endif
+
 /**
  * @brief   IPv6 component for @ref gnrc_netif_t
  *
@@ -98,6 +115,54 @@ typedef struct {
      * @note    Only available with module @ref net_gnrc_ipv6 "gnrc_ipv6".
      */
     ipv6_addr_t groups[GNRC_NETIF_IPV6_GROUPS_NUMOF];
+
+    /**
+     * @brief   Sequence counter of gnrc_netif_ipv6_t::addrs and
+     *          gnrc_netif_ipv6_t::groups
+     *
+     * Incremented before and after either table is changed, so it is odd
+     * while a change is in progress. This allows lookups to scan the tables
+     * without acquiring the interface.
+     *
+     * @note    Only available with module @ref net_gnrc_ipv6 "gnrc_ipv6".
+     */
+    uint16_t addrs_seq;
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_SRC_CACHE) || defined(DOXYGEN)
+    /**
+     * @brief   Results of recent source address selections
+     *
+     * The cache is flushed when an address is added or removed, when
+     * gnrc_netif_ipv6_t::addrs_flags differ from
+     * gnrc_netif_ipv6_t::src_cache_flags, i.e. when the state of an address
+     * changed since the results were stored, and when the prefix list of the
+     * NIB changed (rule 8 depends on the prefix lengths).
+     *
+     * @note    Only available with module `gnrc_netif_ipv6_src_cache`.
+     */
+    gnrc_netif_ipv6_src_cache_t src_cache[CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE];
+    /**
+     * @brief   Copy of gnrc_netif_ipv6_t::addrs_flags the entries in
+     *          gnrc_netif_ipv6_t::src_cache are based on
+     *
+     * @note    Only available with module `gnrc_netif_ipv6_src_cache`.
+     */
+    uint8_t src_cache_flags[CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF];
+    /**
+     * @brief   Generation of the prefix list the entries in
+     *          gnrc_netif_ipv6_t::src_cache are based on
+     *
+     * @see     gnrc_ipv6_nib_pl_gen()
+     *
+     * @note    Only available with module `gnrc_netif_ipv6_src_cache`.
+     */
+    uint32_t src_cache_pl_gen;
+    /**
+     * @brief   Next entry in gnrc_netif_ipv6_t::src_cache to replace
+     *
+     * @note    Only available with module `gnrc_netif_ipv6_src_cache`.
+     */
+    uint8_t src_cache_next;
+#endif
 #ifdef MODULE_NETSTATS_IPV6
     /**
      * @brief IPv6 packet statistics
@@ -10,6 +10,23 @@
  * @defgroup    net_gnrc_netif_pktq Send queue for @ref net_gnrc_netif
  * @ingroup     net_gnrc_netif
  * @brief
+ *
+ * With module `gnrc_netif_pktq_sched`, the send queue is split into one
+ * queue per traffic class (see @ref gnrc_netif_pktq_class_t), so bulk
+ * transfers no longer hold back control traffic while the device is busy.
+ * @ref GNRC_NETIF_PKTQ_CLASS_CONTROL is always sent first; the remaining
+ * classes share the device by deficit round robin with the quanta
+ * @ref CONFIG_GNRC_NETIF_PKTQ_SCHED_QUANTUM_INTERACTIVE,
+ * @ref CONFIG_GNRC_NETIF_PKTQ_SCHED_QUANTUM_DEFAULT, and
+ * @ref CONFIG_GNRC_NETIF_PKTQ_SCHED_QUANTUM_BULK. Packets keep their order
+ * within a class. All classes still share the pool of
+ * @ref CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE entries.
+ *
+ * Packets are classified by the IPv6 header they carry. On 6LoWPAN interfaces
+ * that header is read from the IPHC compressed (or uncompressed) 6LoWPAN
+ * header of unfragmented frames and first fragments. Subsequent fragments
+ * and frames without a recognizable IPv6 header end up in
+ * @ref GNRC_NETIF_PKTQ_CLASS_DEFAULT.
  * @{
  *
  * @file
@@ -53,6 +70,51 @@ int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
  */
 unsigned gnrc_netif_pktq_usage(void);
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_SCHED) || defined(DOXYGEN)
+/**
+ * @brief   Determines the traffic class of a packet
+ *
+ * @note    Only available with module `gnrc_netif_pktq_sched`.
+ *
+ * @param[in] pkt   A packet. May not be NULL.
+ *
+ * @return  The traffic class of @p pkt.
+ */
+gnrc_netif_pktq_class_t gnrc_netif_pktq_classify(const gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Gets the queue statistics of a traffic class
+ *
+ * @note    Only available with module `gnrc_netif_pktq_sched`.
+ *
+ * @pre `netif != NULL`
+ * @pre `cls < GNRC_NETIF_PKTQ_CLASS_NUMOF`
+ *
+ * @param[in] netif A network interface. May not be NULL.
+ * @param[in] cls   A traffic class.
+ *
+ * @return  The statistics of @p cls on @p netif.
+ */
+static inline const gnrc_netif_pktq_stats_t *gnrc_netif_pktq_stats(
+    const gnrc_netif_t *netif, gnrc_netif_pktq_class_t cls)
+{
+    assert(netif != NULL);
+    assert(cls < GNRC_NETIF_PKTQ_CLASS_NUMOF);
+
+    return &netif->send_queue.stats[cls];
+}
+
+/**
+ * @brief   Removes the next entry to send from a multi-queue send queue
+ * @internal
+ *
+ * @param[in] queue The send queue of a network interface.
+ *
+ * @return  The entry to send next, NULL when all queues are empty.
+ */
+gnrc_pktqueue_t *gnrc_netif_pktq_sched_next(gnrc_netif_pktq_t *queue);
+#endif
+
 /**
  * @brief   Gets a packet from the packet send queue of a network interface
  *
@@ -69,9 +131,13 @@ static inline gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_t *netif)
     assert(netif != NULL);
 
     gnrc_pktsnip_t *pkt = NULL;
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_SCHED)
+    gnrc_pktqueue_t *entry = gnrc_netif_pktq_sched_next(&netif->send_queue);
+#else
     gnrc_pktqueue_t *entry = gnrc_pktqueue_remove_head(
         &netif->send_queue.queue
     );
+#endif
 
     if (entry != NULL) {
         pkt = entry->pkt;
@@ -103,6 +169,10 @@ void gnrc_netif_pktq_sched_get(gnrc_netif_t *netif);
  * @brief   Pushes a packet back to the head of the packet send queue of a
  *          network interface
  *
+ * With module `gnrc_netif_pktq_sched`, the packet is pushed back to the head
+ * of the queue of its traffic class and its length is credited back to the
+ * class, so a packet that could not be sent does not lose its turn.
+ *
  * @pre `netif != NULL`
  * @pre `pkt != NULL`
  *
@@ -130,7 +200,16 @@ static inline bool gnrc_netif_pktq_empty(gnrc_netif_t *netif)
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
     assert(netif != NULL);
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_SCHED)
+    for (unsigned i = 0; i < GNRC_NETIF_PKTQ_CLASS_NUMOF; i++) {
+        if (netif->send_queue.queues[i] != NULL) {
+            return false;
+        }
+    }
+    return true;
+#else
     return (netif->send_queue.queue == NULL);
+#endif
 #else   /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
     (void)netif;
     return false;
@@ -23,6 +23,10 @@
 #ifndef NET_GNRC_NETIF_PKTQ_TYPE_H
 #define NET_GNRC_NETIF_PKTQ_TYPE_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "modules.h"
 #include "net/gnrc/pktqueue.h"
 #include "xtimer.h"
 
@@ -30,11 +34,72 @@
 extern "C" {
 #endif
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_SCHED) || defined(DOXYGEN)
+/**
+ * @brief   Traffic classes of the multi-queue scheduler
+ *
+ * @note    Only available with module `gnrc_netif_pktq_sched`.
+ */
+typedef enum {
+    /**
+     * @brief   Network control traffic (ICMPv6 other than echo, DSCP CS6 and
+     *          CS7), always sent first
+     */
+    GNRC_NETIF_PKTQ_CLASS_CONTROL = 0,
+    /**
+     * @brief   Latency-sensitive traffic (DSCP CS4 to EF)
+     */
+    GNRC_NETIF_PKTQ_CLASS_INTERACTIVE,
+    /**
+     * @brief   Best-effort traffic
+     */
+    GNRC_NETIF_PKTQ_CLASS_DEFAULT,
+    /**
+     * @brief   Background traffic (DSCP CS1 and LE)
+     */
+    GNRC_NETIF_PKTQ_CLASS_BULK,
+    GNRC_NETIF_PKTQ_CLASS_NUMOF,        /**< number of traffic classes */
+} gnrc_netif_pktq_class_t;
+
+/**
+ * @brief   Statistics of a traffic class queue
+ *
+ * @note    Only available with module `gnrc_netif_pktq_sched`.
+ */
+typedef struct {
+    uint32_t enqueued;          /**< packets put into the queue */
+    uint32_t dropped;           /**< packets not queued due to a full pool */
+    uint16_t len;               /**< packets currently in the queue */
+    uint16_t high_water;        /**< maximum of gnrc_netif_pktq_stats_t::len */
+} gnrc_netif_pktq_stats_t;
+#endif
+
 /**
  * @brief   A packet queue for @ref net_gnrc_netif with a de-queue timer
  */
 typedef struct {
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_SCHED) || defined(DOXYGEN)
+    /**
+     * @brief   One packet queue per traffic class
+     *
+     * @note    Only available with module `gnrc_netif_pktq_sched`.
+     */
+    gnrc_pktqueue_t *queues[GNRC_NETIF_PKTQ_CLASS_NUMOF];
+    /**
+     * @brief   Deficit counters in bytes for deficit round robin
+     */
+    int32_t deficit[GNRC_NETIF_PKTQ_CLASS_NUMOF];
+    /**
+     * @brief   Per-class queue statistics
+     */
+    gnrc_netif_pktq_stats_t stats[GNRC_NETIF_PKTQ_CLASS_NUMOF];
+    uint8_t drr_class;          /**< class currently served by round robin */
+    bool drr_granted;           /**< quantum of gnrc_netif_pktq_t::drr_class
+                                 *   was already granted in this round */
+#endif
+#if !IS_USED(MODULE_GNRC_NETIF_PKTQ_SCHED) || defined(DOXYGEN)
     gnrc_pktqueue_t *queue;     /**< the actual packet queue class */
+#endif
 #if CONFIG_GNRC_NETIF_PKTQ_TIMER_US >= 0
     msg_t dequeue_msg;          /**< message for gnrc_netif_pktq_t::dequeue_timer to send */
     xtimer_t dequeue_timer;     /**< timer to schedule next sending of
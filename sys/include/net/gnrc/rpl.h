@@ -24,6 +24,13 @@
  *   USEMODULE += gnrc_rpl
  *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * - MRHOF objective function with ETX as link metric
+ *   ([RFC6719](https://tools.ietf.org/html/rfc6719)), see
+ *   @ref net_gnrc_rpl_mrhof
+ *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ *   USEMODULE += gnrc_rpl_mrhof
+ *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
  * - RPL auto-initialization on interface
  *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
  *   USEMODULE += auto_init_gnrc_rpl
@@ -108,7 +115,8 @@
  * ------
  *
  * The GNRC RPL implementation only implements storing mode
- * with OF0 ([RFC6552](https://tools.ietf.org/html/rfc6552)).
+ * with OF0 ([RFC6552](https://tools.ietf.org/html/rfc6552)) and, optionally,
+ * MRHOF without metric container ([RFC6719](https://tools.ietf.org/html/rfc6719)).
  * The RPL routing header is parsed by the nodes when the [@c gnrc_rpl_srh](@ref net_gnrc_rpl_srh)
  * module is used, but anything else
  * for non-storing mode is missing.
@@ -116,8 +124,7 @@
  *
  * - IPv6 Hop-by-hop RPL option
  *   (see [#7231](https://github.com/RIOT-OS/RIOT/pull/7231#issuecomment-651237343))
- * - Metric based routing ([RFC6551](https://tools.ietf.org/html/rfc6551)
- *   and [RFC6719](https://tools.ietf.org/html/rfc6719))
+ * - Metric based routing ([RFC6551](https://tools.ietf.org/html/rfc6551))
  *   (see [14448](https://github.com/RIOT-OS/RIOT/pull/14448) and
  *   [#14623](https://github.com/RIOT-OS/RIOT/pull/14623))
  * - Non-Storing mode
@@ -245,15 +252,39 @@ extern "C" {
 #define CONFIG_GNRC_RPL_DEFAULT_MAX_RANK_INCREASE (0)
 #endif
 
+/**
+ * @name    Objective Code Points
+ * @see <a href="https://www.iana.org/assignments/rpl/rpl.xhtml#ocp">
+ *          IANA, Objective Code Point (OCP)
+ *      </a>
+ * @{
+ */
+#define GNRC_RPL_OCP_OF0    (0x0)   /**< Objective Function Zero (RFC 6552) */
+#define GNRC_RPL_OCP_MRHOF  (0x1)   /**< Minimum Rank with Hysteresis OF (RFC 6719) */
+/** @} */
+
 /**
  * @brief   Number of implemented Objective Functions
  */
-#define GNRC_RPL_IMPLEMENTED_OFS_NUMOF (1)
+#define GNRC_RPL_IMPLEMENTED_OFS_NUMOF (1 + IS_USED(MODULE_GNRC_RPL_MRHOF))
+
+/**
+ * @brief   Default Objective Code Point
+ *
+ * MRHOF if the `gnrc_rpl_mrhof` module is used, OF0 otherwise.
+ */
+#ifndef CONFIG_GNRC_RPL_DEFAULT_OCP
+#if IS_USED(MODULE_GNRC_RPL_MRHOF)
+#define CONFIG_GNRC_RPL_DEFAULT_OCP (GNRC_RPL_OCP_MRHOF)
+#else
+#define CONFIG_GNRC_RPL_DEFAULT_OCP (GNRC_RPL_OCP_OF0)
+#endif
+#endif
 
 /**
- * @brief   Default Objective Code Point (OF0)
+ * @brief   Default Objective Code Point
  */
-#define GNRC_RPL_DEFAULT_OCP (0)
+#define GNRC_RPL_DEFAULT_OCP (CONFIG_GNRC_RPL_DEFAULT_OCP)
 
 /**
  * @brief   Default Instance ID
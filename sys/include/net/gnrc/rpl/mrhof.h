@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_rpl_mrhof Minimum Rank with Hysteresis Objective Function
+ * @ingroup     net_gnrc_rpl
+ * @brief       Implementation of MRHOF with ETX as link metric
+ * @see <a href="https://tools.ietf.org/html/rfc6719">
+ *          RFC 6719
+ *      </a>
+ *
+ * MRHOF is used without a DAG metric container: the path cost via a parent
+ * is its advertised rank plus the ETX of the link to it, scaled to at least
+ * the DODAG's MinHopRankIncrease. The ETX is taken from the neighbor
+ * statistics of the interface (@ref net_netstats), neighbors
+ * without statistics are assumed to have an ETX of
+ * @ref NETSTATS_NB_ETX_INIT.
+ *
+ * The path cost of each parent is recomputed with every DIO it sends, DIOs
+ * that do not change the cost don't trigger a re-evaluation of the parent
+ * set. The preferred parent is only replaced by a parent whose path cost is
+ * lower by at least @ref CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD, which
+ * keeps it from flapping between links of similar quality.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Definitions for MRHOF
+ */
+#ifndef NET_GNRC_RPL_MRHOF_H
+#define NET_GNRC_RPL_MRHOF_H
+
+#include "net/gnrc/rpl/structs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum link metric (ETX * 128) of a usable parent
+ * @see <a href="https://tools.ietf.org/html/rfc6719#section-5">
+ *          RFC 6719, section 5, MRHOF Variables and Parameters
+ *      </a>
+ */
+#ifndef CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC
+#define CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC       (512)
+#endif
+
+/**
+ * @brief   Maximum path cost of a usable parent
+ * @see <a href="https://tools.ietf.org/html/rfc6719#section-5">
+ *          RFC 6719, section 5, MRHOF Variables and Parameters
+ *      </a>
+ */
+#ifndef CONFIG_GNRC_RPL_MRHOF_MAX_PATH_COST
+#define CONFIG_GNRC_RPL_MRHOF_MAX_PATH_COST         (32768)
+#endif
+
+/**
+ * @brief   Minimum improvement of the path cost (ETX * 128) before the
+ *          preferred parent is switched
+ * @see <a href="https://tools.ietf.org/html/rfc6719#section-5">
+ *          RFC 6719, section 5, MRHOF Variables and Parameters
+ *      </a>
+ */
+#ifndef CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD
+#define CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD   (192)
+#endif
+
+/**
+ * @brief   Return the address to the MRHOF objective function
+ *
+ * @return  Address of the MRHOF objective function
+ */
+gnrc_rpl_of_t *gnrc_rpl_get_of_mrhof(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_RPL_MRHOF_H */
+/** @} */
@@ -243,7 +243,8 @@ struct gnrc_rpl_parent {
     uint8_t dtsn;                   /**< last seen dtsn of this parent */
     uint16_t rank;                  /**< rank of the parent */
     gnrc_rpl_dodag_t *dodag;        /**< DODAG the parent belongs to */
-    double link_metric;             /**< metric of the link */
+    uint16_t link_metric;           /**< metric of the link, as cached by the OF */
+    uint16_t path_cost;             /**< cost of the path via this parent, as cached by the OF */
     uint8_t link_metric_type;       /**< type of the metric */
     /**
      * @brief Parent timeout events (see @ref GNRC_RPL_MSG_TYPE_PARENT_TIMEOUT)
@@ -277,7 +278,8 @@ typedef struct {
      * Compares two parents based on the rank calculated by the objective
      * function. This function is used to determine the parent list order. The
      * parents are ordered from the preferred parent to the least preferred
-     * parent.
+     * parent. While sorting, the DODAG's parent list still starts with the
+     * current preferred parent.
      *
      * @param[in] parent1 First parent to compare.
      * @param[in] parent2 Second parent to compare.
@@ -304,6 +306,21 @@ typedef struct {
      */
     void (*init)(gnrc_rpl_dodag_t *dodag);
     void (*process_dio)(void);  /**< DIO processing callback (acc. to OF0 spec, chpt 5) */
+
+    /**
+     * @brief Update the cached path cost of a parent.
+     *
+     * Called for every DIO received from @p parent. The parent set is only
+     * re-evaluated if this returns true, so an objective function can
+     * suppress insignificant metric changes here. May be NULL, the parent set
+     * is re-evaluated on every DIO then.
+     *
+     * @param[in]   parent  Parent whose DIO was received.
+     *
+     * @return      true, if the preference of @p parent changed.
+     * @return      false, otherwise.
+     */
+    bool (*update_parent)(gnrc_rpl_parent_t *parent);
 } gnrc_rpl_of_t;
 
 /**
@@ -92,6 +92,30 @@
  *
  * Unexpected events will be reported and asserted.
  *
+ * Pipelined transmissions
+ * =======================
+ *
+ * With `USEMODULE += ieee802154_submac_pipeline`, @ref ieee802154_send also
+ * accepts a frame while the SubMAC is still busy with the previous one (states
+ * PREPARE, TX and WAIT FOR ACK). The frame is copied into a staging buffer of
+ * the SubMAC, so the caller may release it right away. As soon as the
+ * transmission in progress ends, the staged frame is loaded into the radio and
+ * goes to PREPARE directly, before the upper layer is notified with
+ * @ref ieee802154_submac_cb_t::tx_done. Only one frame is staged at a time.
+ * Frames are not staged from within the callbacks, where @ref ieee802154_send
+ * still returns `-EBUSY`.
+ *
+ * The frame buffer of the radio still holds the frame in flight for
+ * retransmissions, hence the staged frame is not written to the radio earlier.
+ *
+ * Frame pending ACK
+ * =================
+ *
+ * Also with `ieee802154_submac_pipeline`: after a transmission was
+ * acknowledged with the frame pending bit set, the transceiver stays in RX
+ * (the SubMAC goes to RX instead of IDLE), so the data frame that is about to
+ * follow is not missed. If a frame is staged, it is sent first.
+ *
  * The upper layer needs to implement the following callbacks:
  *
  * - @ref ieee802154_submac_cb_t::rx_done.
@@ -115,6 +139,7 @@ extern "C" {
 #include <string.h>
 #include "assert.h"
 
+#include "modules.h"
 #include "net/ieee802154.h"
 #include "net/ieee802154/radio.h"
 
@@ -147,7 +172,10 @@ typedef struct {
      * This function is called from the SubMAC to indicate that the TX
      * procedure finished.
      *
-     * The SubMAC will automatically go to IDLE.
+     * The SubMAC will automatically go to IDLE. With module
+     * `ieee802154_submac_pipeline` it goes to RX after an ACK with the frame
+     * pending bit set or to PREPARE if a frame is staged (see
+     * @ref net_ieee802154_submac "Pipelined transmissions").
      *
      * @param[in] submac pointer to the SubMAC descriptor
      * @param[out] info TX information associated to the transmission (status,
@@ -208,6 +236,11 @@ struct ieee802154_submac {
     ieee802154_fsm_state_t fsm_state;    /**< State of the SubMAC */
     ieee802154_phy_mode_t phy_mode;     /**< IEEE 802.15.4 PHY mode */
     const iolist_t *psdu;               /**< stores the current PSDU */
+#if IS_USED(MODULE_IEEE802154_SUBMAC_PIPELINE) || defined(DOXYGEN)
+    iolist_t staged;                    /**< frame to send after the current one */
+    uint8_t staged_buf[IEEE802154_FRAME_LEN_MAX];   /**< buffer of @p staged */
+    bool in_tx_done;                    /**< tx_done callback is running */
+#endif
 };
 
 /**
@@ -224,6 +257,9 @@ struct ieee802154_submac {
  * @return -EBUSY if the SubMAC is not in RX or IDLE state or if called inside
  *         @ref ieee802154_submac_cb_t::rx_done or
  *         @ref ieee802154_submac_cb_t::tx_done
+ * @return -EBUSY with module `ieee802154_submac_pipeline`, if a frame is
+ *         already staged
+ * @return -EOVERFLOW if a frame to be staged is too long
  */
 int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist);
 
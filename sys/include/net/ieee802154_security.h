@@ -16,6 +16,14 @@
  * management framework. This is intended for experimentation with the security
  * modes of 802.15.4, and not for use cases where its security is depended on.
  *
+ * Per-link keys can be provided by setting
+ * @ref ieee802154_sec_context_t::key_lookup. If the device does not
+ * implement the cipher operations itself, the AES key schedule is computed
+ * again for every frame. With the `ieee802154_security_key_cache`
+ * module, the schedules of the @ref CONFIG_IEEE802154_SEC_KEY_CACHE_SIZE most
+ * recently used keys are kept instead, which speeds up nodes that talk to
+ * many peers with different keys.
+ *
  * @{
  *
  * @file
@@ -30,9 +38,12 @@
 #ifndef NET_IEEE802154_SECURITY_H
 #define NET_IEEE802154_SECURITY_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "ieee802154.h"
+#include "crypto/aes.h"
 #include "crypto/ciphers.h"
+#include "kernel_defines.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -116,6 +127,13 @@ struct ieee802154_sec_dev {
 #define CONFIG_IEEE802154_SEC_DEFAULT_KEY       "pizza_margherita"
 #endif
 
+#if !defined(CONFIG_IEEE802154_SEC_KEY_CACHE_SIZE) || defined(DOXYGEN)
+/**
+ * @brief   Number of expanded keys kept by `ieee802154_security_key_cache`
+ */
+#define CONFIG_IEEE802154_SEC_KEY_CACHE_SIZE    (4U)
+#endif
+
 /**
  * @brief   Length of an AES key in bytes
  */
@@ -232,6 +250,15 @@ typedef enum {
     IEEE802154_SEC_UNSUPORTED,                          /**< Unsupported operation */
 } ieee802154_sec_error_t;
 
+/**
+ * @brief   Entry of the expanded key cache
+ */
+typedef struct {
+    uint8_t key[IEEE802154_SEC_KEY_LENGTH];     /**< raw key */
+    uint16_t last_used;                         /**< LRU stamp, 0 if unused */
+    aes_key_t schedule;                         /**< expanded key */
+} ieee802154_sec_key_cache_entry_t;
+
 /**
  * @brief   Struct to hold IEEE 802.15.4 security information
  */
@@ -266,6 +293,40 @@ typedef struct ieee802154_sec_context {
      * @brief   802.15.4 security dev
      */
     ieee802154_sec_dev_t dev;
+    /**
+     * @brief   Optional callback to look up the key of a frame
+     *
+     * If `NULL`, the key of @ref ieee802154_sec_context_t::cipher is used
+     * for all frames.
+     *
+     * @param[in]   ctx         IEEE 802.15.4 security context
+     * @param[in]   mhr         MAC header, followed by the auxiliary
+     *                          security header
+     * @param[in]   mhr_len     Length of @p mhr without the auxiliary
+     *                          security header
+     * @param[in]   rx          true for received frames, false for frames
+     *                          to be sent
+     *
+     * @return      The @ref IEEE802154_SEC_KEY_LENGTH bytes long key
+     * @return      NULL if there is no key for the frame
+     */
+    const uint8_t *(*key_lookup)(const struct ieee802154_sec_context *ctx,
+                                 const uint8_t *mhr, uint8_t mhr_len,
+                                 bool rx);
+    /**
+     * @brief   Key of the frame that is currently processed
+     */
+    const uint8_t *key;
+#if IS_USED(MODULE_IEEE802154_SECURITY_KEY_CACHE) || defined(DOXYGEN)
+    /**
+     * @brief   Expanded key schedules of the most recently used keys
+     */
+    ieee802154_sec_key_cache_entry_t key_cache[CONFIG_IEEE802154_SEC_KEY_CACHE_SIZE];
+    /**
+     * @brief   Clock for the LRU stamps of the cache entries
+     */
+    uint16_t key_cache_clock;
+#endif
 } ieee802154_sec_context_t;
 
 /**
@@ -225,7 +225,8 @@ typedef struct {
     iolist_t *snips;                                  /**< payload snips (optional)*/
     uint16_t payload_len;                             /**< length of payload       */
     uint16_t options_len;                             /**< length of options array */
-    coap_optpos_t options[CONFIG_NANOCOAP_NOPTS_MAX]; /**< option offset array     */
+    coap_optpos_t options[CONFIG_NANOCOAP_NOPTS_MAX]; /**< option offset array,
+                                                           sorted by option number */
     BITFIELD(opt_crit, CONFIG_NANOCOAP_NOPTS_MAX);    /**< unhandled critical option */
 #ifdef MODULE_GCOAP
     uint32_t observe_value;                           /**< observe value           */
@@ -813,6 +814,11 @@ static inline size_t coap_hdr_len(const coap_hdr_t *hdr)
  * @param[in]   pkt     packet to work on
  * @param[in]   opt_num the option number to search for
  *
+ * The lookup uses the option offsets recorded by @ref coap_parse (or while
+ * adding options), so it takes O(log n) in the number of options and does
+ * not walk the packet. If the option is repeated, the first occurrence is
+ * returned.
+ *
  * @returns     pointer to the option data
  *              NULL if option number was not found
  */
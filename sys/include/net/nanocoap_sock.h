@@ -190,6 +190,25 @@ extern "C" {
 #define CONFIG_NANOCOAP_SOCK_BLOCK_TOKEN        (0)
 #endif
 
+/**
+ * @brief   Maximum number of Block2 requests kept outstanding during a
+ *          block-wise GET
+ *
+ * With a value of 1, every block is requested only after the previous one
+ * was received. Larger values pipeline the requests, so transfers over links
+ * with a high round-trip time finish considerably faster. Blocks are still
+ * handed to the callback in order, out-of-order blocks are buffered.
+ *
+ * If this is larger than 1, @ref nanocoap_sock_get_blockwise reserves
+ * `(CONFIG_NANOCOAP_SOCK_BLOCKWISE_WINDOW - 1)` blocks of
+ * @ref CONFIG_NANOCOAP_BLOCKSIZE_DEFAULT bytes on the stack for reordering.
+ * Use @ref nanocoap_sock_get_blockwise_window to provide that buffer
+ * explicitly.
+ */
+#ifndef CONFIG_NANOCOAP_SOCK_BLOCKWISE_WINDOW
+#define CONFIG_NANOCOAP_SOCK_BLOCKWISE_WINDOW   (1)
+#endif
+
 /**
  * @brief   Event priority for nanoCoAP sock events (e.g. used by `nanocoap_sock_observe`)
  */
@@ -852,6 +871,36 @@ int nanocoap_sock_get_blockwise(nanocoap_sock_t *sock, const char *path,
                                 coap_blksize_t blksize,
                                 coap_blockwise_cb_t callback, void *arg);
 
+/**
+ * @brief    Performs a blockwise coap get request on a socket, keeping
+ *           multiple block requests outstanding at the same time.
+ *
+ * This function behaves like @ref nanocoap_sock_get_blockwise, but up to
+ * @ref CONFIG_NANOCOAP_SOCK_BLOCKWISE_WINDOW block requests are in flight
+ * at the same time. @p callback is still called for each block in order.
+ *
+ * @p work_buf is used to store blocks that arrive out of order. The
+ * effective window size is one more than the number of blocks of size
+ * @p blksize that fit into @p work_buf. If no block fits, this is equivalent
+ * to @ref nanocoap_sock_get_blockwise.
+ *
+ * @param[in]   sock            socket to use for the request
+ * @param[in]   path            pointer to source path
+ * @param[in]   blksize         sender suggested SZX for the COAP block request
+ * @param[in]   work_buf        buffer for reordering received blocks
+ * @param[in]   work_buf_len    size of @p work_buf
+ * @param[in]   callback        callback to be executed on each received block
+ * @param[in]   arg             optional function arguments
+ *
+ * @returns     0 on success
+ * @returns     -ETIMEDOUT if a block could not be retrieved
+ * @returns     <0 on other errors
+ */
+int nanocoap_sock_get_blockwise_window(nanocoap_sock_t *sock, const char *path,
+                                       coap_blksize_t blksize,
+                                       void *work_buf, size_t work_buf_len,
+                                       coap_blockwise_cb_t callback, void *arg);
+
 /**
  * @brief    Performs a blockwise coap get request to the specified url, store
  *           the response in a buffer.
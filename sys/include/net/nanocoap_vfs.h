@@ -56,7 +56,8 @@ int nanocoap_vfs_get(nanocoap_sock_t *sock, const char *path, const char *dst);
  *
  * @param[in]   url          URL to the resource
  * @param[in]   src          Path to the source file
- * @param[in]   work_buf     Buffer to read file blocks into
+ * @param[in]   work_buf     Buffer to read file blocks into, not used if
+ *                           the file system supports @ref vfs_read_ptr
  * @param[in]   work_buf_len Size of the buffer. Should be 1 byte more
  *                           than the desired CoAP blocksize.
  *
@@ -72,7 +73,8 @@ int nanocoap_vfs_put_url(const char *url, const char *src,
  * @param[in]   sock         Connection to the server
  * @param[in]   path         Remote query path to the resource
  * @param[in]   src          Path to the source file
- * @param[in]   work_buf     Buffer to read file blocks into
+ * @param[in]   work_buf     Buffer to read file blocks into, not used if
+ *                           the file system supports @ref vfs_read_ptr
  * @param[in]   work_buf_len Size of the buffer. Should be 1 byte more
  *                           than the desired CoAP blocksize.
  *
@@ -871,6 +871,17 @@ typedef enum {
      */
     NETOPT_GTS_TX,
 
+    /**
+     * @brief   (@ref netopt_enable_t) The device can be polled for received
+     *          frames (read-only)
+     *
+     * A driver returning @ref NETOPT_ENABLE allows its netdev_driver_t::isr()
+     * to be called while no interrupt is pending. netdev_driver_t::recv()
+     * must then report that no frame is available instead of blocking or
+     * returning stale data.
+     */
+    NETOPT_RX_POLL,
+
     /**
      * @brief   maximum number of options defined here.
      *
@@ -373,6 +373,24 @@ typedef struct {
     sock_aux_flags_t flags; /**< Flags used request information */
 } sock_udp_aux_tx_t;
 
+/**
+ * @brief   A single datagram for sock_udp_recv_batch() and
+ *          sock_udp_send_batch()
+ */
+typedef struct {
+    void *data;             /**< payload to send or buffer to receive into */
+    size_t max_len;         /**< size of sock_udp_mmsg_t::data (receive only) */
+    size_t len;             /**< length of the payload */
+    /**
+     * @brief   Remote end point of the datagram
+     *
+     * On receive, the source of the datagram is stored here.
+     * On send, the datagram is sent to this end point. May be `NULL` in
+     * either case (on send only, if the sock has a remote end point).
+     */
+    sock_udp_ep_t *remote;
+} sock_udp_mmsg_t;
+
 /**
  * @brief   Creates a new UDP sock object
  *
@@ -797,6 +815,74 @@ static inline ssize_t sock_udp_sendv(sock_udp_t *sock,
     return sock_udp_sendv_aux(sock, snips, remote, NULL);
 }
 
+/**
+ * @brief   Receives multiple UDP messages from remote end points
+ *
+ * Only waits for the first datagram, then returns all further datagrams
+ * already queued for @p sock without blocking, up to @p num. This saves the
+ * per-call overhead of sock_udp_recv() when datagrams arrive in bursts.
+ *
+ * @pre `(sock != NULL) && ((msgs != NULL) || (num == 0))`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  Array of @p num messages. sock_udp_mmsg_t::data and
+ *                      sock_udp_mmsg_t::max_len must be set by the caller,
+ *                      sock_udp_mmsg_t::len and sock_udp_mmsg_t::remote
+ *                      (if not `NULL`) are set by the function.
+ * @param[in] num       Number of entries in @p msgs.
+ * @param[in] timeout   Timeout for the first datagram in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @note    A datagram larger than sock_udp_mmsg_t::max_len of the next free
+ *          message is dropped, just like with sock_udp_recv().
+ *
+ * @return  The number of messages received on success.
+ * @return  -EADDRNOTAVAIL, if local of @p sock is not given.
+ * @return  -EAGAIN, if @p timeout is `0` and no data is available.
+ * @return  -EINVAL, if @p sock is not properly initialized (or closed while
+ *          sock_udp_recv_batch() blocks).
+ * @return  -ENOBUFS, if only datagrams too large for @p msgs were received.
+ * @return  -EPROTO, if source address of the first received packet did not
+ *          equal the remote of @p sock.
+ * @return  -ETIMEDOUT, if @p timeout expired.
+ */
+int sock_udp_recv_batch(sock_udp_t *sock, sock_udp_mmsg_t *msgs,
+                        unsigned num, uint32_t timeout);
+
+/**
+ * @brief   Sends multiple UDP messages
+ *
+ * The stack may reuse the resolved end points while consecutive messages go
+ * to the same remote (compared by value, not by the sock_udp_mmsg_t::remote
+ * pointer), so sending a burst to the same remote is cheaper than calling
+ * sock_udp_send() repeatedly.
+ *
+ * @pre `(sock != NULL) && ((msgs != NULL) || (num == 0))`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in] msgs      Array of @p num messages. sock_udp_mmsg_t::max_len is
+ *                      ignored.
+ * @param[in] num       Number of entries in @p msgs.
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @return  The number of messages sent on success. Sending stops at the
+ *          first message that fails, so this may be less than @p num.
+ * @return  The same errors as sock_udp_send(), if the first message could not
+ *          be sent.
+ */
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_mmsg_t *msgs,
+                        unsigned num);
+
 /**
  * @brief   Checks if the IP address of an endpoint is multicast
  *
@@ -34,6 +34,8 @@
 #include <stdint.h>
 
 #include "cose/sign.h"
+#include "hashes/sha256.h"
+#include "kernel_defines.h"
 #include "nanocbor/nanocbor.h"
 #include "uuid.h"
 
@@ -62,6 +64,18 @@ extern "C" {
 #define CONFIG_SUIT_COMPONENT_MAX_NAME_LEN          (32U)
 #endif
 
+/**
+ * @brief Skip reading the payload back from storage with `suit_digest_stream`
+ *
+ * By default, a payload is read back from storage for the image match
+ * condition even if its digest was computed while it was fetched. This also
+ * catches data that got corrupted while it was written. Define this to
+ * trust the digest computed during the fetch instead.
+ */
+#ifdef DOXYGEN
+#define CONFIG_SUIT_DIGEST_STREAM_SKIP_READBACK
+#endif
+
 /**
  * @brief Current SUIT serialization format version
  *
@@ -198,6 +212,7 @@ typedef struct {
 #define SUIT_COMPONENT_STATE_VERIFIED      (1 << 2) /**< Component is verified */
 #define SUIT_COMPONENT_STATE_INSTALLED     (1 << 3) /**< Component is installed, but has not been verified */
 #define SUIT_COMPONENT_STATE_FINALIZED     (1 << 4) /**< Component successfully installed */
+#define SUIT_COMPONENT_STATE_DIGESTED      (1 << 5) /**< Payload digest computed during fetch */
 /** @} */
 
 /**
@@ -226,6 +241,22 @@ typedef struct {
      * @brief Component offset inside the device memory.
      */
     suit_param_ref_t param_component_offset;
+#if IS_USED(MODULE_SUIT_VCDIFF) || defined(DOXYGEN)
+    /**
+     * @brief Source component, the payload is a delta against it
+     *
+     * See @ref sys_suit_vcdiff
+     */
+    suit_param_ref_t param_source_component;
+#endif
+#if IS_USED(MODULE_SUIT_DIGEST_STREAM) || defined(DOXYGEN)
+    /**
+     * @brief SHA-256 digest of the payload, computed while it was fetched
+     *
+     * Only valid if @ref SUIT_COMPONENT_STATE_DIGESTED is set.
+     */
+    uint8_t payload_digest[SHA256_DIGEST_LENGTH];
+#endif
 } suit_component_t;
 
 /**
@@ -247,6 +278,10 @@ typedef struct {
     char *urlbuf;                   /**< Buffer containing the manifest url */
     size_t urlbuf_len;              /**< Length of the manifest url */
     uint32_t seq_number;            /**< Set sequence number */
+#if IS_USED(MODULE_SUIT_DIGEST_STREAM) || defined(DOXYGEN)
+    sha256_context_t payload_sha256; /**< Digest of the payload being fetched */
+    size_t payload_hashed;          /**< Number of payload bytes hashed */
+#endif
 } suit_manifest_t;
 
 /**
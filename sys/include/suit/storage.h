@@ -189,6 +189,26 @@ typedef struct suit_storage_driver {
     int (*read_ptr)(suit_storage_t *storage,
                     const uint8_t **buf, size_t *len);
 
+    /**
+     * @brief Read a chunk of the currently installed payload
+     *
+     * Reads the payload installed at the active location, not the one being
+     * written. Used as the source when applying a delta payload.
+     *
+     * @note Optional to implement, only possible if the backend doesn't
+     *       overwrite the installed payload while writing the new one
+     *
+     * @param[in]   storage     Storage context
+     * @param[out]  buf         Buffer to write the read data in
+     * @param[in]   offset      Offset to read from
+     * @param[in]   len         Number of bytes to read
+     *
+     * @returns     @ref SUIT_OK on successfully reading the chunk
+     * @returns     @ref suit_error_t on error
+     */
+    int (*read_installed)(suit_storage_t *storage, uint8_t *buf,
+                          size_t offset, size_t len);
+
     /**
      * @brief Install the payload or mark the payload as valid
      *
@@ -376,6 +396,20 @@ static inline bool suit_storage_has_readptr(const suit_storage_t *storage)
     return (storage->driver->read_ptr);
 }
 
+/**
+ * @brief Check if the storage backend implements the @ref
+ * suit_storage_driver_t::read_installed function
+ *
+ * @param[in]   storage     Storage context
+ *
+ * @returns     True if the function is implemented,
+ * @returns     False otherwise
+ */
+static inline bool suit_storage_has_installed(const suit_storage_t *storage)
+{
+    return (storage->driver->read_installed);
+}
+
 /**
  * @brief Check if the storage backend implements the @ref
  * suit_storage_driver_t::match_offset function
@@ -487,6 +521,26 @@ static inline int suit_storage_read_ptr(suit_storage_t *storage, const uint8_t
     return storage->driver->read_ptr(storage, buf, len);
 }
 
+/**
+ * @brief Read a chunk of the currently installed payload
+ *
+ * @note Optional to implement, check with @ref suit_storage_has_installed
+ *
+ * @param[in]   storage     Storage context
+ * @param[out]  buf         Buffer to write the read data in
+ * @param[in]   offset      Offset to read from
+ * @param[in]   len         Number of bytes to read
+ *
+ * @returns     @ref SUIT_OK on successfully reading the chunk
+ * @returns     @ref suit_error_t on error
+ */
+static inline int suit_storage_read_installed(suit_storage_t *storage,
+                                              uint8_t *buf, size_t offset,
+                                              size_t len)
+{
+    return storage->driver->read_installed(storage, buf, offset, len);
+}
+
 /**
  * @brief Install the payload or mark the payload as valid
  *
@@ -18,6 +18,9 @@
  *
  * The mock transport is a noop transport. Payloads are preloaded in flash and
  * provided as an array of @ref suit_transport_mock_payload_t to the module.
+ * They are passed to the fetch callback in blocks of
+ * @ref CONFIG_SUIT_TRANSPORT_MOCK_BLOCKSIZE bytes, like the payloads of the
+ * other transports.
  *
  * Both the array of payloads named `payloads` and the size with name
  * `num_payloads` must be provided.
@@ -32,6 +35,22 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Size of the blocks a payload is passed to the fetch callback in
+ */
+#ifndef CONFIG_SUIT_TRANSPORT_MOCK_BLOCKSIZE
+#define CONFIG_SUIT_TRANSPORT_MOCK_BLOCKSIZE    (64U)
+#endif
+
+/**
+ * @brief Callback receiving the blocks of a payload
+ *
+ * Same signature as the nanocoap blockwise callback. @p more is zero for the
+ * last block.
+ */
+typedef int (*suit_transport_mock_cb_t)(void *arg, size_t offset, uint8_t *buf,
+                                        size_t len, int more);
+
 /**
  * @brief Mock payload.
  */
@@ -47,11 +66,14 @@ typedef struct {
  * suit_manifest_t::component_current member
  *
  * @param[in]   manifest    suit manifest context
+ * @param[in]   cb          callback function to store the payload blocks
+ * @param[in]   ctx         context for the callback
  *
  * @returns     SUIT_OK if valid
  * @returns     negative otherwise
  */
-int suit_transport_mock_fetch(const suit_manifest_t *manifest);
+int suit_transport_mock_fetch(const suit_manifest_t *manifest,
+                              suit_transport_mock_cb_t cb, void *ctx);
 
 #ifdef __cplusplus
 }
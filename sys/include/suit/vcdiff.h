@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+/**
+ * @defgroup    sys_suit_vcdiff SUIT delta payloads
+ * @ingroup     sys_suit
+ * @brief       Apply VCDIFF deltas fetched by SUIT against the installed image
+ *
+ * When a component sets the `suit-parameter-source-component` to its own
+ * index, the fetched payload is treated as a VCDIFF delta (interleaved
+ * format, as generated by open-vcdiff) against the currently installed
+ * payload of that component. The image size and image digest in the manifest
+ * describe the reconstructed image, not the delta.
+ *
+ * The delta is applied while it is being fetched. The reconstructed image is
+ * passed on in order, with the same callback signature the transports use,
+ * so it goes through the same size checks as a full image. The installed
+ * payload is read with @ref suit_storage_driver_t::read_installed, which
+ * only backends that keep the installed and the new payload apart provide
+ * (e.g. the riotboot flashwrite backend, which applies the delta against the
+ * running slot while writing the other slot).
+ *
+ * @{
+ *
+ * @file
+ * @brief       SUIT VCDIFF delta payload functions
+ */
+
+#ifndef SUIT_VCDIFF_H
+#define SUIT_VCDIFF_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "suit/storage.h"
+/* angle brackets, a quoted include would find this header itself */
+#include <vcdiff.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Size of the buffer used to collect reconstructed image data
+ *
+ * Reconstructed data is passed on in chunks of this size, the last chunk may
+ * be shorter.
+ */
+#ifndef CONFIG_SUIT_VCDIFF_BUF_SIZE
+#define CONFIG_SUIT_VCDIFF_BUF_SIZE     (64U)
+#endif
+
+/**
+ * @brief Callback receiving the reconstructed image
+ *
+ * Same signature as the nanocoap blockwise callback. @p more is zero for the
+ * last call.
+ */
+typedef int (*suit_vcdiff_cb_t)(void *arg, size_t offset, uint8_t *buf,
+                                size_t len, int more);
+
+/**
+ * @brief SUIT VCDIFF delta context
+ */
+typedef struct {
+    vcdiff_t vcdiff;                /**< VCDIFF decoder state */
+    suit_storage_t *storage;        /**< Backend holding source and target */
+    suit_vcdiff_cb_t cb;            /**< Receives the reconstructed image */
+    void *arg;                      /**< Argument passed to @p cb */
+    size_t delta_len;               /**< Bytes of the delta applied so far */
+    size_t offset;                  /**< Offset of @p buf in the image */
+    size_t buf_len;                 /**< Bytes collected in @p buf */
+    uint8_t buf[CONFIG_SUIT_VCDIFF_BUF_SIZE]; /**< Reconstructed data */
+} suit_vcdiff_t;
+
+/**
+ * @brief Prepare applying a delta against the installed payload
+ *
+ * The active location of @p storage must already be set and its write
+ * sequence started.
+ *
+ * @param[out]  ctx         context to initialize
+ * @param[in]   storage     storage backend of the component
+ * @param[in]   cb          callback receiving the reconstructed image
+ * @param[in]   arg         argument passed to @p cb
+ *
+ * @returns     SUIT_OK on success
+ * @returns     SUIT_ERR_UNSUPPORTED if @p storage can't provide the installed
+ *              payload
+ */
+int suit_vcdiff_init(suit_vcdiff_t *ctx, suit_storage_t *storage,
+                     suit_vcdiff_cb_t cb, void *arg);
+
+/**
+ * @brief Feed the next chunk of the delta
+ *
+ * @param[in]   ctx         delta context
+ * @param[in]   buf         delta data
+ * @param[in]   len         length of @p buf
+ *
+ * @returns     SUIT_OK on success
+ * @returns     negative on error, either from decoding the delta or from the
+ *              callback
+ */
+int suit_vcdiff_apply(suit_vcdiff_t *ctx, const uint8_t *buf, size_t len);
+
+/**
+ * @brief Finish applying the delta
+ *
+ * Passes the remaining reconstructed data to the callback, with `more` set
+ * to zero.
+ *
+ * @param[in]   ctx         delta context
+ *
+ * @returns     SUIT_OK on success
+ * @returns     negative if the delta is incomplete or the callback failed
+ */
+int suit_vcdiff_finish(suit_vcdiff_t *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SUIT_VCDIFF_H */
+/** @} */
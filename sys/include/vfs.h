@@ -302,6 +302,16 @@ extern "C" {
 #define VFS_NAME_MAX (31)
 #endif
 
+#ifndef CONFIG_VFS_MOUNT_CACHE_SIZE
+/**
+ * @brief Number of entries of the mount cache
+ *
+ * Only used with the @ref pseudomodule_vfs_mount_cache module. One entry is
+ * needed per mount point used at the same time, a few more reduce collisions.
+ */
+#define CONFIG_VFS_MOUNT_CACHE_SIZE (8)
+#endif
+
 /**
  * @brief Used with vfs_bind to bind to any available fd number
  */
@@ -570,6 +580,23 @@ struct vfs_file_ops {
      * @return <0 on error
      */
     int (*fsync) (vfs_file_t *filp);
+
+    /**
+     * @brief Read bytes from an open file without copying them
+     *
+     * Optional, for file systems that keep the file contents in memory that
+     * can be accessed directly (e.g. in ROM). Behaves like @c read, but points
+     * @p dest to the file contents instead of copying them. The data must
+     * stay valid while the file is open.
+     *
+     * @param[in]  filp     pointer to open file
+     * @param[out] dest     pointer to the file contents at the current position
+     * @param[in]  nbytes   maximum number of bytes to read
+     *
+     * @return number of bytes available at @p dest on success
+     * @return <0 on error
+     */
+    ssize_t (*read_ptr) (vfs_file_t *filp, const void **dest, size_t nbytes);
 };
 
 /**
@@ -853,6 +880,33 @@ int vfs_open(const char *name, int flags, mode_t mode);
  */
 ssize_t vfs_read(int fd, void *dest, size_t count);
 
+/**
+ * @brief Read bytes from an open file without copying them
+ *
+ * Points @p dest to the file contents at the current position and advances
+ * the position like @ref vfs_read. This avoids copying the data when it is
+ * passed on as a whole, e.g. in an @ref iolist_t. The data stays valid while
+ * the file is open and must not be modified.
+ *
+ * Only file systems that keep the contents in directly accessible memory
+ * (e.g. @ref sys_fs_constfs) support this, callers have to fall back to
+ * @ref vfs_read if -ENOTSUP is returned.
+ *
+ * This only pays off if the data doesn't have to end up in a buffer anyway:
+ * nanocoap_vfs_put() uses it for uploads, but the nanoCoAP file server
+ * doesn't, as its handler has to place each block in the response buffer,
+ * which @ref vfs_read does with the same single copy.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[out] dest     pointer to the file contents
+ * @param[in]  count    maximum number of bytes to read
+ *
+ * @return number of bytes available at @p dest on success
+ * @return -ENOTSUP if the file system can't provide the contents directly
+ * @return <0 on other errors
+ */
+ssize_t vfs_read_ptr(int fd, const void **dest, size_t count);
+
 /**
  * @brief Read a line from an open text file
  *
@@ -19,10 +19,12 @@
 
 #include "event.h"
 #include "kernel_defines.h"
+#include "mutex.h"
 #include "net/gcoap.h"
 #include "net/gcoap/forward_proxy.h"
 #include "uri_parser.h"
 #include "net/nanocoap/cache.h"
+#include "net/sock/util.h"
 #include "ztimer.h"
 
 #include "forward_proxy_internal.h"
@@ -31,6 +33,7 @@
 #include "debug.h"
 
 #define CLIENT_EP_FLAGS_IN_USE          0x80
+#define CLIENT_EP_FLAGS_COALESCE_HEAD   0x40
 #define CLIENT_EP_FLAGS_RESP_TYPE_MASK  0x30
 #define CLIENT_EP_FLAGS_RESP_TYPE_POS   4U
 #define CLIENT_EP_FLAGS_ETAG_LEN_MASK   0x0f
@@ -43,6 +46,14 @@ extern void gcoap_forward_proxy_post_event(void *arg);
 
 static uint8_t proxy_req_buf[CONFIG_GCOAP_PDU_BUF_SIZE];
 static client_ep_t _client_eps[CONFIG_GCOAP_REQ_WAITING_MAX];
+/* the proxy thread frees client endpoints as well, this protects their
+ * allocation and the lists of coalesced clients against the gcoap thread */
+static mutex_t _client_eps_lock = MUTEX_INIT;
+#if IS_USED(MODULE_GCOAP_FORWARD_PROXY_COALESCE)
+/* scratch buffer to rewrite an upstream response for a coalesced client,
+ * whose token may be longer than the one of the forwarded request */
+static uint8_t _coalesce_resp_buf[CONFIG_GCOAP_PDU_BUF_SIZE + COAP_TOKEN_LENGTH_MAX];
+#endif
 
 static int _request_matcher_forward_proxy(gcoap_listener_t *listener,
                                           const coap_resource_t **resource,
@@ -99,26 +110,45 @@ void gcoap_forward_proxy_init(void)
 static client_ep_t *_allocate_client_ep(const sock_udp_ep_t *ep)
 {
     client_ep_t *cep;
+
+    mutex_lock(&_client_eps_lock);
     for (cep = _client_eps;
          cep < (_client_eps + CONFIG_GCOAP_REQ_WAITING_MAX);
          cep++) {
         if (!_cep_in_use(cep)) {
             _cep_set_in_use(cep);
+            mutex_unlock(&_client_eps_lock);
             _cep_set_req_etag(cep, NULL, 0);
             memcpy(&cep->ep, ep, sizeof(*ep));
+#if IS_USED(MODULE_GCOAP_FORWARD_PROXY_COALESCE)
+            cep->next = NULL;
+#endif
             DEBUG("Client_ep is allocated %p\n", (void *)cep);
             return cep;
         }
     }
+    mutex_unlock(&_client_eps_lock);
     return NULL;
 }
 
 static void _free_client_ep(client_ep_t *cep)
 {
-    ztimer_remove(ZTIMER_MSEC, &cep->empty_ack_timer);
-    /* timer removed but event could be queued */
-    cep->flags = 0;
-    DEBUG("Client_ep is freed %p\n", (void *)cep);
+    mutex_lock(&_client_eps_lock);
+    while (cep) {
+        client_ep_t *next = NULL;
+
+        ztimer_remove(ZTIMER_MSEC, &cep->empty_ack_timer);
+        /* timer removed but event could be queued */
+        cep->flags = 0;
+#if IS_USED(MODULE_GCOAP_FORWARD_PROXY_COALESCE)
+        /* clients coalesced onto this one can't be served anymore either */
+        next = cep->next;
+        cep->next = NULL;
+#endif
+        DEBUG("Client_ep is freed %p\n", (void *)cep);
+        cep = next;
+    }
+    mutex_unlock(&_client_eps_lock);
 }
 
 static int _request_matcher_forward_proxy(gcoap_listener_t *listener,
@@ -265,21 +295,12 @@ static void _set_response_type(coap_pkt_t *pdu, uint8_t resp_type)
     }
 }
 
-static void _forward_resp_handler(const gcoap_request_memo_t *memo,
-                                  coap_pkt_t* pdu,
-                                  const sock_udp_ep_t *remote)
+static void _forward_resp_to_client(client_ep_t *cep, coap_pkt_t *pdu,
+                                   size_t buf_len, unsigned state)
 {
-    (void) remote; /* this is the origin server */
-    client_ep_t *cep = (client_ep_t *)memo->context;
-    size_t buf_len;
-
     /* No harm done in removing a timer that's not active */
     ztimer_remove(ZTIMER_MSEC, &cep->empty_ack_timer);
-    buf_len = coap_get_total_len(pdu);
-    assert(memo->state == GCOAP_MEMO_RESP ||
-           memo->state == GCOAP_MEMO_RESP_TRUNC ||
-           memo->state == GCOAP_MEMO_TIMEOUT);
-    if (memo->state == GCOAP_MEMO_RESP) {
+    if (state == GCOAP_MEMO_RESP) {
         uint8_t req_etag_len = _cep_get_req_etag_len(cep);
 
         if (req_etag_len > 0) {
@@ -312,7 +333,7 @@ static void _forward_resp_handler(const gcoap_request_memo_t *memo,
          * converted by the client-side to the cached response */
         /* else forward the response packet as-is to the client */
     }
-    else if (memo->state == GCOAP_MEMO_RESP_TRUNC) {
+    else if (state == GCOAP_MEMO_RESP_TRUNC) {
         /* the response was truncated, so there should be enough space
          * to allocate an empty error message instead (with a potential Observe option) if not,
          * _listen_buf is _way_ too short ;-) */
@@ -321,13 +342,64 @@ static void _forward_resp_handler(const gcoap_request_memo_t *memo,
         coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
         _set_response_type(pdu, _cep_get_response_type(cep));
     }
-    else if (memo->state == GCOAP_MEMO_TIMEOUT) {
+    else if (state == GCOAP_MEMO_TIMEOUT) {
         /* send RST */
         gcoap_resp_init(pdu, (uint8_t *)pdu->hdr, buf_len, COAP_CODE_EMPTY);
         coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
     }
     /* don't use buf_len here, in case the above `gcoap_resp_init`s changed `pdu` */
     _dispatch_msg(pdu->hdr, coap_get_total_len(pdu), &cep->ep, &cep->proxy_ep);
+}
+
+#if IS_USED(MODULE_GCOAP_FORWARD_PROXY_COALESCE)
+static void _forward_resp_to_coalesced(client_ep_t *cep, const coap_pkt_t *pdu,
+                                       unsigned state)
+{
+    coap_pkt_t resp;
+    size_t hdr_len = coap_get_total_hdr_len(pdu);
+    size_t rest_len = 0;
+    ssize_t len;
+
+    /* only a proper response has options and payload worth copying, for
+     * all other states the client gets an error generated from the header */
+    if (state == GCOAP_MEMO_RESP) {
+        rest_len = coap_get_total_len(pdu) - hdr_len;
+    }
+    if ((rest_len + sizeof(coap_hdr_t) + cep->token_len) > sizeof(_coalesce_resp_buf)) {
+        DEBUG("gcoap_forward_proxy: response too large for coalesced client\n");
+        return;
+    }
+    len = coap_build_hdr((coap_hdr_t *)_coalesce_resp_buf, coap_get_type(pdu),
+                         cep->token, cep->token_len, coap_get_code_raw(pdu),
+                         ntohs(cep->mid));
+    memcpy(&_coalesce_resp_buf[len], (uint8_t *)pdu->hdr + hdr_len, rest_len);
+    if (coap_parse(&resp, _coalesce_resp_buf, len + rest_len) < 0) {
+        DEBUG("gcoap_forward_proxy: unable to parse coalesced response\n");
+        return;
+    }
+    _forward_resp_to_client(cep, &resp, sizeof(_coalesce_resp_buf), state);
+}
+#endif
+
+static void _forward_resp_handler(const gcoap_request_memo_t *memo,
+                                  coap_pkt_t* pdu,
+                                  const sock_udp_ep_t *remote)
+{
+    (void) remote; /* this is the origin server */
+    client_ep_t *cep = (client_ep_t *)memo->context;
+
+    assert(memo->state == GCOAP_MEMO_RESP ||
+           memo->state == GCOAP_MEMO_RESP_TRUNC ||
+           memo->state == GCOAP_MEMO_TIMEOUT);
+#if IS_USED(MODULE_GCOAP_FORWARD_PROXY_COALESCE)
+    /* serve coalesced clients first, as answering cep modifies pdu in-place */
+    mutex_lock(&_client_eps_lock);
+    for (client_ep_t *follower = cep->next; follower; follower = follower->next) {
+        _forward_resp_to_coalesced(follower, pdu, memo->state);
+    }
+    mutex_unlock(&_client_eps_lock);
+#endif
+    _forward_resp_to_client(cep, pdu, coap_get_total_len(pdu), memo->state);
     _free_client_ep(cep);
 }
 
@@ -427,6 +499,76 @@ int gcoap_forward_proxy_req_send(client_ep_t *cep)
     return len;
 }
 
+#if IS_USED(MODULE_GCOAP_FORWARD_PROXY_COALESCE)
+/**
+ * @brief   Attach a client to an outstanding upstream request for the same
+ *          resource, if there is one
+ *
+ * @param[in]       client_pkt  request of the client
+ * @param[in,out]   cep         client endpoint for @p client_pkt
+ *
+ * @return  1 if @p cep was attached to an outstanding upstream request
+ * @return  0 if @p client_pkt needs to be forwarded upstream
+ * @return  -EALREADY if @p client_pkt was already attached before, e.g.,
+ *          because it is a retransmission
+ */
+static int _coalesce_client_ep(coap_pkt_t *client_pkt, client_ep_t *cep)
+{
+    unsigned token_len = coap_get_token_len(client_pkt);
+    unsigned method = coap_get_code_raw(client_pkt);
+
+    /* only requests that are safe to answer with a shared response are
+     * coalesced, Observe registrations need their own upstream state */
+    if (((method != COAP_METHOD_GET) && (method != COAP_METHOD_FETCH)) ||
+        coap_has_observe(client_pkt) || (token_len > sizeof(cep->token))) {
+        return 0;
+    }
+
+    /* the full digest is generated, but only its prefix is kept, as is done
+     * for the cache key in gcoap's request memos */
+    uint8_t cache_key[SHA256_DIGEST_LENGTH];
+    nanocoap_cache_key_generate(client_pkt, cache_key);
+    memcpy(cep->cache_key, cache_key, sizeof(cep->cache_key));
+    mutex_lock(&_client_eps_lock);
+    for (client_ep_t *head = _client_eps;
+         head < (_client_eps + CONFIG_GCOAP_REQ_WAITING_MAX);
+         head++) {
+        if ((head == cep) || !(head->flags & CLIENT_EP_FLAGS_COALESCE_HEAD) ||
+            nanocoap_cache_key_compare(head->cache_key, cep->cache_key)) {
+            continue;
+        }
+        for (client_ep_t *follower = head->next; follower; follower = follower->next) {
+            if ((follower->token_len == token_len) &&
+                (memcmp(follower->token, coap_get_token(client_pkt), token_len) == 0) &&
+                sock_udp_ep_equal(&follower->ep, &cep->ep)) {
+                mutex_unlock(&_client_eps_lock);
+                return -EALREADY;
+            }
+        }
+        memcpy(cep->token, coap_get_token(client_pkt), token_len);
+        cep->token_len = token_len;
+#if IS_USED(MODULE_NANOCOAP_CACHE)
+        /* the request is not copied upstream, so keep its ETag here to
+         * answer with 2.03 Valid if it matches the shared response */
+        uint8_t *etag;
+        ssize_t etag_len = coap_opt_get_opaque(client_pkt, COAP_OPT_ETAG, &etag);
+        if (etag_len > 0) {
+            _cep_set_req_etag(cep, etag, etag_len);
+        }
+#endif
+        cep->next = head->next;
+        head->next = cep;
+        mutex_unlock(&_client_eps_lock);
+        DEBUG("gcoap_forward_proxy: coalesced %p onto %p\n", (void *)cep, (void *)head);
+        return 1;
+    }
+    /* first of its kind, later duplicates may attach to this one */
+    cep->flags |= CLIENT_EP_FLAGS_COALESCE_HEAD;
+    mutex_unlock(&_client_eps_lock);
+    return 0;
+}
+#endif
+
 static int _gcoap_forward_proxy_via_coap(coap_pkt_t *client_pkt,
                                          client_ep_t *client_ep,
                                          uri_parser_result_t *urip)
@@ -454,6 +596,18 @@ static int _gcoap_forward_proxy_via_coap(coap_pkt_t *client_pkt,
                          CONFIG_GCOAP_FORWARD_PROXY_EMPTY_ACK_MS, _send_empty_ack);
     }
 
+#if IS_USED(MODULE_GCOAP_FORWARD_PROXY_COALESCE)
+    int res = _coalesce_client_ep(client_pkt, client_ep);
+    if (res != 0) {
+        if (res < 0) {
+            DEBUG("gcoap_forward_proxy: request already coalesced, ignore!\n");
+            _free_client_ep(client_ep);
+        }
+        /* client is answered along with the outstanding upstream request */
+        return 0;
+    }
+#endif
+
     unsigned token_len = coap_get_token_len(client_pkt);
 
     coap_pkt_init(&client_ep->pdu, proxy_req_buf, CONFIG_GCOAP_PDU_BUF_SIZE,
@@ -25,6 +25,7 @@
 #include <stdint.h>
 #include "net/coap.h"
 #include "net/gcoap.h"
+#include "net/nanocoap/cache.h"
 #include "net/sock/udp.h"
 #include "ztimer.h"
 #include "event.h"
@@ -36,7 +37,7 @@ extern "C" {
 /**
  * @brief   client ep structure
  */
-typedef struct {
+typedef struct client_ep {
     coap_pkt_t pdu;                         /**< forward CoAP PDU */
     sock_udp_ep_t server_ep;                /**< forward Server endpoint */
     sock_udp_ep_t ep;                       /**< client endpoint */
@@ -48,6 +49,22 @@ typedef struct {
 #endif
     ztimer_t empty_ack_timer;               /**< empty ACK timer */
     event_t event;                          /**< client event */
+#if IS_USED(MODULE_GCOAP_FORWARD_PROXY_COALESCE) || defined(DOXYGEN)
+    /**
+     * @brief   cache key of the request, used to match concurrent duplicates
+     */
+    uint8_t cache_key[CONFIG_NANOCOAP_CACHE_KEY_LENGTH];
+    /**
+     * @brief   next client waiting for the same upstream response
+     *
+     * For the client that triggered the upstream exchange this is the head
+     * of the list of coalesced clients, for coalesced clients it links to
+     * the next one in that list.
+     */
+    struct client_ep *next;
+    uint8_t token[COAP_TOKEN_LENGTH_MAX];   /**< token of a coalesced request */
+    uint8_t token_len;                      /**< length of client_ep_t::token */
+#endif
 } client_ep_t;
 
 /**
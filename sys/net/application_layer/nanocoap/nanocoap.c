@@ -202,16 +202,25 @@ int coap_match_path(const coap_resource_t *resource, const uint8_t *uri)
 
 uint8_t *coap_find_option(coap_pkt_t *pkt, unsigned opt_num)
 {
-    const coap_optpos_t *optpos = pkt->options;
-    unsigned opt_count = pkt->options_len;
-
-    while (opt_count--) {
-        if (optpos->opt_num == opt_num) {
-            unsigned idx = index_of(pkt->options, optpos);
-            bf_unset(pkt->opt_crit, idx);
-            return (uint8_t*)pkt->hdr + optpos->offset;
+    /* Options are recorded in ascending order of their number, both by
+     * coap_parse() and when adding options to a packet, so bisect for the
+     * first entry with a matching number */
+    unsigned lo = 0;
+    unsigned hi = pkt->options_len;
+
+    while (lo < hi) {
+        unsigned mid = (lo + hi) / 2;
+        if (pkt->options[mid].opt_num < opt_num) {
+            lo = mid + 1;
         }
-        optpos++;
+        else {
+            hi = mid;
+        }
+    }
+
+    if ((lo < pkt->options_len) && (pkt->options[lo].opt_num == opt_num)) {
+        bf_unset(pkt->opt_crit, lo);
+        return (uint8_t*)pkt->hdr + pkt->options[lo].offset;
     }
     return NULL;
 }
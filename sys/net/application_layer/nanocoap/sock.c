@@ -25,6 +25,7 @@
 #include <string.h>
 #include <stdio.h>
 
+#include "byteorder.h"
 #include "container.h"
 #include "event/thread.h"
 #include "net/credman.h"
@@ -73,6 +74,28 @@ typedef struct {
 #endif
 } _block_ctx_t;
 
+enum {
+    BLOCK_SLOT_FREE,        /**< slot is unused */
+    BLOCK_SLOT_WAIT,        /**< request was sent, waiting for response */
+    BLOCK_SLOT_SEPARATE,    /**< empty ACK received, waiting for separate response */
+    BLOCK_SLOT_DONE,        /**< response was buffered, waiting for in-order delivery */
+};
+
+/**
+ * @brief   State of a single outstanding request of a pipelined block-wise GET
+ */
+typedef struct {
+    uint32_t blknum;        /**< number of the requested block */
+    uint32_t timeout;       /**< current retransmission timeout in µs */
+    uint32_t deadline;      /**< deadline of the current transmission in µs */
+    int err;                /**< error response of a buffered block */
+    uint16_t id;            /**< message ID of the request */
+    uint16_t len;           /**< payload length of a buffered block */
+    uint8_t state;          /**< state of the slot */
+    uint8_t tries_left;     /**< transmissions left */
+    bool more;              /**< more flag of a buffered block */
+} _block_slot_t;
+
 /**
  * @brief   Structure to track the state of an observation
  */
@@ -792,14 +815,31 @@ static int _block_cb(void *arg, coap_pkt_t *pkt)
     return ctx->callback(ctx->arg, block2.offset, pkt->payload, pkt->payload_len, block2.more);
 }
 
+static void _build_block_req(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                             const char *path, coap_blksize_t blksize, uint32_t blknum,
+                             const void *token, size_t token_len, uint16_t id)
+{
+    uint16_t lastonum = 0;
+
+    pkt->hdr = (void *)buf;
+    pkt->snips = NULL;
+
+    buf += coap_build_hdr(pkt->hdr, COAP_TYPE_CON, token, token_len, COAP_METHOD_GET, id);
+    buf += coap_opt_put_uri_pathquery(buf, &lastonum, path);
+    buf += coap_opt_put_uint(buf, lastonum, COAP_OPT_BLOCK2, (blknum << 4) | blksize);
+
+    (void)len;
+    assert((uintptr_t)buf - (uintptr_t)pkt->hdr < len);
+
+    pkt->payload = buf;
+    pkt->payload_len = 0;
+}
+
 static int _fetch_block(nanocoap_sock_t *sock, uint8_t *buf, size_t len,
                         const char *path, coap_blksize_t blksize,
                         _block_ctx_t *ctx)
 {
-    coap_pkt_t pkt = {
-        .hdr = (void *)buf,
-    };
-    uint16_t lastonum = 0;
+    coap_pkt_t pkt;
 
     void *token = NULL;
     size_t token_len = 0;
@@ -811,16 +851,8 @@ static int _fetch_block(nanocoap_sock_t *sock, uint8_t *buf, size_t len,
     token_len = sizeof(ctx->token);
 #endif
 
-    buf += coap_build_hdr(pkt.hdr, COAP_TYPE_CON, token, token_len, COAP_METHOD_GET,
-                          nanocoap_sock_next_msg_id(sock));
-    buf += coap_opt_put_uri_pathquery(buf, &lastonum, path);
-    buf += coap_opt_put_uint(buf, lastonum, COAP_OPT_BLOCK2, (ctx->blknum << 4) | blksize);
-
-    (void)len;
-    assert((uintptr_t)buf - (uintptr_t)pkt.hdr < len);
-
-    pkt.payload = buf;
-    pkt.payload_len = 0;
+    _build_block_req(&pkt, buf, len, path, blksize, ctx->blknum, token, token_len,
+                     nanocoap_sock_next_msg_id(sock));
 
     return nanocoap_sock_request_cb(sock, &pkt, _block_cb, ctx);
 }
@@ -872,9 +904,9 @@ int nanocoap_sock_block_request(coap_block_request_t *req,
     return len;
 }
 
-int nanocoap_sock_get_blockwise(nanocoap_sock_t *sock, const char *path,
-                                coap_blksize_t blksize,
-                                coap_blockwise_cb_t callback, void *arg)
+static int _get_blockwise(nanocoap_sock_t *sock, const char *path,
+                          coap_blksize_t blksize,
+                          coap_blockwise_cb_t callback, void *arg)
 {
     _block_ctx_t ctx = {
         .callback = callback,
@@ -909,6 +941,299 @@ int nanocoap_sock_get_blockwise(nanocoap_sock_t *sock, const char *path,
     return 0;
 }
 
+int nanocoap_sock_get_blockwise(nanocoap_sock_t *sock, const char *path,
+                                coap_blksize_t blksize,
+                                coap_blockwise_cb_t callback, void *arg)
+{
+#if CONFIG_NANOCOAP_SOCK_BLOCKWISE_WINDOW > 1
+    if (blksize <= CONFIG_NANOCOAP_BLOCKSIZE_DEFAULT) {
+        uint8_t work_buf[(CONFIG_NANOCOAP_SOCK_BLOCKWISE_WINDOW - 1)
+                         << (CONFIG_NANOCOAP_BLOCKSIZE_DEFAULT + 4)];
+
+        return nanocoap_sock_get_blockwise_window(sock, path, blksize,
+                                                  work_buf, sizeof(work_buf),
+                                                  callback, arg);
+    }
+#endif
+    return _get_blockwise(sock, path, blksize, callback, arg);
+}
+
+static int _send_block_slot(nanocoap_sock_t *sock, const char *path,
+                            coap_blksize_t blksize, uint32_t token_base,
+                            _block_slot_t *slot)
+{
+    coap_pkt_t pkt;
+    /* every block gets its own token, so separate responses can be mapped
+     * to the request they belong to */
+    network_uint32_t token = byteorder_htonl(token_base + slot->blknum);
+
+    _build_block_req(&pkt, sock->hdr_buf, sizeof(sock->hdr_buf), path, blksize,
+                     slot->blknum, &token, sizeof(token), slot->id);
+
+    const iolist_t snip = {
+        .iol_base = pkt.hdr,
+        .iol_len  = coap_get_total_len(&pkt),
+    };
+
+    DEBUG("nanocoap: request block %"PRIu32" (%u tries left)\n",
+          slot->blknum, slot->tries_left - 1);
+
+    --slot->tries_left;
+    slot->deadline = _deadline_from_interval(slot->timeout);
+    return _sock_sendv(sock, &snip);
+}
+
+static _block_slot_t *_find_block_slot(_block_slot_t *slots, unsigned numof,
+                                       const coap_pkt_t *pkt, uint32_t token_base)
+{
+    network_uint32_t token;
+
+    if (coap_get_token_len(pkt) != sizeof(token)) {
+        return NULL;
+    }
+    memcpy(&token, coap_get_token(pkt), sizeof(token));
+
+    uint32_t blknum = byteorder_ntohl(token) - token_base;
+    for (unsigned i = 0; i < numof; i++) {
+        if (((slots[i].state == BLOCK_SLOT_WAIT) || (slots[i].state == BLOCK_SLOT_SEPARATE)) &&
+            (slots[i].blknum == blknum)) {
+            /* for piggybacked responses, the message ID has to match as well */
+            if ((coap_get_type(pkt) == COAP_TYPE_ACK) && (coap_get_id(pkt) != slots[i].id)) {
+                return NULL;
+            }
+            return &slots[i];
+        }
+    }
+
+    return NULL;
+}
+
+static _block_slot_t *_find_buffered_block(_block_slot_t *slots, unsigned numof,
+                                           uint32_t blknum)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        if ((slots[i].state == BLOCK_SLOT_DONE) && (slots[i].blknum == blknum)) {
+            return &slots[i];
+        }
+    }
+
+    return NULL;
+}
+
+int nanocoap_sock_get_blockwise_window(nanocoap_sock_t *sock, const char *path,
+                                       coap_blksize_t blksize,
+                                       void *work_buf, size_t work_buf_len,
+                                       coap_blockwise_cb_t callback, void *arg)
+{
+    _block_slot_t slots[CONFIG_NANOCOAP_SOCK_BLOCKWISE_WINDOW];
+    unsigned window = MIN(work_buf_len / coap_szx2size(blksize) + 1, ARRAY_SIZE(slots));
+
+    if (window < 2) {
+        return _get_blockwise(sock, path, blksize, callback, arg);
+    }
+
+    uint8_t *reorder_buf = work_buf;
+    uint32_t token_base = random_uint32();
+    uint32_t next_deliver = 0;
+    uint32_t next_request = 0;
+    /* number of the last block, unknown until a response without the more
+     * flag or with a Size2 option arrived */
+    uint32_t last = UINT32_MAX;
+    /* only request the first block until the server has chosen a block size */
+    unsigned slots_used = 1;
+    int res = 0;
+
+    memset(slots, 0, sizeof(slots));
+
+    /* clear out stale responses from previous requests */
+    _sock_flush(sock);
+
+    while (next_deliver <= last) {
+        uint32_t wait_us = UINT32_MAX;
+
+        /* keep the window filled and (re)transmit requests that timed out */
+        for (unsigned i = 0; i < slots_used; i++) {
+            _block_slot_t *slot = &slots[i];
+
+            if ((slot->state == BLOCK_SLOT_FREE) && (next_request <= last)) {
+                slot->blknum = next_request++;
+                slot->id = nanocoap_sock_next_msg_id(sock);
+                slot->timeout = random_uint32_range(
+                    (uint32_t)CONFIG_COAP_ACK_TIMEOUT_MS * US_PER_MS,
+                    (uint32_t)CONFIG_COAP_ACK_TIMEOUT_MS * CONFIG_COAP_RANDOM_FACTOR_1000);
+                slot->tries_left = CONFIG_COAP_MAX_RETRANSMIT + 1;
+                slot->state = BLOCK_SLOT_WAIT;
+                res = _send_block_slot(sock, path, blksize, token_base, slot);
+            }
+            else if ((slot->state == BLOCK_SLOT_WAIT) || (slot->state == BLOCK_SLOT_SEPARATE)) {
+                if (_deadline_left_us(slot->deadline) > 0) {
+                    wait_us = MIN(wait_us, _deadline_left_us(slot->deadline));
+                    continue;
+                }
+                if (slot->tries_left == 0) {
+                    DEBUG("nanocoap: maximum retries reached for block %"PRIu32"\n",
+                          slot->blknum);
+                    return -ETIMEDOUT;
+                }
+                slot->timeout *= 2;
+                res = _send_block_slot(sock, path, blksize, token_base, slot);
+            }
+            else {
+                continue;
+            }
+            if (res <= 0) {
+                DEBUG("nanocoap: error sending block request, %d\n", res);
+                return res ? res : -EIO;
+            }
+            wait_us = MIN(wait_us, slot->timeout);
+        }
+
+        void *payload, *ctx = NULL;
+        ssize_t len = _sock_recv_buf(sock, &payload, &ctx, wait_us);
+        if (len == -ETIMEDOUT) {
+            continue;
+        }
+        if (len < 0) {
+            DEBUG("nanocoap: error receiving CoAP response, %" PRIdSIZE "\n", len);
+            return len;
+        }
+
+        coap_pkt_t pkt;
+        _block_slot_t *slot = NULL;
+        res = 0;
+
+        if ((len == 0) || (coap_parse(&pkt, payload, len) < 0)) {
+            goto release;
+        }
+        if (coap_get_code_raw(&pkt) == COAP_CODE_EMPTY) {
+            /* empty ACK or RST, match by message ID */
+            for (unsigned i = 0; i < slots_used; i++) {
+                if (((slots[i].state == BLOCK_SLOT_WAIT) ||
+                     (slots[i].state == BLOCK_SLOT_SEPARATE)) &&
+                    (slots[i].id == coap_get_id(&pkt))) {
+                    slot = &slots[i];
+                    break;
+                }
+            }
+            if (slot == NULL) {
+                goto release;
+            }
+            if (coap_get_type(&pkt) == COAP_TYPE_RST) {
+                res = -EBADMSG;
+            }
+            else if (coap_get_type(&pkt) == COAP_TYPE_ACK) {
+                /* wait for separate response, stop retransmissions */
+                slot->state = BLOCK_SLOT_SEPARATE;
+                slot->tries_left = 0;
+                slot->deadline = _deadline_from_interval(CONFIG_COAP_SEPARATE_RESPONSE_TIMEOUT_MS
+                                                         * US_PER_MS);
+            }
+            goto release;
+        }
+
+        slot = _find_block_slot(slots, slots_used, &pkt, token_base);
+        if (slot == NULL) {
+            DEBUG("nanocoap: ignore unexpected or duplicate response\n");
+            goto release;
+        }
+        if (coap_get_type(&pkt) == COAP_TYPE_CON) {
+            _send_ack(sock, &pkt);
+        }
+
+        coap_block1_t block2;
+        int err = _get_error(&pkt);
+        bool blockwise = !err && coap_get_block2(&pkt, &block2);
+
+        if (!err && !blockwise) {
+            /* response was not block-wise, it holds the whole resource no
+             * matter the block size we asked for */
+            block2.blknum = 0;
+            block2.szx = blksize;
+            block2.more = false;
+        }
+        if (!err && (slot->blknum == 0) && (block2.blknum == 0)) {
+            uint32_t size2;
+
+            /* the server may choose a smaller block size with the first block */
+            if (block2.szx < blksize) {
+                blksize = block2.szx;
+            }
+            if (block2.more && (coap_opt_get_uint(&pkt, COAP_OPT_SIZE2, &size2) == 0) &&
+                (size2 > 0)) {
+                last = (size2 - 1) >> (blksize + 4);
+            }
+            slots_used = window;
+        }
+        if (!err && ((block2.blknum != slot->blknum) ||
+                     (blockwise && (pkt.payload_len > coap_szx2size(blksize))))) {
+            DEBUG("nanocoap: unexpected block %"PRIu32", want %"PRIu32"\n",
+                  block2.blknum, slot->blknum);
+            /* let the request time out and be retransmitted */
+            goto release;
+        }
+        if (!err && block2.more && (slot->blknum >= last)) {
+            /* Size2 understated the size, the end is unknown again */
+            last = UINT32_MAX;
+        }
+        if (!err && !block2.more && (slot->blknum < last)) {
+            last = slot->blknum;
+            /* drop requests for blocks past the end */
+            for (unsigned i = 0; i < slots_used; i++) {
+                if (slots[i].blknum > last) {
+                    slots[i].state = BLOCK_SLOT_FREE;
+                }
+            }
+        }
+
+        if (slot->blknum != next_deliver) {
+            /* buffer out-of-order block, blocks in flight are never more than
+             * window - 1 apart from the next one to deliver */
+            uint8_t *dst = reorder_buf + (slot->blknum % (window - 1)) * coap_szx2size(blksize);
+            if (!err) {
+                memcpy(dst, pkt.payload, pkt.payload_len);
+                slot->len = pkt.payload_len;
+                slot->more = block2.more;
+            }
+            slot->err = err;
+            slot->state = BLOCK_SLOT_DONE;
+            goto release;
+        }
+
+        slot->state = BLOCK_SLOT_FREE;
+        res = err;
+        if (!res) {
+            res = callback(arg, slot->blknum << (blksize + 4), pkt.payload,
+                           pkt.payload_len, block2.more);
+        }
+        ++next_deliver;
+
+        /* deliver blocks that were received out of order */
+        while ((res >= 0) && (next_deliver <= last) &&
+               (slot = _find_buffered_block(slots, slots_used, next_deliver))) {
+            slot->state = BLOCK_SLOT_FREE;
+            res = slot->err;
+            if (!res) {
+                res = callback(arg, slot->blknum << (blksize + 4),
+                               reorder_buf + (slot->blknum % (window - 1))
+                                           * coap_szx2size(blksize),
+                               slot->len, slot->more);
+            }
+            ++next_deliver;
+        }
+
+release:
+        while (ctx) {
+            _sock_recv_buf(sock, &payload, &ctx, 0);
+        }
+        if (res < 0) {
+            DEBUG("nanocoap: error fetching block %"PRIu32": %d\n", next_deliver, res);
+            return res;
+        }
+    }
+
+    return 0;
+}
+
 typedef struct {
     uint8_t *ptr;
     size_t len;
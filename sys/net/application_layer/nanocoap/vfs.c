@@ -18,6 +18,7 @@
  * @}
  */
 
+#include <errno.h>
 #include <fcntl.h>
 #include "net/nanocoap_vfs.h"
 #include "net/sock/util.h"
@@ -93,6 +94,20 @@ int nanocoap_vfs_get_url(const char *url, const char *dst)
     return _finalize_file(fd, res, dst, dst_tmp);
 }
 
+/* Read from the file, without copying to @p buffer if the file system can
+ * provide the contents directly */
+static int _read(int fd, const void **data, void *buffer, size_t len)
+{
+    int res = vfs_read_ptr(fd, data, len);
+
+    if (res == -ENOTSUP) {
+        *data = buffer;
+        res = vfs_read(fd, buffer, len);
+    }
+
+    return res;
+}
+
 static int _vfs_put(coap_block_request_t *ctx, const char *file, void *buffer)
 {
     int res, fd = vfs_open(file, O_RDONLY, 0644);
@@ -103,10 +118,11 @@ static int _vfs_put(coap_block_request_t *ctx, const char *file, void *buffer)
     /* buffer is at least one larger than SZX value */
     int buffer_len = coap_szx2size(ctx->blksize) + 1;
 
+    const void *data;
     bool more = true;
-    while (more && (res = vfs_read(fd, buffer, buffer_len)) > 0) {
+    while (more && (res = _read(fd, &data, buffer, buffer_len)) > 0) {
         more = res == buffer_len;
-        res = nanocoap_sock_block_request(ctx, buffer,
+        res = nanocoap_sock_block_request(ctx, data,
                                           res, more, NULL, NULL);
         if (res < 0) {
             break;
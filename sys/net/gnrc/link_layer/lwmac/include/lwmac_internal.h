@@ -80,6 +80,15 @@ extern "C" {
  */
 #define GNRC_LWMAC_QUIT_RX              (0x0040U)
 
+/**
+ * @brief   Flag to track if the wake-up interval was shortened in this cycle.
+ *
+ * With the `gnrc_lwmac_adaptive` module, the wake-up interval is halved at most
+ * once per wake-up, so that the WRs of a single burst don't jump to the
+ * shortest interval right away.
+ */
+#define GNRC_LWMAC_LEVEL_RAISED         (0x0080U)
+
 /**
  * @brief Type to pass information about parsing.
  */
@@ -364,7 +373,7 @@ static inline uint32_t _gnrc_lwmac_phase_now(void)
  */
 static inline uint32_t _gnrc_lwmac_ticks_until_phase(uint32_t phase)
 {
-    long int tmp = phase - _gnrc_lwmac_phase_now();
+    int32_t tmp = phase - _gnrc_lwmac_phase_now();
 
     if (tmp < 0) {
         /* Phase in next interval */
@@ -374,6 +383,88 @@ static inline uint32_t _gnrc_lwmac_ticks_until_phase(uint32_t phase)
     return (uint32_t)tmp;
 }
 
+/**
+ * @brief Get the start of the cycle the phase of the device refers to
+ *
+ * With the `gnrc_lwmac_adaptive` module, this is a wake-up of the base
+ * interval, which is a wake-up at every level as well.
+ *
+ * @param[in]   netif    ptr to the network interface
+ *
+ * @return               RTT ticks
+ */
+static inline uint32_t _gnrc_lwmac_cycle_start(gnrc_netif_t *netif)
+{
+#if IS_USED(MODULE_GNRC_LWMAC_ADAPTIVE)
+    return netif->mac.prot.lwmac.wakeup_anchor;
+#else
+    return netif->mac.prot.lwmac.last_wakeup;
+#endif
+}
+
+/**
+ * @brief Get the offset of a wake-up from the start of the base interval
+ *
+ * The offsets are rounded down, so the wake-ups at @p level include those at
+ * all lower levels, even if the base interval is not divisible by 2^level.
+ *
+ * @param[in]   level    wake-up interval level
+ * @param[in]   n        number of the wake-up
+ *
+ * @return               RTT ticks
+ */
+static inline uint32_t _gnrc_lwmac_wakeup_offset(unsigned level, uint32_t n)
+{
+    return ((uint64_t)n * RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US)) >> level;
+}
+
+/**
+ * @brief Calculate how many ticks remaining to the next wake-up of a neighbor
+ *
+ * @param[in]   neighbor    neighbor with known phase
+ * @param[in]   lead        minimum RTT ticks until the wake-up
+ *
+ * @return                  RTT ticks
+ */
+static inline uint32_t _gnrc_lwmac_ticks_until_wakeup(const gnrc_mac_tx_neighbor_t *neighbor,
+                                                      uint32_t lead)
+{
+    uint32_t interval = RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US);
+#if IS_USED(MODULE_GNRC_LWMAC_ADAPTIVE)
+    unsigned level = neighbor->wakeup_level;
+#else
+    unsigned level = 0;
+#endif
+    /* ticks since the last wake-up of the base interval */
+    uint32_t elapsed = (interval - _gnrc_lwmac_ticks_until_phase(neighbor->phase)) % interval;
+    uint32_t n = (((uint64_t)(elapsed + lead) << level) + interval - 1) / interval;
+
+    return _gnrc_lwmac_wakeup_offset(level, n) - elapsed;
+}
+
+#if IS_USED(MODULE_GNRC_LWMAC_ADAPTIVE) || defined(DOXYGEN)
+/**
+ * @brief Account a wake-up for adapting the wake-up interval
+ *
+ * Doubles the wake-up interval after @ref CONFIG_GNRC_LWMAC_ADAPTIVE_IDLE_CYCLES
+ * wake-ups without a WR.
+ *
+ * @param[in,out]   netif    ptr to the network interface
+ */
+void _gnrc_lwmac_adapt_wakeup(gnrc_netif_t *netif);
+
+/**
+ * @brief Account a WR for this device for adapting the wake-up interval
+ *
+ * Halves the wake-up interval if the sender reports at least
+ * @ref CONFIG_GNRC_LWMAC_ADAPTIVE_QUEUE_HIGH queued packets.
+ *
+ * @param[in,out]   netif       ptr to the network interface
+ * @param[in]       queue_len   packets the sender has queued for this device
+ */
+void _gnrc_lwmac_adapt_demand(gnrc_netif_t *netif, uint8_t queue_len);
+#endif
+
 /**
  * @brief Store the received packet to the dispatch buffer and remove possible
  *        duplicate packets.
@@ -241,7 +241,7 @@ static gnrc_mac_tx_neighbor_t *_next_tx_neighbor(gnrc_netif_t *netif)
             /* Unknown destinations are initialized with their phase at the end
              * of the local interval, so known destinations that still wakeup
              * in this interval will be preferred. */
-            uint32_t phase_check = _gnrc_lwmac_ticks_until_phase(netif->mac.tx.neighbors[i].phase);
+            uint32_t phase_check = _gnrc_lwmac_ticks_until_wakeup(&netif->mac.tx.neighbors[i], 0);
 
             if (phase_check <= phase_nearest) {
                 next = &(netif->mac.tx.neighbors[i]);
@@ -273,6 +273,26 @@ static uint32_t _next_inphase_event(uint32_t last, uint32_t interval)
     return last;
 }
 
+static uint32_t _next_wakeup(gnrc_netif_t *netif)
+{
+    uint32_t interval = RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US);
+#if IS_USED(MODULE_GNRC_LWMAC_ADAPTIVE)
+    gnrc_lwmac_t *lwmac = &netif->mac.prot.lwmac;
+    unsigned level = lwmac->wakeup_level;
+
+    /* Last wake-up of the base interval before the next possible wake-up */
+    lwmac->wakeup_anchor = _next_inphase_event(lwmac->wakeup_anchor, interval) - interval;
+
+    uint32_t elapsed = rtt_get_counter() + GNRC_LWMAC_RTT_EVENT_MARGIN_TICKS -
+                       lwmac->wakeup_anchor;
+    uint32_t n = (((uint64_t)elapsed << level) + interval - 1) / interval;
+
+    return lwmac->wakeup_anchor + _gnrc_lwmac_wakeup_offset(level, n);
+#else
+    return _next_inphase_event(netif->mac.prot.lwmac.last_wakeup, interval);
+#endif
+}
+
 inline void lwmac_schedule_update(gnrc_netif_t *netif)
 {
     gnrc_lwmac_set_reschedule(netif, true);
@@ -335,8 +355,10 @@ void lwmac_set_state(gnrc_netif_t *netif, gnrc_lwmac_state_t newstate)
                 LOG_WARNING("WARNING: [LWMAC] phase backoffed: %lu us\n",
                             (unsigned long)RTT_TICKS_TO_US(alarm));
                 netif->mac.prot.lwmac.last_wakeup = netif->mac.prot.lwmac.last_wakeup + alarm;
-                alarm = _next_inphase_event(netif->mac.prot.lwmac.last_wakeup,
-                            RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US));
+#if IS_USED(MODULE_GNRC_LWMAC_ADAPTIVE)
+                netif->mac.prot.lwmac.wakeup_anchor += alarm;
+#endif
+                alarm = _next_wakeup(netif);
                 rtt_set_alarm(alarm, rtt_cb, (void *) GNRC_LWMAC_EVENT_RTT_WAKEUP_PENDING);
             }
 
@@ -407,6 +429,10 @@ static void _sleep_management(gnrc_netif_t *netif)
                 return;
             }
             neighbour = _next_tx_neighbor(netif);
+#if (GNRC_MAC_ENABLE_DUTYCYCLE_RECORD == 1)
+            /* The MAC delay of a packet includes waiting for the receiver */
+            netif->mac.prot.lwmac.pkt_start_sending_time_ticks = rtt_get_counter();
+#endif
         }
 
         if (neighbour != NULL) {
@@ -420,14 +446,12 @@ static void _sleep_management(gnrc_netif_t *netif)
             }
 
             /* Offset in microseconds when the earliest (phase) destination
-             * node wakes up that we have packets for. */
-            uint32_t time_until_tx = RTT_TICKS_TO_US(_gnrc_lwmac_ticks_until_phase(neighbour->phase));
+             * node wakes up that we have packets for. If there's not enough
+             * time to prepare a WR to catch the phase, postpone to its next
+             * wake-up. */
+            uint32_t time_until_tx = RTT_TICKS_TO_US(_gnrc_lwmac_ticks_until_wakeup(
+                neighbour, RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WR_PREPARATION_US) + 1));
 
-            /* If there's not enough time to prepare a WR to catch the phase
-             * postpone to next interval */
-            if (time_until_tx < CONFIG_GNRC_LWMAC_WR_PREPARATION_US) {
-                time_until_tx += CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US;
-            }
             time_until_tx -= CONFIG_GNRC_LWMAC_WR_PREPARATION_US;
 
             /* add a random time before goto TX, for avoiding one node for
@@ -470,7 +494,11 @@ static void _rx_management_attempt_sleep(gnrc_netif_t *netif)
         phase = phase - netif->mac.prot.lwmac.last_wakeup;
     }
     /* If the relative phase is beyond 4/5 cycle time, go to sleep. */
-    if (phase > (4 * RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US) / 5)) {
+    uint32_t interval = RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US);
+#if IS_USED(MODULE_GNRC_LWMAC_ADAPTIVE)
+    interval >>= netif->mac.prot.lwmac.wakeup_level;
+#endif
+    if (phase > (4 * interval / 5)) {
         gnrc_lwmac_set_quit_rx(netif, true);
     }
 
@@ -727,13 +755,15 @@ void rtt_handler(uint32_t event, gnrc_netif_t *netif)
             gnrc_lwmac_set_quit_rx(netif, false);
             gnrc_lwmac_set_phase_backoff(netif, false);
             netif->mac.rx.rx_bad_exten_count = 0;
+#if IS_USED(MODULE_GNRC_LWMAC_ADAPTIVE)
+            _gnrc_lwmac_adapt_wakeup(netif);
+#endif
             lwmac_set_state(netif, GNRC_LWMAC_LISTENING);
             break;
         }
         case GNRC_LWMAC_EVENT_RTT_SLEEP_PENDING: {
             /* Set next wake-up timing. */
-            alarm = _next_inphase_event(netif->mac.prot.lwmac.last_wakeup,
-                                        RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US));
+            alarm = _next_wakeup(netif);
             rtt_set_alarm(alarm, rtt_cb, (void *) GNRC_LWMAC_EVENT_RTT_WAKEUP_PENDING);
             lwmac_set_state(netif, GNRC_LWMAC_SLEEPING);
             break;
@@ -757,8 +787,7 @@ void rtt_handler(uint32_t event, gnrc_netif_t *netif)
         case GNRC_LWMAC_EVENT_RTT_RESUME: {
             LOG_DEBUG("[LWMAC] RTT: Resume duty cycling\n");
             rtt_clear_alarm();
-            alarm = _next_inphase_event(netif->mac.prot.lwmac.last_wakeup,
-                                        RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US));
+            alarm = _next_wakeup(netif);
             rtt_set_alarm(alarm, rtt_cb, (void *) GNRC_LWMAC_EVENT_RTT_WAKEUP_PENDING);
             gnrc_lwmac_set_dutycycle_active(netif, true);
             break;
@@ -899,6 +928,23 @@ static void _lwmac_msg_handler(gnrc_netif_t *netif, msg_t *msg)
             duty = ((uint64_t) netif->mac.prot.lwmac.awake_duration_sum_ticks) * 100 /
                    (duty - (uint64_t)netif->mac.prot.lwmac.system_start_time_ticks);
             printf("[LWMAC]: achieved radio duty-cycle: %u %% \n", (unsigned) duty);
+
+            /* Output radio-on time and the MAC delay of sent packets */
+            gnrc_lwmac_t *lwmac = &netif->mac.prot.lwmac;
+            uint32_t awake = lwmac->awake_duration_sum_ticks;
+            if (lwmac->lwmac_info & GNRC_LWMAC_RADIO_IS_ON) {
+                awake += rtt_get_counter() - lwmac->last_radio_on_time_ticks;
+            }
+            uint32_t avg = (lwmac->tx_count) ? lwmac->tx_delay_sum_ticks / lwmac->tx_count : 0;
+            printf("[LWMAC]: radio on: %lu ms, sent: %lu, MAC delay avg: %lu us, max: %lu us\n",
+                   (unsigned long)RTT_TICKS_TO_MS(awake), (unsigned long)lwmac->tx_count,
+                   (unsigned long)RTT_TICKS_TO_US(avg),
+                   (unsigned long)RTT_TICKS_TO_US(lwmac->tx_delay_max_ticks));
+#if IS_USED(MODULE_GNRC_LWMAC_ADAPTIVE)
+            printf("[LWMAC]: wake-up interval: %lu us (level %u)\n",
+                   (unsigned long)(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US >> lwmac->wakeup_level),
+                   lwmac->wakeup_level);
+#endif
             break;
         }
 #endif
@@ -952,6 +998,9 @@ static int _lwmac_init(gnrc_netif_t *netif)
      * to board */
     netif->mac.tx.bcast_seqnr = netif->l2addr[0];
 
+    /* Software CSMA/CA needs a sane backoff configuration */
+    netif->mac.csma_conf = CSMA_SENDER_CONF_DEFAULT;
+
     /* Reset all timeouts just to be sure */
     gnrc_lwmac_reset_timeouts(netif);
 
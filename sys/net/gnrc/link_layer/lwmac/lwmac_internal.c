@@ -25,6 +25,7 @@
 #include "periph/rtt.h"
 #include "net/gnrc.h"
 #include "net/gnrc/mac/mac.h"
+#include "net/gnrc/mac/internal.h"
 #include "net/gnrc/lwmac/lwmac.h"
 #include "include/lwmac_internal.h"
 #include "net/gnrc/netif/ieee802154.h"
@@ -52,6 +53,7 @@ int _gnrc_lwmac_transmit(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     }
     if (pkt->type != GNRC_NETTYPE_NETIF) {
         DEBUG("_send_ieee802154: first header is not generic netif header\n");
+        gnrc_pktbuf_release(pkt);
         return -EBADMSG;
     }
     netif_hdr = pkt->data;
@@ -78,6 +80,7 @@ int _gnrc_lwmac_transmit(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
                                         dst, dst_len, dev_pan,
                                         dev_pan, flags, state->seq++)) == 0) {
         DEBUG("_send_ieee802154: Error preperaring frame\n");
+        gnrc_pktbuf_release(pkt);
         return -EINVAL;
     }
 
@@ -97,6 +100,10 @@ int _gnrc_lwmac_transmit(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         netif->stats.tx_unicast_count++;
     }
 #endif
+    /* Not every driver reports NETDEV_EVENT_TX_STARTED, don't take the
+     * feedback of the previous frame for this one */
+    gnrc_netif_set_tx_feedback(netif, TX_FEEDBACK_UNDEF);
+
 #ifdef MODULE_GNRC_MAC
     if (netif->mac.mac_info & GNRC_NETIF_MAC_INFO_CSMA_ENABLED) {
         res = csma_sender_csma_ca_send(dev, &iolist, &netif->mac.csma_conf);
@@ -113,8 +120,39 @@ int _gnrc_lwmac_transmit(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     return res;
 }
 
+static gnrc_pktsnip_t *_mark_lwmac_hdr(gnrc_pktsnip_t *pkt)
+{
+    gnrc_lwmac_hdr_t *lwmac_hdr;
+
+    /* Frames without payload can't carry a LWMAC header */
+    if (pkt->size < sizeof(gnrc_lwmac_hdr_t)) {
+        return NULL;
+    }
+
+    /* Dissect LWMAC header, Every frame has header as first member */
+    lwmac_hdr = (gnrc_lwmac_hdr_t *) pkt->data;
+    switch (lwmac_hdr->type) {
+        case GNRC_LWMAC_FRAMETYPE_WR:
+            return gnrc_pktbuf_mark(pkt, sizeof(gnrc_lwmac_frame_wr_t),
+                                    GNRC_NETTYPE_LWMAC);
+        case GNRC_LWMAC_FRAMETYPE_WA:
+            return gnrc_pktbuf_mark(pkt, sizeof(gnrc_lwmac_frame_wa_t),
+                                    GNRC_NETTYPE_LWMAC);
+        case GNRC_LWMAC_FRAMETYPE_DATA_PENDING:
+        case GNRC_LWMAC_FRAMETYPE_DATA:
+            return gnrc_pktbuf_mark(pkt, sizeof(gnrc_lwmac_frame_data_t),
+                                    GNRC_NETTYPE_LWMAC);
+        case GNRC_LWMAC_FRAMETYPE_BROADCAST:
+            return gnrc_pktbuf_mark(pkt, sizeof(gnrc_lwmac_frame_broadcast_t),
+                                    GNRC_NETTYPE_LWMAC);
+        default:
+            return NULL;
+    }
+}
+
 int _gnrc_lwmac_parse_packet(gnrc_pktsnip_t *pkt, gnrc_lwmac_packet_info_t *info)
 {
+    gnrc_pktsnip_t *netif_snip;
     gnrc_netif_hdr_t *netif_hdr;
     gnrc_pktsnip_t *lwmac_snip;
     gnrc_lwmac_hdr_t *lwmac_hdr;
@@ -122,38 +160,20 @@ int _gnrc_lwmac_parse_packet(gnrc_pktsnip_t *pkt, gnrc_lwmac_packet_info_t *info
     assert(info != NULL);
     assert(pkt != NULL);
 
-    netif_hdr = (gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF))->data;
-    if (netif_hdr == NULL) {
+    netif_snip = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+    if (netif_snip == NULL) {
         return -1;
     }
+    netif_hdr = netif_snip->data;
 
-    /* Dissect LWMAC header, Every frame has header as first member */
-    lwmac_hdr = (gnrc_lwmac_hdr_t *) pkt->data;
-    switch (lwmac_hdr->type) {
-        case GNRC_LWMAC_FRAMETYPE_WR: {
-            lwmac_snip = gnrc_pktbuf_mark(pkt, sizeof(gnrc_lwmac_frame_wr_t),
-                                          GNRC_NETTYPE_LWMAC);
-            break;
-        }
-        case GNRC_LWMAC_FRAMETYPE_WA: {
-            lwmac_snip = gnrc_pktbuf_mark(pkt, sizeof(gnrc_lwmac_frame_wa_t),
-                                          GNRC_NETTYPE_LWMAC);
-            break;
-        }
-        case GNRC_LWMAC_FRAMETYPE_DATA_PENDING:
-        case GNRC_LWMAC_FRAMETYPE_DATA: {
-            lwmac_snip = gnrc_pktbuf_mark(pkt, sizeof(gnrc_lwmac_frame_data_t),
-                                          GNRC_NETTYPE_LWMAC);
-            break;
-        }
-        case GNRC_LWMAC_FRAMETYPE_BROADCAST: {
-            lwmac_snip = gnrc_pktbuf_mark(pkt, sizeof(gnrc_lwmac_frame_broadcast_t),
-                                          GNRC_NETTYPE_LWMAC);
-            break;
-        }
-        default: {
-            return -2;
-        }
+    /* A WR may be pushed back into the RX queue after it was parsed, its
+     * header is already marked then */
+    lwmac_snip = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_LWMAC);
+    if (lwmac_snip == NULL) {
+        lwmac_snip = _mark_lwmac_hdr(pkt);
+    }
+    if (lwmac_snip == NULL) {
+        return -2;
     }
 
     /* Memory location may have changed while marking */
@@ -272,3 +292,35 @@ int _gnrc_lwmac_dispatch_defer(gnrc_pktsnip_t *buffer[], gnrc_pktsnip_t *pkt)
 
     return -1;
 }
+
+#if IS_USED(MODULE_GNRC_LWMAC_ADAPTIVE)
+void _gnrc_lwmac_adapt_wakeup(gnrc_netif_t *netif)
+{
+    gnrc_lwmac_t *lwmac = &netif->mac.prot.lwmac;
+
+    lwmac->lwmac_info &= ~GNRC_LWMAC_LEVEL_RAISED;
+
+    if ((lwmac->wakeup_level > 0) &&
+        (++lwmac->idle_wakeups >= CONFIG_GNRC_LWMAC_ADAPTIVE_IDLE_CYCLES)) {
+        lwmac->wakeup_level--;
+        lwmac->idle_wakeups = 0;
+        DEBUG("[LWMAC] Idle, wake-up level %u\n", lwmac->wakeup_level);
+    }
+}
+
+void _gnrc_lwmac_adapt_demand(gnrc_netif_t *netif, uint8_t queue_len)
+{
+    gnrc_lwmac_t *lwmac = &netif->mac.prot.lwmac;
+
+    lwmac->idle_wakeups = 0;
+
+    if ((queue_len >= CONFIG_GNRC_LWMAC_ADAPTIVE_QUEUE_HIGH) &&
+        (lwmac->wakeup_level < CONFIG_GNRC_LWMAC_ADAPTIVE_LEVEL_MAX) &&
+        !(lwmac->lwmac_info & GNRC_LWMAC_LEVEL_RAISED)) {
+        lwmac->wakeup_level++;
+        lwmac->lwmac_info |= GNRC_LWMAC_LEVEL_RAISED;
+        DEBUG("[LWMAC] %u packets pending, wake-up level %u\n",
+              queue_len, lwmac->wakeup_level);
+    }
+}
+#endif
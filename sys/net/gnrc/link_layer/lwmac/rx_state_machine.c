@@ -90,6 +90,10 @@ static uint8_t _packet_process_in_wait_for_wr(gnrc_netif_t *netif)
             continue;
         }
 
+#if IS_USED(MODULE_GNRC_LWMAC_ADAPTIVE)
+        uint8_t queue_len = ((gnrc_lwmac_frame_wr_t *)info.header)->queue_len;
+#endif
+
         /* No need to keep pkt anymore */
         gnrc_pktbuf_release(pkt);
 
@@ -106,6 +110,10 @@ static uint8_t _packet_process_in_wait_for_wr(gnrc_netif_t *netif)
         /* Save source address for later addressing */
         netif->mac.rx.l2_addr = info.src_addr;
 
+#if IS_USED(MODULE_GNRC_LWMAC_ADAPTIVE)
+        _gnrc_lwmac_adapt_demand(netif, queue_len);
+#endif
+
         rx_info |= GNRC_LWMAC_RX_FOUND_WR;
         break;
     }
@@ -136,19 +144,22 @@ static bool _send_wa(gnrc_netif_t *netif)
     lwmac_hdr.dst_addr = netif->mac.rx.l2_addr;
 
     uint32_t phase_now = _gnrc_lwmac_phase_now();
+    uint32_t cycle_start = _gnrc_lwmac_ticks_to_phase(_gnrc_lwmac_cycle_start(netif));
 
     /* Embed the current 'relative phase timing' (counted from the start of this cycle)
      * of the receiver into its WA packet, thus to allow the sender to infer the
      * receiver's exact wake-up timing */
-    if (phase_now > _gnrc_lwmac_ticks_to_phase(netif->mac.prot.lwmac.last_wakeup)) {
-        lwmac_hdr.current_phase = (phase_now -
-                                   _gnrc_lwmac_ticks_to_phase(netif->mac.prot.lwmac.last_wakeup));
+    if (phase_now > cycle_start) {
+        lwmac_hdr.current_phase = (phase_now - cycle_start);
     }
     else {
         lwmac_hdr.current_phase = (phase_now +
                                    RTT_US_TO_TICKS(CONFIG_GNRC_LWMAC_WAKEUP_INTERVAL_US)) -
-                                   _gnrc_lwmac_ticks_to_phase(netif->mac.prot.lwmac.last_wakeup);
+                                   cycle_start;
     }
+#if IS_USED(MODULE_GNRC_LWMAC_ADAPTIVE)
+    lwmac_hdr.wakeup_level = netif->mac.prot.lwmac.wakeup_level;
+#endif
 
     pkt = gnrc_pktbuf_add(NULL, &lwmac_hdr, sizeof(lwmac_hdr), GNRC_NETTYPE_LWMAC);
     if (pkt == NULL) {
@@ -186,7 +197,6 @@ static bool _send_wa(gnrc_netif_t *netif)
     /* Send WA */
     if (_gnrc_lwmac_transmit(netif, pkt) < 0) {
         LOG_ERROR("ERROR: [LWMAC-rx] Send WA failed.");
-        gnrc_pktbuf_release(pkt);
         gnrc_lwmac_set_quit_rx(netif, true);
         return false;
     }
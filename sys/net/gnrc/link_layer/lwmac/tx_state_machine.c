@@ -172,6 +172,13 @@ static uint8_t _send_wr(gnrc_netif_t *netif)
     memcpy(&(wr_hdr.dst_addr.addr), netif->mac.tx.current_neighbor->l2_addr,
            netif->mac.tx.current_neighbor->l2_addr_len);
     wr_hdr.dst_addr.len = netif->mac.tx.current_neighbor->l2_addr_len;
+#if IS_USED(MODULE_GNRC_LWMAC_ADAPTIVE)
+    /* let the receiver adapt its wake-up interval to our queue, including the
+     * packet in flight */
+    uint32_t queue_len =
+        gnrc_priority_pktqueue_length(&netif->mac.tx.current_neighbor->queue) + 1;
+    wr_hdr.queue_len = (queue_len > UINT8_MAX) ? UINT8_MAX : queue_len;
+#endif
 
     pkt = gnrc_pktbuf_add(NULL, &wr_hdr, sizeof(wr_hdr), GNRC_NETTYPE_LWMAC);
     if (pkt == NULL) {
@@ -219,7 +226,6 @@ static uint8_t _send_wr(gnrc_netif_t *netif)
     int res = _gnrc_lwmac_transmit(netif, pkt);
     if (res < 0) {
         LOG_ERROR("ERROR: [LWMAC-tx] Send WR failed.");
-        gnrc_pktbuf_release(pkt);
         tx_info |= GNRC_LWMAC_TX_FAIL;
         return tx_info;
     }
@@ -316,8 +322,12 @@ static uint8_t _packet_process_in_wait_for_wa(gnrc_netif_t *netif)
                 netif->mac.tx.timestamp -= wa_hdr->current_phase;
             }
 
+#if IS_USED(MODULE_GNRC_LWMAC_ADAPTIVE)
+            netif->mac.tx.current_neighbor->wakeup_level = wa_hdr->wakeup_level;
+#endif
+
             uint32_t own_phase;
-            own_phase = _gnrc_lwmac_ticks_to_phase(netif->mac.prot.lwmac.last_wakeup);
+            own_phase = _gnrc_lwmac_ticks_to_phase(_gnrc_lwmac_cycle_start(netif));
 
             if (own_phase >= netif->mac.tx.timestamp) {
                 own_phase = own_phase - netif->mac.tx.timestamp;
@@ -453,7 +463,6 @@ static bool _send_data(gnrc_netif_t *netif)
     int res = _gnrc_lwmac_transmit(netif, pkt);
     if (res < 0) {
         LOG_ERROR("ERROR: [LWMAC-tx] Send data failed.");
-        gnrc_pktbuf_release(pkt);
         /* clear packet point to avoid TX retry */
         netif->mac.tx.packet = NULL;
         return false;
@@ -465,11 +474,19 @@ static bool _send_data(gnrc_netif_t *netif)
     DEBUG("[LWMAC-tx]: spent %lu WR in TX\n",
           (unsigned long)netif->mac.tx.wr_sent);
 
-#if (LWMAC_ENABLE_DUTYCYLE_RECORD == 1)
-    netif->mac.prot.lwmac.pkt_start_sending_time_ticks =
-        rtt_get_counter() - netif->mac.prot.lwmac.pkt_start_sending_time_ticks;
+#if (GNRC_MAC_ENABLE_DUTYCYCLE_RECORD == 1)
+    uint32_t now = rtt_get_counter();
+    uint32_t delay = now - netif->mac.prot.lwmac.pkt_start_sending_time_ticks;
+
+    netif->mac.prot.lwmac.tx_delay_sum_ticks += delay;
+    if (delay > netif->mac.prot.lwmac.tx_delay_max_ticks) {
+        netif->mac.prot.lwmac.tx_delay_max_ticks = delay;
+    }
+    netif->mac.prot.lwmac.tx_count++;
+    /* the next packet of a burst is sent right away */
+    netif->mac.prot.lwmac.pkt_start_sending_time_ticks = now;
     DEBUG("[LWMAC-tx]: pkt sending delay in TX: %lu us\n",
-          RTT_TICKS_TO_US(netif->mac.prot.lwmac.pkt_start_sending_time_ticks));
+          (unsigned long)RTT_TICKS_TO_US(delay));
 #endif
 
     return true;
@@ -493,9 +510,6 @@ void gnrc_lwmac_tx_start(gnrc_netif_t *netif,
     netif->mac.tx.state = GNRC_LWMAC_TX_STATE_INIT;
     netif->mac.tx.wr_sent = 0;
 
-#if (LWMAC_ENABLE_DUTYCYLE_RECORD == 1)
-    netif->mac.prot.lwmac.pkt_start_sending_time_ticks = rtt_get_counter();
-#endif
 }
 
 void gnrc_lwmac_tx_stop(gnrc_netif_t *netif)
@@ -17,9 +17,11 @@
 
 #include <assert.h>
 #include <limits.h>
+#include <stdatomic.h>
 #include <string.h>
 #include <kernel_defines.h>
 
+#include "atomic_utils.h"
 #include "bitfield.h"
 #include "event.h"
 #include "net/ethernet.h"
@@ -501,8 +503,24 @@ void gnrc_netif_release(gnrc_netif_t *netif)
 }
 
 #if IS_USED(MODULE_GNRC_NETIF_IPV6)
-static int _addr_idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr);
-static int _group_idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr);
+static int _idx_lockfree(gnrc_netif_t *netif, const ipv6_addr_t *addr,
+                         bool mcast);
+
+/* gnrc_netif_ipv6_t::addrs and gnrc_netif_ipv6_t::groups are only changed
+ * with the interface acquired, between _addrs_write_begin() and
+ * _addrs_write_end(). Lookups read them without the lock and check with
+ * gnrc_netif_ipv6_t::addrs_seq whether they raced with such a change. */
+static inline void _addrs_write_begin(gnrc_netif_t *netif)
+{
+    atomic_store_u16(&netif->ipv6.addrs_seq, netif->ipv6.addrs_seq + 1);
+    atomic_thread_fence(memory_order_release);
+}
+
+static inline void _addrs_write_end(gnrc_netif_t *netif)
+{
+    atomic_thread_fence(memory_order_release);
+    atomic_store_u16(&netif->ipv6.addrs_seq, netif->ipv6.addrs_seq + 1);
+}
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
@@ -591,6 +609,73 @@ static ipv6_addr_t *_src_addr_selection(gnrc_netif_t *netif,
                                         const ipv6_addr_t *dst,
                                         uint8_t *candidate_set);
 
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_SRC_CACHE)
+/* marks a cache lookup that did not find the destination */
+#define SRC_CACHE_MISS      (INT_MIN)
+
+static inline uint32_t _src_cache_pl_gen(void)
+{
+#ifdef MODULE_GNRC_IPV6_NIB
+    return gnrc_ipv6_nib_pl_gen();
+#else
+    return 0;
+#endif
+}
+
+static void _src_cache_flush(gnrc_netif_t *netif)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE; i++) {
+        netif->ipv6.src_cache[i].used = false;
+    }
+    memcpy(netif->ipv6.src_cache_flags, netif->ipv6.addrs_flags,
+           sizeof(netif->ipv6.src_cache_flags));
+    netif->ipv6.src_cache_pl_gen = _src_cache_pl_gen();
+}
+
+static int _src_cache_get(gnrc_netif_t *netif, const ipv6_addr_t *dst,
+                          bool ll_only)
+{
+    /* address states change outside of this module (DAD, deprecation by the
+     * NIB), so the flags the results were based on are compared instead of
+     * hooking into every one of those places. The same goes for the prefix
+     * list, which caps the prefix match of rule 8 */
+    if ((memcmp(netif->ipv6.src_cache_flags, netif->ipv6.addrs_flags,
+                sizeof(netif->ipv6.src_cache_flags)) != 0) ||
+        (netif->ipv6.src_cache_pl_gen != _src_cache_pl_gen())) {
+        _src_cache_flush(netif);
+        return SRC_CACHE_MISS;
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE; i++) {
+        gnrc_netif_ipv6_src_cache_t *entry = &netif->ipv6.src_cache[i];
+
+        if (entry->used && (entry->ll_only == ll_only) &&
+            ipv6_addr_equal(&entry->dst, dst)) {
+            return entry->src;
+        }
+    }
+    return SRC_CACHE_MISS;
+}
+
+static void _src_cache_set(gnrc_netif_t *netif, const ipv6_addr_t *dst,
+                           bool ll_only, int src)
+{
+    gnrc_netif_ipv6_src_cache_t *entry;
+
+    entry = &netif->ipv6.src_cache[netif->ipv6.src_cache_next];
+    netif->ipv6.src_cache_next = (netif->ipv6.src_cache_next + 1) %
+                                 CONFIG_GNRC_NETIF_IPV6_SRC_CACHE_SIZE;
+    entry->dst = *dst;
+    entry->src = src;
+    entry->ll_only = ll_only;
+    entry->used = true;
+}
+#else
+static inline void _src_cache_flush(gnrc_netif_t *netif)
+{
+    (void)netif;
+}
+#endif  /* IS_USED(MODULE_GNRC_NETIF_IPV6_SRC_CACHE) */
+
 int gnrc_netif_ipv6_addr_add_internal(gnrc_netif_t *netif,
                                       const ipv6_addr_t *addr,
                                       unsigned pfx_len, uint8_t flags)
@@ -647,8 +732,11 @@ int gnrc_netif_ipv6_addr_add_internal(gnrc_netif_t *netif,
                                                  sizeof(addr_str)));
     }
 #endif /* CONFIG_GNRC_IPV6_NIB_ARSM */
+    _addrs_write_begin(netif);
     netif->ipv6.addrs_flags[idx] = flags;
     memcpy(&netif->ipv6.addrs[idx], addr, sizeof(netif->ipv6.addrs[idx]));
+    _addrs_write_end(netif);
+    _src_cache_flush(netif);
 #ifdef MODULE_GNRC_IPV6_NIB
     if (_get_state(netif, idx) == GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) {
         void *state = NULL;
@@ -693,6 +781,7 @@ void gnrc_netif_ipv6_addr_remove_internal(gnrc_netif_t *netif,
     assert((netif != NULL) && (addr != NULL));
     ipv6_addr_set_solicited_nodes(&sol_nodes, addr);
     gnrc_netif_acquire(netif);
+    _addrs_write_begin(netif);
     for (unsigned i = 0; i < CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF; i++) {
         if (ipv6_addr_equal(&netif->ipv6.addrs[i], addr)) {
             netif->ipv6.addrs_flags[i] = 0;
@@ -709,6 +798,8 @@ void gnrc_netif_ipv6_addr_remove_internal(gnrc_netif_t *netif,
             }
         }
     }
+    _addrs_write_end(netif);
+    _src_cache_flush(netif);
     if (remove_sol_nodes) {
         gnrc_netif_ipv6_group_leave_internal(netif, &sol_nodes);
     }
@@ -718,16 +809,11 @@ void gnrc_netif_ipv6_addr_remove_internal(gnrc_netif_t *netif,
 int gnrc_netif_ipv6_addr_idx(gnrc_netif_t *netif,
                              const ipv6_addr_t *addr)
 {
-    int idx;
-
     assert((netif != NULL) && (addr != NULL));
     DEBUG("gnrc_netif: get index of %s from interface %" PRIkernel_pid "\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)),
           netif->pid);
-    gnrc_netif_acquire(netif);
-    idx = _addr_idx(netif, addr);
-    gnrc_netif_release(netif);
-    return idx;
+    return _idx_lockfree(netif, addr, false);
 }
 
 int gnrc_netif_ipv6_addr_match(gnrc_netif_t *netif,
@@ -753,6 +839,15 @@ ipv6_addr_t *gnrc_netif_ipv6_addr_best_src(gnrc_netif_t *netif,
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
     memset(candidate_set, 0, sizeof(candidate_set));
     gnrc_netif_acquire(netif);
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_SRC_CACHE)
+    int cached = _src_cache_get(netif, dst, ll_only);
+
+    if (cached != SRC_CACHE_MISS) {
+        DEBUG("gnrc_netif: using cached source address selection\n");
+        gnrc_netif_release(netif);
+        return (cached < 0) ? NULL : &netif->ipv6.addrs[cached];
+    }
+#endif
     int first_candidate = _create_candidate_set(netif, dst, ll_only,
                                                 candidate_set);
     if (first_candidate >= 0) {
@@ -761,6 +856,10 @@ ipv6_addr_t *gnrc_netif_ipv6_addr_best_src(gnrc_netif_t *netif,
             best_src = &(netif->ipv6.addrs[first_candidate]);
         }
     }
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_SRC_CACHE)
+    _src_cache_set(netif, dst, ll_only,
+                   (best_src == NULL) ? -1 : (best_src - netif->ipv6.addrs));
+#endif
     gnrc_netif_release(netif);
     return best_src;
 }
@@ -772,10 +871,10 @@ gnrc_netif_t *gnrc_netif_get_by_ipv6_addr(const ipv6_addr_t *addr)
     DEBUG("gnrc_netif: get interface by IPv6 address %s\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)));
     while ((netif = gnrc_netif_iter(netif))) {
-        if (_addr_idx(netif, addr) >= 0) {
+        if (_idx_lockfree(netif, addr, false) >= 0) {
             break;
         }
-        if (_group_idx(netif, addr) >= 0) {
+        if (_idx_lockfree(netif, addr, true) >= 0) {
             break;
         }
     }
@@ -851,7 +950,9 @@ int gnrc_netif_ipv6_group_join_internal(gnrc_netif_t *netif,
         gnrc_netif_release(netif);
         return -ENOMEM;
     }
+    _addrs_write_begin(netif);
     memcpy(&netif->ipv6.groups[idx], addr, sizeof(netif->ipv6.groups[idx]));
+    _addrs_write_end(netif);
     /* TODO:
      *  - MLD action
      */
@@ -913,7 +1014,9 @@ void gnrc_netif_ipv6_group_leave_internal(gnrc_netif_t *netif,
         }
     }
     if (idx >= 0) {
+        _addrs_write_begin(netif);
         ipv6_addr_set_unspecified(&netif->ipv6.groups[idx]);
+        _addrs_write_end(netif);
         /* TODO:
          *  - MLD action */
     }
@@ -922,13 +1025,8 @@ void gnrc_netif_ipv6_group_leave_internal(gnrc_netif_t *netif,
 
 int gnrc_netif_ipv6_group_idx(gnrc_netif_t *netif, const ipv6_addr_t *addr)
 {
-    int idx;
-
     assert((netif != NULL) && (addr != NULL));
-    gnrc_netif_acquire(netif);
-    idx = _group_idx(netif, addr);
-    gnrc_netif_release(netif);
-    return idx;
+    return _idx_lockfree(netif, addr, true);
 }
 
 static int _idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr, bool mcast)
@@ -947,14 +1045,24 @@ static int _idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr, bool mcast)
     return -1;
 }
 
-static inline int _addr_idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr)
+static int _idx_lockfree(gnrc_netif_t *netif, const ipv6_addr_t *addr,
+                         bool mcast)
 {
-    return _idx(netif, addr, false);
-}
+    uint16_t seq = atomic_load_u16(&netif->ipv6.addrs_seq);
+    int idx;
 
-static inline int _group_idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr)
-{
-    return _idx(netif, addr, true);
+    atomic_thread_fence(memory_order_acquire);
+    idx = _idx(netif, addr, mcast);
+    atomic_thread_fence(memory_order_acquire);
+    if ((seq & 1) || (atomic_load_u16(&netif->ipv6.addrs_seq) != seq)) {
+        /* raced with a change: spinning would never let a lower priority
+         * writer finish, so wait for it by acquiring the interface */
+        DEBUG("gnrc_netif: address lookup raced with a change\n");
+        gnrc_netif_acquire(netif);
+        idx = _idx(netif, addr, mcast);
+        gnrc_netif_release(netif);
+    }
+    return idx;
 }
 
 static unsigned _match_to_len(const gnrc_netif_t *netif,
@@ -1506,6 +1614,15 @@ static void _init_from_device(gnrc_netif_t *netif)
     (void)res;
     assert(res == sizeof(tmp));
     netif->device_type = (uint8_t)tmp;
+#if IS_USED(MODULE_GNRC_NETIF_RX_POLL)
+    netopt_enable_t enable = NETOPT_DISABLE;
+
+    if ((dev->driver->get(dev, NETOPT_RX_POLL, &enable,
+                          sizeof(enable)) == sizeof(enable)) &&
+        (enable == NETOPT_ENABLE)) {
+        netif->flags |= GNRC_NETIF_FLAGS_RX_POLL;
+    }
+#endif
     gnrc_netif_ipv6_init_mtu(netif);
     _update_l2addr_from_dev(netif);
 }
@@ -1682,7 +1799,51 @@ int gnrc_netif_default_init(gnrc_netif_t *netif)
 }
 
 static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back);
+static void _pass_on_packet(gnrc_pktsnip_t *pkt);
 
+#if IS_USED(MODULE_GNRC_NETIF_RX_POLL)
+static void _rx_polled_pass_on(gnrc_netif_t *netif)
+{
+    for (unsigned i = 0; i < netif->rx_polled_len; i++) {
+        _pass_on_packet(netif->rx_polled[i]);
+    }
+    netif->rx_polled_len = 0;
+}
+
+/**
+ * @brief   Call the ISR handler from an event
+ *
+ * If the device supports @ref NETOPT_RX_POLL, it is polled until it stops
+ * delivering frames or @ref CONFIG_GNRC_NETIF_RX_POLL_BUDGET frames were
+ * received. As netdev has no way to ask a device whether more frames are
+ * pending, the ISR handler is simply called again. Drivers may emit
+ * NETDEV_EVENT_RX_COMPLETE without a frame (e.g. ethos and netdev_tap do), so
+ * polling stops as soon as netif_ops_t::recv() returns no packet. The frames
+ * are passed up one by one once polling is done.
+ *
+ * @param[in]   evp     pointer to the event
+ */
+static void _event_handler_isr(event_t *evp)
+{
+    gnrc_netif_t *netif = container_of(evp, gnrc_netif_t, event_isr);
+    unsigned received;
+
+    if (!(netif->flags & GNRC_NETIF_FLAGS_RX_POLL)) {
+        /* the ISR handler must not be called without a pending interrupt */
+        netif->dev->driver->isr(netif->dev);
+        return;
+    }
+    netif->rx_polling = true;
+    do {
+        received = netif->rx_polled_len;
+        netif->dev->driver->isr(netif->dev);
+    } while ((netif->rx_polled_len > received) &&
+             (netif->rx_polled_len < CONFIG_GNRC_NETIF_RX_POLL_BUDGET));
+    netif->rx_polling = false;
+    DEBUG("gnrc_netif: polled %u frames\n", netif->rx_polled_len);
+    _rx_polled_pass_on(netif);
+}
+#else
 /**
  * @brief   Call the ISR handler from an event
  *
@@ -1693,6 +1854,7 @@ static void _event_handler_isr(event_t *evp)
     gnrc_netif_t *netif = container_of(evp, gnrc_netif_t, event_isr);
     netif->dev->driver->isr(netif->dev);
 }
+#endif
 
 static void _process_receive_stats(gnrc_netif_t *netdev, gnrc_pktsnip_t *pkt)
 {
@@ -2115,6 +2277,18 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 _send_queued_pkt(netif);
                 if (pkt) {
                     _process_receive_stats(netif, pkt);
+#if IS_USED(MODULE_GNRC_NETIF_RX_POLL)
+                    if (netif->rx_polling) {
+                        /* some drivers drain their whole RX FIFO within a
+                         * single call of the ISR handler, keep the order */
+                        if (netif->rx_polled_len ==
+                            CONFIG_GNRC_NETIF_RX_POLL_BUDGET) {
+                            _rx_polled_pass_on(netif);
+                        }
+                        netif->rx_polled[netif->rx_polled_len++] = pkt;
+                        break;
+                    }
+#endif
                     _pass_on_packet(pkt);
                 }
                 break;
@@ -21,6 +21,9 @@
 #include "socket_zep.h"
 #include "socket_zep_params.h"
 #include "net/gnrc/netif/ieee802154.h"
+#ifdef MODULE_GNRC_LWMAC
+#include "net/gnrc/lwmac/lwmac.h"
+#endif
 #include "include/init_devs.h"
 #include "net/netdev/ieee802154_submac.h"
 
@@ -53,10 +56,17 @@ void auto_init_socket_zep(void)
         socket_zep_hal_setup(&_socket_zeps[i], &_socket_zep_netdev[i].submac.dev);
 
         socket_zep_setup(&_socket_zeps[i], &socket_zep_params[i]);
+#ifdef MODULE_GNRC_LWMAC
+        gnrc_netif_lwmac_create(&_netif[i], _socket_zep_stacks[i],
+                                SOCKET_ZEP_MAC_STACKSIZE,
+                                SOCKET_ZEP_MAC_PRIO, "socket_zep-lwmac",
+                                &_socket_zep_netdev[i].dev.netdev);
+#else
         gnrc_netif_ieee802154_create(&_netif[i], _socket_zep_stacks[i],
                                      SOCKET_ZEP_MAC_STACKSIZE,
                                      SOCKET_ZEP_MAC_PRIO, "socket_zep",
                                      &_socket_zep_netdev[i].dev.netdev);
+#endif
     }
 }
 /** @} */
@@ -19,6 +19,12 @@
 #include "net/gnrc/netif/conf.h"
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/netif/pktq.h"
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_SCHED)
+#include "net/icmpv6.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/sixlowpan.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -43,6 +49,247 @@ static gnrc_pktqueue_t *_get_free_entry(gnrc_pktsnip_t *pkt)
     return entry;
 }
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_SCHED)
+static const uint16_t _quantum[GNRC_NETIF_PKTQ_CLASS_NUMOF] = {
+    [GNRC_NETIF_PKTQ_CLASS_INTERACTIVE] = CONFIG_GNRC_NETIF_PKTQ_SCHED_QUANTUM_INTERACTIVE,
+    [GNRC_NETIF_PKTQ_CLASS_DEFAULT] = CONFIG_GNRC_NETIF_PKTQ_SCHED_QUANTUM_DEFAULT,
+    [GNRC_NETIF_PKTQ_CLASS_BULK] = CONFIG_GNRC_NETIF_PKTQ_SCHED_QUANTUM_BULK,
+};
+
+static void _stats_inc_len(gnrc_netif_pktq_stats_t *stats)
+{
+    if (++stats->len > stats->high_water) {
+        stats->high_water = stats->len;
+    }
+}
+
+#if IS_USED(MODULE_GNRC_NETTYPE_IPV6) || IS_USED(MODULE_GNRC_NETTYPE_SIXLOWPAN)
+/**
+ * @brief   Classifies a packet by the fields of its IPv6 header
+ *
+ * @param[in] dscp  DSCP of the packet
+ * @param[in] nh    next header of the packet
+ * @param[in] type  ICMPv6 type if @p nh is ICMPv6, NULL if it is not known
+ */
+static gnrc_netif_pktq_class_t _classify_ip(uint8_t dscp, uint8_t nh,
+                                            const uint8_t *type)
+{
+    if (dscp >= 48) {       /* CS6 and CS7: network control */
+        return GNRC_NETIF_PKTQ_CLASS_CONTROL;
+    }
+    if (nh == PROTNUM_ICMPV6) {
+        if ((type != NULL) &&
+            ((*type == ICMPV6_ECHO_REQ) || (*type == ICMPV6_ECHO_REP))) {
+            /* do not let ping floods starve other traffic */
+            return GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+        }
+        return GNRC_NETIF_PKTQ_CLASS_CONTROL;
+    }
+    if (dscp >= 32) {       /* CS4 up to EF */
+        return GNRC_NETIF_PKTQ_CLASS_INTERACTIVE;
+    }
+    if ((dscp == 8) || (dscp == 1)) {   /* CS1 and LE (RFC 8622) */
+        return GNRC_NETIF_PKTQ_CLASS_BULK;
+    }
+    return GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+}
+
+/**
+ * @brief   Finds the first byte behind a header of @p hdr_len bytes in @p snip
+ *
+ * The upper layer header is either still part of the same snip (e.g. for
+ * forwarded packets or fragments) or in the next one.
+ */
+static const uint8_t *_payload(const gnrc_pktsnip_t *snip, const uint8_t *data,
+                               size_t hdr_len)
+{
+    size_t offset = (data - (uint8_t *)snip->data) + hdr_len;
+
+    if (snip->size > offset) {
+        return (uint8_t *)snip->data + offset;
+    }
+    if ((snip->size == offset) && (snip->next != NULL) && (snip->next->size > 0)) {
+        return snip->next->data;
+    }
+    return NULL;
+}
+
+static gnrc_netif_pktq_class_t _classify_ipv6_hdr(const gnrc_pktsnip_t *snip,
+                                                  const uint8_t *data)
+{
+    const ipv6_hdr_t *hdr = (const ipv6_hdr_t *)data;
+
+    return _classify_ip(ipv6_hdr_get_tc_dscp(hdr), hdr->nh,
+                        _payload(snip, data, sizeof(ipv6_hdr_t)));
+}
+#endif
+
+#if IS_USED(MODULE_GNRC_NETTYPE_SIXLOWPAN)
+/* inline bytes of the source address by SAC and SAM, see RFC 6282 */
+static const uint8_t _iphc_sam_len[2][4] = { { 16, 8, 2, 0 }, { 0, 8, 2, 0 } };
+/* inline bytes of the destination address by M, DAC, and DAM, see RFC 6282 */
+static const uint8_t _iphc_dam_len[2][2][4] = {
+    { { 16, 8, 2, 0 }, { 0, 8, 2, 0 } },
+    { { 16, 6, 4, 1 }, { 6, 0, 0, 0 } },
+};
+
+static gnrc_netif_pktq_class_t _classify_iphc(const gnrc_pktsnip_t *snip,
+                                              const uint8_t *iphc, size_t len)
+{
+    uint8_t dscp = 0;
+    uint8_t nh = PROTNUM_RESERVED;
+    size_t hdr_len = SIXLOWPAN_IPHC_HDR_LEN;
+
+    if (len < SIXLOWPAN_IPHC_HDR_LEN) {
+        return GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+    }
+    if (iphc[1] & SIXLOWPAN_IPHC2_CID_EXT) {
+        hdr_len += SIXLOWPAN_IPHC_CID_EXT_LEN;
+    }
+    /* traffic class as it is put inline by gnrc_sixlowpan_iphc */
+    switch ((iphc[0] & SIXLOWPAN_IPHC1_TF) >> 3) {
+        case 0:     /* ECN + DSCP + flow label */
+            dscp = (hdr_len < len) ? (iphc[hdr_len] >> 2) : 0;
+            hdr_len += 4;
+            break;
+        case 1:     /* ECN + flow label, DSCP elided */
+            hdr_len += 3;
+            break;
+        case 2:     /* ECN + DSCP, flow label elided */
+            dscp = (hdr_len < len) ? (iphc[hdr_len] >> 2) : 0;
+            hdr_len += 1;
+            break;
+        default:    /* all elided */
+            break;
+    }
+    if (!(iphc[0] & SIXLOWPAN_IPHC1_NH)) {
+        /* UDP and extension headers would be NHC compressed, only an inline
+         * next header can be ICMPv6 */
+        nh = (hdr_len < len) ? iphc[hdr_len] : PROTNUM_RESERVED;
+        hdr_len += 1;
+    }
+    if (!(iphc[0] & SIXLOWPAN_IPHC1_HL)) {
+        hdr_len += 1;
+    }
+    hdr_len += _iphc_sam_len[!!(iphc[1] & SIXLOWPAN_IPHC2_SAC)]
+                            [(iphc[1] & SIXLOWPAN_IPHC2_SAM) >> 4];
+    hdr_len += _iphc_dam_len[!!(iphc[1] & SIXLOWPAN_IPHC2_M)]
+                            [!!(iphc[1] & SIXLOWPAN_IPHC2_DAC)]
+                            [iphc[1] & SIXLOWPAN_IPHC2_DAM];
+    return _classify_ip(dscp, nh,
+                        (nh == PROTNUM_ICMPV6) ? _payload(snip, iphc, hdr_len)
+                                               : NULL);
+}
+
+/**
+ * @brief   Classifies a 6LoWPAN frame by its (compressed) IPv6 header
+ *
+ * Only unfragmented frames and first fragments carry that header. Subsequent
+ * fragments are in the default class; the reassembling node has to cope with
+ * out-of-order fragments anyway.
+ */
+static gnrc_netif_pktq_class_t _classify_sixlowpan(const gnrc_pktsnip_t *snip)
+{
+    const uint8_t *data = snip->data;
+    size_t len = snip->size;
+
+    if ((len >= sizeof(sixlowpan_frag_t)) &&
+        sixlowpan_frag_1_is((sixlowpan_frag_t *)data)) {
+        data += sizeof(sixlowpan_frag_t);
+        len -= sizeof(sixlowpan_frag_t);
+    }
+    if (len == 0) {
+        return GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+    }
+    if (sixlowpan_iphc_is((uint8_t *)data)) {
+        return _classify_iphc(snip, data, len);
+    }
+    if ((data[0] == SIXLOWPAN_UNCOMP) && (len > sizeof(ipv6_hdr_t))) {
+        return _classify_ipv6_hdr(snip, data + 1);
+    }
+    return GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+}
+#endif
+
+gnrc_netif_pktq_class_t gnrc_netif_pktq_classify(const gnrc_pktsnip_t *pkt)
+{
+    assert(pkt != NULL);
+#if IS_USED(MODULE_GNRC_NETTYPE_IPV6)
+    const gnrc_pktsnip_t *ipv6 = gnrc_pktsnip_search_type(
+        (gnrc_pktsnip_t *)pkt, GNRC_NETTYPE_IPV6
+    );
+
+    if ((ipv6 != NULL) && (ipv6->size >= sizeof(ipv6_hdr_t))) {
+        return _classify_ipv6_hdr(ipv6, ipv6->data);
+    }
+#endif
+#if IS_USED(MODULE_GNRC_NETTYPE_SIXLOWPAN)
+    /* on 6LoWPAN interfaces the IPv6 header is already compressed when the
+     * packet is queued */
+    const gnrc_pktsnip_t *sixlo = gnrc_pktsnip_search_type(
+        (gnrc_pktsnip_t *)pkt, GNRC_NETTYPE_SIXLOWPAN
+    );
+
+    if ((sixlo != NULL) && (sixlo->size > 0)) {
+        return _classify_sixlowpan(sixlo);
+    }
+#endif
+    return GNRC_NETIF_PKTQ_CLASS_DEFAULT;
+}
+
+static gnrc_pktqueue_t *_remove_head(gnrc_netif_pktq_t *queue,
+                                     gnrc_netif_pktq_class_t cls)
+{
+    queue->stats[cls].len--;
+    return gnrc_pktqueue_remove_head(&queue->queues[cls]);
+}
+
+gnrc_pktqueue_t *gnrc_netif_pktq_sched_next(gnrc_netif_pktq_t *queue)
+{
+    unsigned empty = 0;
+
+    /* strict priority for control traffic */
+    if (queue->queues[GNRC_NETIF_PKTQ_CLASS_CONTROL] != NULL) {
+        return _remove_head(queue, GNRC_NETIF_PKTQ_CLASS_CONTROL);
+    }
+    /* deficit round robin between the remaining classes. Since only one
+     * packet is taken per call, remember if the class currently served
+     * already got its quantum for this round */
+    while (empty < (GNRC_NETIF_PKTQ_CLASS_NUMOF - 1)) {
+        gnrc_netif_pktq_class_t cls = queue->drr_class;
+
+        if (cls == GNRC_NETIF_PKTQ_CLASS_CONTROL) {
+            cls = GNRC_NETIF_PKTQ_CLASS_CONTROL + 1;
+            queue->drr_class = cls;
+        }
+        if (queue->queues[cls] == NULL) {
+            /* idle classes must not save up credit */
+            queue->deficit[cls] = 0;
+            empty++;
+        }
+        else {
+            int32_t len = gnrc_pkt_len(queue->queues[cls]->pkt);
+
+            empty = 0;
+            if (!queue->drr_granted) {
+                queue->deficit[cls] += _quantum[cls];
+                queue->drr_granted = true;
+            }
+            if (queue->deficit[cls] >= len) {
+                queue->deficit[cls] -= len;
+                return _remove_head(queue, cls);
+            }
+        }
+        /* go on to next class */
+        queue->drr_granted = false;
+        if (++queue->drr_class >= GNRC_NETIF_PKTQ_CLASS_NUMOF) {
+            queue->drr_class = GNRC_NETIF_PKTQ_CLASS_CONTROL + 1;
+        }
+    }
+    return NULL;
+}
+#endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ_SCHED) */
+
 unsigned gnrc_netif_pktq_usage(void)
 {
     unsigned res = 0;
@@ -62,10 +309,22 @@ int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 
     gnrc_pktqueue_t *entry = _get_free_entry(pkt);
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_SCHED)
+    gnrc_netif_pktq_class_t cls = gnrc_netif_pktq_classify(pkt);
+
+    if (entry == NULL) {
+        netif->send_queue.stats[cls].dropped++;
+        return -1;
+    }
+    gnrc_pktqueue_add(&netif->send_queue.queues[cls], entry);
+    netif->send_queue.stats[cls].enqueued++;
+    _stats_inc_len(&netif->send_queue.stats[cls]);
+#else
     if (entry == NULL) {
         return -1;
     }
     gnrc_pktqueue_add(&netif->send_queue.queue, entry);
+#endif
     return 0;
 }
 
@@ -103,10 +362,24 @@ int gnrc_netif_pktq_push_back(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 
     gnrc_pktqueue_t *entry = _get_free_entry(pkt);
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_SCHED)
+    gnrc_netif_pktq_class_t cls = gnrc_netif_pktq_classify(pkt);
+
+    if (entry == NULL) {
+        netif->send_queue.stats[cls].dropped++;
+        return -1;
+    }
+    LL_PREPEND(netif->send_queue.queues[cls], entry);
+    /* give back what the packet was charged when it was taken out */
+    netif->send_queue.deficit[cls] += gnrc_pkt_len(pkt);
+    /* the packet was already counted as enqueued when it was put */
+    _stats_inc_len(&netif->send_queue.stats[cls]);
+#else
     if (entry == NULL) {
         return -1;
     }
     LL_PREPEND(netif->send_queue.queue, entry);
+#endif
     return 0;
 }
 
@@ -19,6 +19,7 @@
 #include <string.h>
 #include <kernel_defines.h>
 
+#include "atomic_utils.h"
 #include "net/gnrc/icmpv6/error.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/nib/conf.h"
@@ -46,6 +47,8 @@ static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 static _nib_abr_entry_t _abrs[CONFIG_GNRC_IPV6_NIB_ABR_NUMOF];
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 static rmutex_t _nib_mutex = RMUTEX_INIT;
+/* read without holding the NIB lock, see gnrc_ipv6_nib_pl_gen() */
+static uint32_t _pl_gen = 0;
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
@@ -683,6 +686,7 @@ void _nib_pl_remove(_nib_offl_entry_t *nib_offl)
 {
     _evtimer_del(&nib_offl->pfx_timeout);
     _nib_offl_remove(nib_offl, _PL);
+    atomic_fetch_add_u32(&_pl_gen, 1);
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     unsigned idx = _idx_dsts(nib_offl);
     if (idx < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF) {
@@ -841,11 +845,16 @@ _nib_offl_entry_t *_nib_pl_add(unsigned iface,
                                uint32_t valid_ltime,
                                uint32_t pref_ltime)
 {
-    _nib_offl_entry_t *dst = _nib_offl_add(NULL, iface, pfx, pfx_len, _PL);
+    _nib_offl_entry_t *dst = _nib_offl_alloc(NULL, iface, pfx, pfx_len);
 
     if (dst == NULL) {
         return NULL;
     }
+    if (!(dst->mode & _PL)) {
+        /* only new prefixes count, not updates of their lifetimes */
+        dst->mode |= _PL;
+        atomic_fetch_add_u32(&_pl_gen, 1);
+    }
     assert(valid_ltime >= pref_ltime);
     if ((valid_ltime != UINT32_MAX) || (pref_ltime != UINT32_MAX)) {
         uint32_t now = evtimer_now_msec();
@@ -875,6 +884,11 @@ _nib_offl_entry_t *_nib_pl_add(unsigned iface,
     return dst;
 }
 
+uint32_t _nib_pl_gen(void)
+{
+    return atomic_load_u32(&_pl_gen);
+}
+
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node)
 {
@@ -731,6 +731,14 @@ _nib_offl_entry_t *_nib_pl_add(unsigned iface,
  */
 void _nib_pl_remove(_nib_offl_entry_t *nib_offl);
 
+/**
+ * @brief   Gets the generation of the prefix list
+ *
+ * @return  A number that changes whenever a prefix is added to or removed
+ *          from the prefix list.
+ */
+uint32_t _nib_pl_gen(void);
+
 /**
  * @brief   Removes a prefix from the prefix list as well as the addresses
  *          associated with the prefix.
@@ -120,6 +120,13 @@ void gnrc_ipv6_nib_pl_del(unsigned iface,
     _nib_release();
 }
 
+uint32_t gnrc_ipv6_nib_pl_gen(void)
+{
+    /* no NIB lock: this is called with a network interface locked, which
+     * would invert the lock order of gnrc_ipv6_nib_pl_set() */
+    return _nib_pl_gen();
+}
+
 bool gnrc_ipv6_nib_pl_iter(unsigned iface, void **state,
                            gnrc_ipv6_nib_pl_t *entry)
 {
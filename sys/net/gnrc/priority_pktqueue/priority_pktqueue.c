@@ -63,7 +63,7 @@ void gnrc_priority_pktqueue_push(gnrc_priority_pktqueue_t *queue,
     assert(queue != NULL);
     assert(node != NULL);
     assert(node->pkt != NULL);
-    assert(sizeof(unsigned int) == sizeof(gnrc_pktsnip_t *));
+    assert(sizeof(uintptr_t) == sizeof(gnrc_pktsnip_t *));
 
     priority_queue_add(queue, (priority_queue_node_t *)node);
 }
@@ -223,6 +223,7 @@ bool gnrc_rpl_parent_add_by_addr(gnrc_rpl_dodag_t *dodag, ipv6_addr_t *addr,
         (*parent)->state = GNRC_RPL_PARENT_ACTIVE;
         (*parent)->addr = *addr;
         (*parent)->rank = GNRC_RPL_INFINITE_RANK;
+        (*parent)->path_cost = GNRC_RPL_INFINITE_RANK;
         evtimer_del((evtimer_t *)(&gnrc_rpl_evtimer), (evtimer_event_t *)(&(*parent)->timeout_event));
         ((evtimer_event_t *)(&(*parent)->timeout_event))->next = NULL;
         (*parent)->timeout_event.msg.type = GNRC_RPL_MSG_TYPE_PARENT_TIMEOUT;
@@ -305,6 +306,16 @@ void gnrc_rpl_parent_update(gnrc_rpl_dodag_t *dodag, gnrc_rpl_parent_t *parent)
 #endif
     }
 
+    /* the parent set only needs to be re-evaluated if the preference of the
+     * parent changed. Parents with an infinite rank are always handed over,
+     * so they get removed from the parent set. */
+    if ((parent != NULL) && (dodag->instance->of->update_parent != NULL) &&
+        !dodag->instance->of->update_parent(parent) &&
+        (parent->rank != GNRC_RPL_INFINITE_RANK) &&
+        (dodag->my_rank != GNRC_RPL_INFINITE_RANK)) {
+        return;
+    }
+
     if (_gnrc_rpl_find_preferred_parent(dodag) == NULL) {
         gnrc_rpl_local_repair(dodag);
     }
@@ -330,13 +341,22 @@ static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *doda
         return NULL;
     }
 
-    LL_SORT(dodag->parents, dodag->instance->of->parent_cmp);
+    /* dodag->parents keeps pointing to the preferred parent while sorting,
+     * so the objective function can give it precedence */
     new_best = dodag->parents;
+    LL_SORT(new_best, dodag->instance->of->parent_cmp);
+    dodag->parents = new_best;
 
     if (new_best->rank == GNRC_RPL_INFINITE_RANK) {
         return NULL;
     }
 
+    /* the OF may consider the path via the best parent unusable, too */
+    uint16_t new_rank = dodag->instance->of->calc_rank(dodag, 0);
+    if (new_rank == GNRC_RPL_INFINITE_RANK) {
+        return NULL;
+    }
+
     if (new_best != old_best) {
         /* no-path DAOs only for the storing mode */
         if ((dodag->instance->mop == GNRC_RPL_MOP_STORING_MODE_NO_MC) ||
@@ -357,7 +377,7 @@ static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *doda
 
     }
 
-    dodag->my_rank = dodag->instance->of->calc_rank(dodag, 0);
+    dodag->my_rank = new_rank;
     if (dodag->my_rank != old_rank) {
         trickle_reset_timer(&dodag->trickle);
         gnrc_rpl_rpble_update(dodag);
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_rpl_mrhof
+ * @{
+ * @file
+ * @brief       Minimum Rank with Hysteresis Objective Function
+ *
+ * Implementation of MRHOF with ETX as link metric and without metric
+ * container.
+ * @}
+ */
+
+#include "macros/utils.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/gnrc/rpl.h"
+#include "net/gnrc/rpl/mrhof.h"
+#include "net/gnrc/rpl/structs.h"
+#include "net/netstats/neighbor.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief   Link metric type of the ETX object
+ * @see <a href="https://tools.ietf.org/html/rfc6551#section-6.1">
+ *          RFC 6551, section 6.1
+ *      </a>
+ */
+#define MRHOF_METRIC_TYPE_ETX       (7U)
+
+static uint16_t calc_rank(gnrc_rpl_dodag_t *, uint16_t);
+static int parent_cmp(gnrc_rpl_parent_t *, gnrc_rpl_parent_t *);
+static gnrc_rpl_dodag_t *which_dodag(gnrc_rpl_dodag_t *, gnrc_rpl_dodag_t *);
+static void reset(gnrc_rpl_dodag_t *);
+static bool update_parent(gnrc_rpl_parent_t *);
+
+static gnrc_rpl_of_t gnrc_rpl_mrhof = {
+    .ocp          = GNRC_RPL_OCP_MRHOF,
+    .calc_rank    = calc_rank,
+    .parent_cmp   = parent_cmp,
+    .which_dodag  = which_dodag,
+    .reset        = reset,
+    .parent_state_callback = NULL,
+    .init         = NULL,
+    .process_dio  = NULL,
+    .update_parent = update_parent,
+};
+
+gnrc_rpl_of_t *gnrc_rpl_get_of_mrhof(void)
+{
+    return &gnrc_rpl_mrhof;
+}
+
+void reset(gnrc_rpl_dodag_t *dodag)
+{
+    (void) dodag;
+}
+
+/* returns the ETX of the link to parent, scaled by NETSTATS_NB_ETX_DIVISOR */
+static uint16_t _link_etx(gnrc_rpl_parent_t *parent)
+{
+    gnrc_netif_t *netif = gnrc_netif_get_by_pid(parent->dodag->iface);
+    gnrc_ipv6_nib_nc_t nce;
+    netstats_nb_t stats;
+    void *state = NULL;
+    int l2addr_len = -1;
+
+    if (netif == NULL) {
+        return NETSTATS_NB_ETX_INIT * NETSTATS_NB_ETX_DIVISOR;
+    }
+
+    while (gnrc_ipv6_nib_nc_iter(netif->pid, &state, &nce)) {
+        if (ipv6_addr_equal(&nce.ipv6, &parent->addr)) {
+            l2addr_len = nce.l2addr_len;
+            break;
+        }
+    }
+    /* link-local addresses of 6LNs are usually not in the neighbor cache,
+     * but derived from the link-layer address */
+    if ((l2addr_len <= 0) && (netif->flags & GNRC_NETIF_FLAGS_HAS_L2ADDR)) {
+        l2addr_len = gnrc_netif_ipv6_iid_to_addr(netif,
+                                                 (eui64_t *)&parent->addr.u64[1],
+                                                 nce.l2addr);
+    }
+    if ((l2addr_len > 0) &&
+        netstats_nb_get(&netif->netif, nce.l2addr, l2addr_len, &stats)) {
+        return stats.etx;
+    }
+
+    return NETSTATS_NB_ETX_INIT * NETSTATS_NB_ETX_DIVISOR;
+}
+
+static uint16_t _path_cost(gnrc_rpl_parent_t *parent, uint16_t link_metric)
+{
+    uint32_t cost;
+
+    if ((parent->rank == GNRC_RPL_INFINITE_RANK) ||
+        (link_metric > CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC)) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+
+    cost = (uint32_t)parent->rank +
+           MAX(parent->dodag->instance->min_hop_rank_inc, link_metric);
+
+    if (cost > CONFIG_GNRC_RPL_MRHOF_MAX_PATH_COST) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+
+    return cost;
+}
+
+bool update_parent(gnrc_rpl_parent_t *parent)
+{
+    uint16_t old_cost = parent->path_cost;
+
+    parent->link_metric_type = MRHOF_METRIC_TYPE_ETX;
+    parent->link_metric = _link_etx(parent);
+    parent->path_cost = _path_cost(parent, parent->link_metric);
+
+    DEBUG("RPL: MRHOF parent rank %u, ETX %u/%u, path cost %u -> %u\n",
+          parent->rank, parent->link_metric, NETSTATS_NB_ETX_DIVISOR, old_cost,
+          parent->path_cost);
+
+    return parent->path_cost != old_cost;
+}
+
+uint16_t calc_rank(gnrc_rpl_dodag_t *dodag, uint16_t base_rank)
+{
+    if (base_rank == 0) {
+        if (dodag->parents == NULL) {
+            return GNRC_RPL_INFINITE_RANK;
+        }
+
+        return dodag->parents->path_cost;
+    }
+
+    uint16_t add;
+
+    if (dodag->parents != NULL) {
+        add = dodag->instance->min_hop_rank_inc;
+    }
+    else {
+        add = CONFIG_GNRC_RPL_DEFAULT_MIN_HOP_RANK_INCREASE;
+    }
+
+    if ((uint16_t)(base_rank + add) < base_rank) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+
+    return base_rank + add;
+}
+
+/* the cost used to order the parents: the current preferred parent gets a
+ * head start of PARENT_SWITCH_THRESHOLD over the others */
+static int32_t _cmp_cost(gnrc_rpl_parent_t *parent)
+{
+    int32_t cost = parent->path_cost;
+
+    if ((parent == parent->dodag->parents) &&
+        (parent->path_cost != GNRC_RPL_INFINITE_RANK)) {
+        cost -= CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD;
+    }
+    return cost;
+}
+
+int parent_cmp(gnrc_rpl_parent_t *parent1, gnrc_rpl_parent_t *parent2)
+{
+    int32_t cost1 = _cmp_cost(parent1);
+    int32_t cost2 = _cmp_cost(parent2);
+
+    if (cost1 < cost2) {
+        return -1;
+    }
+    else if (cost1 > cost2) {
+        return 1;
+    }
+    /* RFC 6719, section 3.2.2: switch if the path via the other parent is
+     * cheaper than the one via the preferred parent by at least
+     * PARENT_SWITCH_THRESHOLD */
+    if (parent1 == parent1->dodag->parents) {
+        return 1;
+    }
+    else if (parent2 == parent2->dodag->parents) {
+        return -1;
+    }
+    return 0;
+}
+
+/* Not used yet */
+gnrc_rpl_dodag_t *which_dodag(gnrc_rpl_dodag_t *d1, gnrc_rpl_dodag_t *d2)
+{
+    (void) d2;
+    return d1;
+}
@@ -27,6 +27,7 @@ static uint16_t calc_rank(gnrc_rpl_dodag_t *, uint16_t);
 static int parent_cmp(gnrc_rpl_parent_t *, gnrc_rpl_parent_t *);
 static gnrc_rpl_dodag_t *which_dodag(gnrc_rpl_dodag_t *, gnrc_rpl_dodag_t *);
 static void reset(gnrc_rpl_dodag_t *);
+static bool update_parent(gnrc_rpl_parent_t *);
 
 static gnrc_rpl_of_t gnrc_rpl_of0 = {
     .ocp          = 0x0,
@@ -36,7 +37,8 @@ static gnrc_rpl_of_t gnrc_rpl_of0 = {
     .reset        = reset,
     .parent_state_callback = NULL,
     .init         = NULL,
-    .process_dio  = NULL
+    .process_dio  = NULL,
+    .update_parent = update_parent,
 };
 
 gnrc_rpl_of_t *gnrc_rpl_get_of0(void)
@@ -50,6 +52,15 @@ void reset(gnrc_rpl_dodag_t *dodag)
     (void) dodag;
 }
 
+/* OF0 has no link metric, the cost of a parent is its rank */
+bool update_parent(gnrc_rpl_parent_t *parent)
+{
+    bool changed = (parent->path_cost != parent->rank);
+
+    parent->path_cost = parent->rank;
+    return changed;
+}
+
 uint16_t calc_rank(gnrc_rpl_dodag_t *dodag, uint16_t base_rank)
 {
     if (base_rank == 0) {
@@ -16,10 +16,12 @@
 #include <assert.h>
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "compiler_hints.h"
 #include "log.h"
 #include "macros/math.h"
+#include "mutex.h"
 #include "net/af.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/hdr.h"
@@ -40,7 +42,12 @@ extern gnrc_pktsnip_t *gnrc_pktbuf_fuzzptr;
 gnrc_pktsnip_t *gnrc_sock_prevpkt = NULL;
 #endif
 
-#ifdef SOCK_HAS_ASYNC
+#ifdef MODULE_GNRC_SOCK_STATS
+static gnrc_sock_reg_t *_stats_socks = NULL;
+static mutex_t _stats_lock = MUTEX_INIT;
+#endif
+
+#if defined(SOCK_HAS_ASYNC) || defined(MODULE_GNRC_SOCK_STATS)
 static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
 {
     if (cmd == GNRC_NETAPI_MSG_TYPE_RCV) {
@@ -48,34 +55,127 @@ static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
                       .content = { .ptr = pkt } };
         gnrc_sock_reg_t *reg = ctx;
 
+#ifdef MODULE_GNRC_SOCK_STATS
+        unsigned queued = mbox_avail(&reg->mbox);
+
+        if ((queued >= reg->stats.depth) ||
+            (mbox_try_put(&reg->mbox, &msg) < 1)) {
+            reg->stats.dropped++;
+#else
         if (mbox_try_put(&reg->mbox, &msg) < 1) {
+#endif
             LOG_WARNING("gnrc_sock: dropped message to %p (was full)\n",
                         (void *)&reg->mbox);
             /* packet could not be delivered so it should be dropped */
             gnrc_pktbuf_release(pkt);
             return;
         }
+#ifdef MODULE_GNRC_SOCK_STATS
+        reg->stats.received++;
+        if (++queued > reg->stats.high_water) {
+            reg->stats.high_water = queued;
+        }
+#endif
+#ifdef SOCK_HAS_ASYNC
         if (reg->async_cb.generic) {
             reg->async_cb.generic(reg, SOCK_ASYNC_MSG_RECV, reg->async_cb_arg);
         }
+#endif
     }
 }
-#endif /* SOCK_HAS_ASYNC */
+#endif /* SOCK_HAS_ASYNC || MODULE_GNRC_SOCK_STATS */
 
 void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_ctx)
 {
     mbox_init(&reg->mbox, reg->mbox_queue, GNRC_SOCK_MBOX_SIZE);
 #ifdef SOCK_HAS_ASYNC
     reg->async_cb.generic = NULL;
+#endif
+#ifdef MODULE_GNRC_SOCK_STATS
+    /* the registration may live on the stack, so don't trust its contents */
+    memset(&reg->stats, 0, sizeof(reg->stats));
+    reg->stats.depth = GNRC_SOCK_MBOX_SIZE;
+    reg->type = type;
+    mutex_lock(&_stats_lock);
+    /* prepend to current socks */
+    reg->stats_next = _stats_socks;
+    _stats_socks = reg;
+    mutex_unlock(&_stats_lock);
+#endif
+#if defined(SOCK_HAS_ASYNC) || defined(MODULE_GNRC_SOCK_STATS)
     reg->netreg_cb.cb = _netapi_cb;
     reg->netreg_cb.ctx = reg;
     gnrc_netreg_entry_init_cb(&reg->entry, demux_ctx, &reg->netreg_cb);
-#else   /* SOCK_HAS_ASYNC */
+#else   /* SOCK_HAS_ASYNC || MODULE_GNRC_SOCK_STATS */
     gnrc_netreg_entry_init_mbox(&reg->entry, demux_ctx, &reg->mbox);
-#endif  /* SOCK_HAS_ASYNC */
+#endif  /* SOCK_HAS_ASYNC || MODULE_GNRC_SOCK_STATS */
     gnrc_netreg_register(type, &reg->entry);
 }
 
+void gnrc_sock_unregister(gnrc_sock_reg_t *reg, gnrc_nettype_t type)
+{
+    gnrc_netreg_unregister(type, &reg->entry);
+#ifdef MODULE_GNRC_SOCK_STATS
+    mutex_lock(&_stats_lock);
+    for (gnrc_sock_reg_t **ptr = &_stats_socks; *ptr != NULL;
+         ptr = &(*ptr)->stats_next) {
+        if (*ptr == reg) {
+            *ptr = reg->stats_next;
+            break;
+        }
+    }
+    mutex_unlock(&_stats_lock);
+#endif
+}
+
+#ifdef MODULE_GNRC_SOCK_STATS
+int gnrc_sock_set_queue_depth(gnrc_sock_reg_t *reg, unsigned depth)
+{
+    assert(reg != NULL);
+    if ((depth == 0) || (depth > GNRC_SOCK_MBOX_SIZE)) {
+        return -EINVAL;
+    }
+    reg->stats.depth = depth;
+    return 0;
+}
+
+unsigned gnrc_sock_get_stats(const gnrc_sock_reg_t *reg,
+                             gnrc_sock_stats_t *stats)
+{
+    assert((reg != NULL) && (stats != NULL));
+    *stats = reg->stats;
+    if (stats->depth == 0) {
+        /* sock not bound yet */
+        stats->depth = GNRC_SOCK_MBOX_SIZE;
+        return 0;
+    }
+    return mbox_avail((mbox_t *)&reg->mbox);
+}
+
+void gnrc_sock_reset_stats(gnrc_sock_reg_t *reg)
+{
+    assert(reg != NULL);
+    reg->stats.received = 0;
+    reg->stats.dropped = 0;
+    reg->stats.high_water = 0;
+}
+
+void gnrc_sock_stats_lock(void)
+{
+    mutex_lock(&_stats_lock);
+}
+
+void gnrc_sock_stats_unlock(void)
+{
+    mutex_unlock(&_stats_lock);
+}
+
+gnrc_sock_reg_t *gnrc_sock_iter(const gnrc_sock_reg_t *prev)
+{
+    return (prev == NULL) ? _stats_socks : prev->stats_next;
+}
+#endif /* MODULE_GNRC_SOCK_STATS */
+
 ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
                        uint32_t timeout, sock_ip_ep_t *remote,
                        gnrc_sock_recv_aux_t *aux)
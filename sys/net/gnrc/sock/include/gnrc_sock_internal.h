@@ -151,6 +151,12 @@ static inline void gnrc_ep_set(sock_ip_ep_t *out, const sock_ip_ep_t *in,
  */
 void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_ctx);
 
+/**
+ * @brief   Remove a sock created with gnrc_sock_create() internally
+ * @internal
+ */
+void gnrc_sock_unregister(gnrc_sock_reg_t *reg, gnrc_nettype_t type);
+
 /**
  * @brief   Receive a packet internally
  * @internal
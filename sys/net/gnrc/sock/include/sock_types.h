@@ -12,6 +12,11 @@
  * @brief       Provides an implementation of the @ref net_sock by the
  *              @ref net_gnrc
  *
+ * With module `gnrc_sock_stats`, each sock counts the packets put into and
+ * dropped from its receive queue and tracks the queue's high-water mark. The
+ * queue depth can be limited per sock with gnrc_sock_set_queue_depth(). The
+ * `sock` shell command lists these statistics for all socks.
+ *
  * @{
  *
  * @file
@@ -73,6 +78,20 @@ extern "C" {
  */
 typedef struct gnrc_sock_reg gnrc_sock_reg_t;
 
+#if defined(MODULE_GNRC_SOCK_STATS) || defined(DOXYGEN)
+/**
+ * @brief   Receive queue statistics of a sock
+ *
+ * @note    Only available with module `gnrc_sock_stats`.
+ */
+typedef struct {
+    uint32_t received;      /**< packets put into the receive queue */
+    uint32_t dropped;       /**< packets dropped because the queue was full */
+    uint16_t high_water;    /**< maximum number of packets queued at once */
+    uint16_t depth;         /**< maximum number of packets to queue */
+} gnrc_sock_stats_t;
+#endif
+
 #ifdef SOCK_HAS_ASYNC
 /**
  * @brief   Event callback for @ref gnrc_sock_reg_t
@@ -94,8 +113,15 @@ struct gnrc_sock_reg {
     gnrc_netreg_entry_t entry;             /**< @ref net_gnrc_netreg entry for mbox */
     mbox_t mbox;                           /**< @ref core_mbox target for the sock */
     msg_t mbox_queue[GNRC_SOCK_MBOX_SIZE]; /**< queue for gnrc_sock_reg_t::mbox */
-#ifdef SOCK_HAS_ASYNC
+#if defined(SOCK_HAS_ASYNC) || defined(MODULE_GNRC_SOCK_STATS)
     gnrc_netreg_entry_cbd_t netreg_cb;     /**< netreg callback */
+#endif
+#ifdef MODULE_GNRC_SOCK_STATS
+    struct gnrc_sock_reg *stats_next;      /**< list of socks with statistics */
+    gnrc_nettype_t type;                   /**< type the sock is registered for */
+    gnrc_sock_stats_t stats;               /**< receive queue statistics */
+#endif
+#ifdef SOCK_HAS_ASYNC
     /**
      * @brief   asynchronous upper layer callback
      *
@@ -140,6 +166,74 @@ struct sock_udp {
     uint16_t flags;                        /**< option flags */
 };
 
+#if defined(MODULE_GNRC_SOCK_STATS) || defined(DOXYGEN)
+/**
+ * @brief   Limits the number of packets queued for a sock
+ *
+ * Packets arriving while @p depth packets are already waiting to be received
+ * are dropped and counted in gnrc_sock_stats_t::dropped. Call after the sock
+ * was created, e.g. with `&sock->reg` of a @ref sock_udp_t.
+ *
+ * @note    Only available with module `gnrc_sock_stats`.
+ *
+ * @param[in] reg   Registration of the sock.
+ * @param[in] depth New queue depth, at most @ref GNRC_SOCK_MBOX_SIZE.
+ *
+ * @return  0 on success.
+ * @return  -EINVAL, if @p depth is 0 or larger than @ref GNRC_SOCK_MBOX_SIZE.
+ */
+int gnrc_sock_set_queue_depth(gnrc_sock_reg_t *reg, unsigned depth);
+
+/**
+ * @brief   Gets the receive queue statistics of a sock
+ *
+ * @note    Only available with module `gnrc_sock_stats`.
+ *
+ * @param[in] reg       Registration of the sock.
+ * @param[out] stats    The statistics of @p reg.
+ *
+ * @return  Number of packets currently waiting in the queue of @p reg.
+ */
+unsigned gnrc_sock_get_stats(const gnrc_sock_reg_t *reg,
+                             gnrc_sock_stats_t *stats);
+
+/**
+ * @brief   Resets the counters and high-water mark of a sock
+ *
+ * @note    Only available with module `gnrc_sock_stats`.
+ *
+ * @param[in] reg   Registration of the sock.
+ */
+void gnrc_sock_reset_stats(gnrc_sock_reg_t *reg);
+
+/**
+ * @brief   Locks the list of socks against socks being created or closed
+ *
+ * @note    Only available with module `gnrc_sock_stats`.
+ */
+void gnrc_sock_stats_lock(void);
+
+/**
+ * @brief   Unlocks the list of socks
+ *
+ * @note    Only available with module `gnrc_sock_stats`.
+ */
+void gnrc_sock_stats_unlock(void);
+
+/**
+ * @brief   Iterates over all socks registered with the stack
+ *
+ * @pre     The list is locked with @ref gnrc_sock_stats_lock().
+ *
+ * @note    Only available with module `gnrc_sock_stats`.
+ *
+ * @param[in] prev  Previously returned sock or `NULL` to start iterating.
+ *
+ * @return  The next sock, `NULL` when done.
+ */
+gnrc_sock_reg_t *gnrc_sock_iter(const gnrc_sock_reg_t *prev);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
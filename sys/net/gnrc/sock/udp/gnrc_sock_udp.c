@@ -25,6 +25,7 @@
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/udp.h"
 #include "net/sock/udp.h"
+#include "net/sock/util.h"
 #include "net/udp.h"
 #include "random.h"
 
@@ -157,7 +158,7 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
 void sock_udp_close(sock_udp_t *sock)
 {
     assert(sock != NULL);
-    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &sock->reg.entry);
+    gnrc_sock_unregister(&sock->reg, GNRC_NETTYPE_UDP);
 #ifdef SOCK_HAS_ASYNC_CTX
     sock_event_close(sock_udp_get_async_ctx(sock));
 #endif
@@ -330,17 +331,59 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     return res;
 }
 
-ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
-                           const iolist_t *snips,
-                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+int sock_udp_recv_batch(sock_udp_t *sock, sock_udp_mmsg_t *msgs,
+                        unsigned num, uint32_t timeout)
+{
+    unsigned count = 0;
+    bool nobufs = false;
+
+    assert((sock != NULL) && ((msgs != NULL) || (num == 0)));
+    while (count < num) {
+        sock_udp_mmsg_t *msg = &msgs[count];
+        void *data, *ctx = NULL;
+        /* only block for the first datagram, then drain what is queued */
+        ssize_t res = sock_udp_recv_buf_aux(sock, &data, &ctx,
+                                            (count || nobufs) ? 0 : timeout,
+                                            msg->remote, NULL);
+
+        if (res < 0) {
+            if ((count == 0) && !nobufs) {
+                return res;
+            }
+            break;
+        }
+        if ((size_t)res > msg->max_len) {
+            /* drop datagram just like sock_udp_recv() does */
+            nobufs = true;
+        }
+        else {
+            memcpy(msg->data, data, res);
+            msg->len = res;
+            count++;
+        }
+        gnrc_pktbuf_release(ctx);
+    }
+    return ((count == 0) && nobufs) ? -ENOBUFS : (int)count;
+}
+
+/**
+ * @brief   Resolved end points and ports of an outgoing datagram
+ */
+typedef struct {
+    sock_ip_ep_t local;         /**< local end point */
+    sock_udp_ep_t remote;       /**< remote end point */
+    uint16_t src_port;          /**< UDP source port */
+} _udp_send_ep_t;
+
+/**
+ * @brief   Checks @p remote and resolves the end points for sending from
+ *          @p sock to @p remote, binding @p sock implicitly if required
+ */
+static int _resolve_send_ep(sock_udp_t *sock, const sock_udp_ep_t *remote,
+                            sock_udp_aux_tx_t *aux, _udp_send_ep_t *ep)
 {
     (void)aux;
-    int res;
-    gnrc_pktsnip_t *pkt, *payload = NULL;
-    uint16_t src_port = 0, dst_port;
-    sock_ip_ep_t local;
-    sock_udp_ep_t remote_cpy;
-    sock_ip_ep_t *rem;
+    sock_ip_ep_t *local = &ep->local;
 
     assert((sock != NULL) || (remote != NULL));
 
@@ -369,8 +412,8 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
      * cppcheck is being weird here anyways) */
     if ((sock == NULL) || (sock->local.family == AF_UNSPEC)) {
         /* no sock or sock currently unbound */
-        memset(&local, 0, sizeof(local));
-        if ((src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
+        memset(local, 0, sizeof(*local));
+        if ((ep->src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
             return -EADDRINUSE;
         }
         /* cppcheck-suppress nullPointer
@@ -378,14 +421,24 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
          * well, see above) */
         if (sock != NULL) {
             /* bind sock object implicitly */
-            sock->local.port = src_port;
+            sock->local.port = ep->src_port;
             if (remote == NULL) {
                 sock->local.family = sock->remote.family;
             }
             else {
                 sock->local.family = remote->family;
             }
-            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, src_port);
+#ifdef MODULE_GNRC_SOCK_STATS
+            /* keep depth if it was set before the sock got bound implicitly,
+             * sock_udp_create() cleared it otherwise */
+            unsigned depth = sock->reg.stats.depth;
+#endif
+            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, ep->src_port);
+#ifdef MODULE_GNRC_SOCK_STATS
+            if (depth != 0) {
+                gnrc_sock_set_queue_depth(&sock->reg, depth);
+            }
+#endif
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
             /* prepend to current socks */
             sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
@@ -394,37 +447,47 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
         }
     }
     else {
-        src_port = sock->local.port;
-        memcpy(&local, &sock->local, sizeof(local));
+        ep->src_port = sock->local.port;
+        memcpy(local, &sock->local, sizeof(*local));
     }
 #if IS_USED(MODULE_SOCK_AUX_LOCAL)
     /* user supplied local endpoint takes precedent */
     if ((aux != NULL) && (aux->flags & SOCK_AUX_SET_LOCAL)) {
-        local.family = aux->local.family;
-        local.netif = aux->local.netif;
-        src_port = aux->local.port;
-        memcpy(&local.addr, &aux->local.addr, sizeof(local.addr));
+        local->family = aux->local.family;
+        local->netif = aux->local.netif;
+        ep->src_port = aux->local.port;
+        memcpy(&local->addr, &aux->local.addr, sizeof(local->addr));
 
         aux->flags &= ~SOCK_AUX_SET_LOCAL;
     }
 #endif
     /* sock can't be NULL at this point */
     if (remote == NULL) {
-        rem = (sock_ip_ep_t *)&sock->remote;
-        dst_port = sock->remote.port;
+        memcpy(&ep->remote, &sock->remote, sizeof(ep->remote));
     }
     else {
-        rem = (sock_ip_ep_t *)&remote_cpy;
-        gnrc_ep_set(rem, (sock_ip_ep_t *)remote, sizeof(sock_udp_ep_t));
-        dst_port = remote->port;
+        gnrc_ep_set((sock_ip_ep_t *)&ep->remote, (sock_ip_ep_t *)remote,
+                    sizeof(sock_udp_ep_t));
     }
     /* check for matching address families in local and remote */
-    if (local.family == AF_UNSPEC) {
-        local.family = rem->family;
+    if (local->family == AF_UNSPEC) {
+        local->family = ep->remote.family;
     }
-    else if (local.family != rem->family) {
+    else if (local->family != ep->remote.family) {
         return -EINVAL;
     }
+    return 0;
+}
+
+/**
+ * @brief   Builds a UDP datagram from @p snips and hands it to the network
+ *          layer using the already resolved end points @p ep
+ */
+static ssize_t _send(sock_udp_t *sock, const iolist_t *snips,
+                     _udp_send_ep_t *ep)
+{
+    gnrc_pktsnip_t *pkt, *payload;
+    int res;
 
     /* allocate snip for payload */
     payload = gnrc_pktbuf_add(NULL, NULL, iolist_size(snips), GNRC_NETTYPE_UNDEF);
@@ -435,12 +498,13 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
     /* copy payload data into payload snip */
     iolist_to_buffer(snips, payload->data, payload->size);
 
-    pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
+    pkt = gnrc_udp_hdr_build(payload, ep->src_port, ep->remote.port);
     if (pkt == NULL) {
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
-    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
+    res = gnrc_sock_send(pkt, &ep->local, (sock_ip_ep_t *)&ep->remote,
+                         PROTNUM_UDP);
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
     }
@@ -449,10 +513,74 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
         sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
                                sock->reg.async_cb_arg);
     }
+#else
+    (void)sock;
 #endif  /* SOCK_HAS_ASYNC */
     return res;
 }
 
+ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
+                           const iolist_t *snips,
+                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    _udp_send_ep_t ep;
+    int res;
+
+    if ((res = _resolve_send_ep(sock, remote, aux, &ep)) < 0) {
+        return res;
+    }
+    return _send(sock, snips, &ep);
+}
+
+/**
+ * @brief   Checks if the optional end points @p a and @p b are the same
+ */
+static bool _same_remote(const sock_udp_ep_t *a, const sock_udp_ep_t *b)
+{
+    if ((a == NULL) || (b == NULL)) {
+        return a == b;
+    }
+    /* sock_udp_ep_equal() doesn't compare the interface */
+    return (a->netif == b->netif) && sock_udp_ep_equal(a, b);
+}
+
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_mmsg_t *msgs,
+                        unsigned num)
+{
+    /* copy of the remote the end points were resolved for, the caller may
+     * hand in different buffers holding the same end point */
+    sock_udp_ep_t remote;
+    const sock_udp_ep_t *last = NULL;
+    _udp_send_ep_t ep;
+    unsigned count;
+
+    assert((sock != NULL) && ((msgs != NULL) || (num == 0)));
+    for (count = 0; count < num; count++) {
+        const sock_udp_mmsg_t *msg = &msgs[count];
+        iolist_t snip = {
+            .iol_base = msg->data,
+            .iol_len = msg->len,
+        };
+        ssize_t res;
+
+        /* only resolve end points again if the remote changes */
+        if ((count == 0) || !_same_remote(msg->remote, last)) {
+            if ((res = _resolve_send_ep(sock, msg->remote, NULL, &ep)) < 0) {
+                return (count == 0) ? res : (int)count;
+            }
+            last = NULL;
+            if (msg->remote != NULL) {
+                remote = *msg->remote;
+                last = &remote;
+            }
+        }
+        if ((res = _send(sock, &snip, &ep)) < 0) {
+            return (count == 0) ? res : (int)count;
+        }
+    }
+    return count;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
@@ -18,11 +18,21 @@
 #include <stdbool.h>
 #include <string.h>
 
+#include "container.h"
+#include "crypto/aes.h"
 #include "crypto/ciphers.h"
 #include "crypto/modes/ecb.h"
 #include "crypto/modes/cbc.h"
 #include "net/ieee802154_security.h"
 
+/**
+ * @brief   Number of blocks passed to the cipher operations at once
+ *
+ * Large enough for the CBC-MAC and the key stream of any frame of
+ * @ref IEEE802154_FRAME_LEN_MAX bytes, longer inputs are processed in chunks.
+ */
+#define SEC_BATCH_BLOCKS    (10U)
+
 const ieee802154_radio_cipher_ops_t ieee802154_radio_cipher_ops = {
     .set_key = NULL,
     .ecb = NULL,
@@ -34,13 +44,67 @@ static inline uint16_t _min(uint16_t a, uint16_t b)
     return a < b ? a : b;
 }
 
+#if IS_USED(MODULE_IEEE802154_SECURITY_KEY_CACHE)
+static const aes_key_t *_key_schedule(const ieee802154_sec_context_t *ctx)
+{
+    return &container_of(ctx->key, ieee802154_sec_key_cache_entry_t,
+                         key[0])->schedule;
+}
+
+/**
+ * @brief   Find @p key in the key cache, replace the least recently used
+ *          entry if it is not there
+ *
+ * @return  Copy of @p key in the cache entry
+ */
+static const uint8_t *_key_cache_get(ieee802154_sec_context_t *ctx,
+                                     const uint8_t *key)
+{
+    ieee802154_sec_key_cache_entry_t *lru = &ctx->key_cache[0];
+
+    if (++ctx->key_cache_clock == 0) {
+        /* the clock wrapped around, only keep track of used entries */
+        for (unsigned i = 0; i < ARRAY_SIZE(ctx->key_cache); i++) {
+            if (ctx->key_cache[i].last_used) {
+                ctx->key_cache[i].last_used = 1;
+            }
+        }
+        ctx->key_cache_clock = 2;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(ctx->key_cache); i++) {
+        ieee802154_sec_key_cache_entry_t *entry = &ctx->key_cache[i];
+        if (entry->last_used &&
+            !memcmp(entry->key, key, IEEE802154_SEC_KEY_LENGTH)) {
+            entry->last_used = ctx->key_cache_clock;
+            return entry->key;
+        }
+        if (entry->last_used < lru->last_used) {
+            lru = entry;
+        }
+    }
+
+    aes_expand_key(&lru->schedule, key, IEEE802154_SEC_KEY_LENGTH);
+    memcpy(lru->key, key, IEEE802154_SEC_KEY_LENGTH);
+    lru->last_used = ctx->key_cache_clock;
+
+    return lru->key;
+}
+#endif
+
 static void _set_key(ieee802154_sec_context_t *ctx,
                      const uint8_t *key)
 {
     if (ctx->dev.cipher_ops->set_key) {
         ctx->dev.cipher_ops->set_key(&ctx->dev, key, IEEE802154_SEC_BLOCK_SIZE);
     }
-    memcpy(ctx->cipher.context.context, key, IEEE802154_SEC_KEY_LENGTH);
+#if IS_USED(MODULE_IEEE802154_SECURITY_KEY_CACHE)
+    /* only the fallback implementations need the key schedule */
+    if (!ctx->dev.cipher_ops->ecb || !ctx->dev.cipher_ops->cbc) {
+        key = _key_cache_get(ctx, key);
+    }
+#endif
+    ctx->key = key;
 }
 
 /**
@@ -59,10 +123,17 @@ static void _sec_ecb(const ieee802154_sec_dev_t *dev,
                      const uint8_t *plain,
                      uint8_t nblocks)
 {
-    cipher_encrypt_ecb(&((ieee802154_sec_context_t *)dev->ctx)->cipher,
-                       plain,
-                       nblocks * IEEE802154_SEC_BLOCK_SIZE,
+    const ieee802154_sec_context_t *ctx = dev->ctx;
+
+#if IS_USED(MODULE_IEEE802154_SECURITY_KEY_CACHE)
+    aes_encrypt_expanded(_key_schedule(ctx), plain, cipher, nblocks);
+#else
+    cipher_t aes;
+
+    cipher_init(&aes, CIPHER_AES, ctx->key, IEEE802154_SEC_KEY_LENGTH);
+    cipher_encrypt_ecb(&aes, plain, nblocks * IEEE802154_SEC_BLOCK_SIZE,
                        cipher);
+#endif
 }
 
 /**
@@ -84,11 +155,29 @@ static void _sec_cbc(const ieee802154_sec_dev_t *dev,
                      const uint8_t *plain,
                      uint8_t nblocks)
 {
-    cipher_encrypt_cbc(&((ieee802154_sec_context_t *)dev->ctx)->cipher,
-                       iv,
-                       plain,
-                       nblocks * IEEE802154_SEC_BLOCK_SIZE,
+    const ieee802154_sec_context_t *ctx = dev->ctx;
+
+#if IS_USED(MODULE_IEEE802154_SECURITY_KEY_CACHE)
+    const aes_key_t *schedule = _key_schedule(ctx);
+    const uint8_t *last = iv;
+    uint8_t block[IEEE802154_SEC_BLOCK_SIZE];
+
+    for (unsigned i = 0; i < nblocks; i++) {
+        for (unsigned j = 0; j < IEEE802154_SEC_BLOCK_SIZE; j++) {
+            block[j] = plain[j] ^ last[j];
+        }
+        aes_encrypt_expanded(schedule, block, cipher, 1);
+        last = cipher;
+        plain += IEEE802154_SEC_BLOCK_SIZE;
+        cipher += IEEE802154_SEC_BLOCK_SIZE;
+    }
+#else
+    cipher_t aes;
+
+    cipher_init(&aes, CIPHER_AES, ctx->key, IEEE802154_SEC_KEY_LENGTH);
+    cipher_encrypt_cbc(&aes, iv, plain, nblocks * IEEE802154_SEC_BLOCK_SIZE,
                        cipher);
+#endif
 }
 
 /**
@@ -113,7 +202,7 @@ static inline uint8_t _ccm_flag(uint8_t M, uint8_t L)
 {
     assert(M == 0 || M == 4 || M == 8 || M == 16);
     assert(L == 2);
-    return (M >= 4 ? ((1 << 6) | (((M) - 2) / 2)) : 0) | ((L) - 1);
+    return (M >= 4 ? ((1 << 6) | ((((M) - 2) / 2) << 3)) : 0) | ((L) - 1);
 }
 
 static inline uint8_t _get_sec_level(uint8_t scf)
@@ -254,14 +343,6 @@ static inline void _init_ctr_A0(ieee802154_sec_ccm_block_t *A0,
     memcpy(A0->nonce.src_addr, src_address, IEEE802154_LONG_ADDRESS_LEN);
 }
 
-/**
- * @brief   In CTR, the blocks Ai differ in a successive counter
- */
-static inline void _advance_ctr_Ai(ieee802154_sec_ccm_block_t *Ai)
-{
-    Ai->counter = htons(ntohs(Ai->counter) + 1);
-}
-
 /**
  * @brief   Construct the first block B0 for CBC-MAC
  */
@@ -279,68 +360,86 @@ static inline void _init_cbc_B0(ieee802154_sec_ccm_block_t *B0,
     memcpy(B0->nonce.src_addr, src_address, IEEE802154_LONG_ADDRESS_LEN);
 }
 
-static const uint8_t *_get_encryption_key(const ieee802154_sec_context_t *ctx,
-                                          const uint8_t *mhr, uint8_t mhr_len,
-                                          const ieee802154_sec_aux_t *ahr)
+static const uint8_t *_get_key(const ieee802154_sec_context_t *ctx,
+                               const uint8_t *mhr, uint8_t mhr_len, bool rx)
 {
-    (void)mhr;
-    (void)mhr_len;
-    (void)ahr;
-    /* For simplicity, assume that everyone has the same key */
-    /* Else you´d have to look up the key based on the destination address */
+    if (ctx->key_lookup) {
+        return ctx->key_lookup(ctx, mhr, mhr_len, rx);
+    }
+    /* without a key lookup, everyone has the same key */
     return ctx->cipher.context.context;
 }
 
-static const uint8_t *_get_decryption_key(const ieee802154_sec_context_t *ctx,
-                                          const uint8_t *mhr, uint8_t mhr_len,
-                                          const ieee802154_sec_aux_t *ahr)
+static void _ecb(ieee802154_sec_context_t *ctx, uint8_t *cipher,
+                 const uint8_t *plain, uint8_t nblocks)
 {
-    (void)mhr;
-    (void)mhr_len;
-    (void)ahr;
-    /* For simplicity, assume that everyone has the same key */
-    /* Else you´d have to look up the key based on the source address */
-    return ctx->cipher.context.context;
+    if (ctx->dev.cipher_ops->ecb) {
+        ctx->dev.cipher_ops->ecb(&ctx->dev, cipher, plain, nblocks);
+    }
+    else {
+        _sec_ecb(&ctx->dev, cipher, plain, nblocks);
+    }
 }
 
 /**
- * @brief   Perform ECB on one block of data and and add padding if necessary
+ * @brief   State of a CBC-MAC computation
+ *
+ * Input is collected in @p blocks and passed to the CBC operation in
+ * batches of up to @ref SEC_BATCH_BLOCKS blocks.
  */
-static uint8_t _ecb(ieee802154_sec_context_t *ctx,
-                    uint8_t *tmp1, uint8_t *tmp2, uint8_t *data,
-                    const uint8_t *Ai, uint16_t size)
+typedef struct {
+    uint8_t blocks[SEC_BATCH_BLOCKS * IEEE802154_SEC_BLOCK_SIZE];
+    uint8_t *mic;
+    uint16_t len;
+} _cbc_mac_t;
+
+static void _cbc_mac_flush(ieee802154_sec_context_t *ctx, _cbc_mac_t *mac)
 {
-    uint16_t s = _min(IEEE802154_SEC_BLOCK_SIZE, size);
-    if (ctx->dev.cipher_ops->ecb) {
-        ctx->dev.cipher_ops->ecb(&ctx->dev, tmp2, Ai, 1);
+    uint8_t nblocks = mac->len / IEEE802154_SEC_BLOCK_SIZE;
+
+    if (!nblocks) {
+        return;
+    }
+    if (ctx->dev.cipher_ops->cbc) {
+        ctx->dev.cipher_ops->cbc(&ctx->dev, mac->blocks, mac->mic,
+                                 mac->blocks, nblocks);
     }
     else {
-        _sec_ecb(&ctx->dev, tmp2, Ai, 1);
+        _sec_cbc(&ctx->dev, mac->blocks, mac->mic, mac->blocks, nblocks);
+    }
+    /* the MIC is the last cipher block, it is the IV of the next batch */
+    memcpy(mac->mic,
+           &mac->blocks[(nblocks - 1) * IEEE802154_SEC_BLOCK_SIZE],
+           IEEE802154_SEC_BLOCK_SIZE);
+    mac->len = 0;
+}
+
+static void _cbc_mac_update(ieee802154_sec_context_t *ctx, _cbc_mac_t *mac,
+                            const void *data, uint16_t len)
+{
+    while (len) {
+        uint16_t s = _min(sizeof(mac->blocks) - mac->len, len);
+        memcpy(&mac->blocks[mac->len], data, s);
+        mac->len += s;
+        data = (const uint8_t *)data + s;
+        len -= s;
+        if (mac->len == sizeof(mac->blocks)) {
+            _cbc_mac_flush(ctx, mac);
+        }
     }
-    memcpy(tmp1, data, s);
-    memset(tmp1 + s, 0, IEEE802154_SEC_BLOCK_SIZE - s);
-    _memxor(tmp1, tmp2, IEEE802154_SEC_BLOCK_SIZE);
-    memcpy(data, tmp1, s);
-    return s;
 }
 
 /**
- * @brief   Perform CBC on one block of data and add padding if necessary
+ * @brief   Pad the input of the CBC-MAC with zeros to a block boundary
  */
-static uint8_t _cbc_next(ieee802154_sec_context_t *ctx,
-                         uint8_t *last, uint8_t *tmp,
-                         const uint8_t *next, uint16_t size)
+static void _cbc_mac_pad(_cbc_mac_t *mac)
 {
-    uint16_t s = _min(IEEE802154_SEC_BLOCK_SIZE, size);
-    memcpy(tmp, next, s);
-    memset(tmp + s, 0, IEEE802154_SEC_BLOCK_SIZE - s);
-    if (ctx->dev.cipher_ops->cbc){
-        ctx->dev.cipher_ops->cbc(&ctx->dev, last, last, tmp, 1);
-    }
-    else {
-        _sec_cbc(&ctx->dev, last, last, tmp, 1);
-    }
-    return s;
+    uint16_t pad = (IEEE802154_SEC_BLOCK_SIZE -
+                    (mac->len % IEEE802154_SEC_BLOCK_SIZE)) %
+                   IEEE802154_SEC_BLOCK_SIZE;
+    /* the buffer is a multiple of the block size, so it can't overflow */
+    memset(&mac->blocks[mac->len], 0, pad);
+    mac->len += pad;
 }
 
 static void _comp_mic(ieee802154_sec_context_t *ctx,
@@ -349,52 +448,74 @@ static void _comp_mic(ieee802154_sec_context_t *ctx,
                       const void *a, uint16_t a_len,
                       const void *m, uint16_t m_len)
 {
-    uint8_t tmp[IEEE802154_SEC_BLOCK_SIZE] = { 0 };
-    uint16_t off;
+    _cbc_mac_t mac = { .mic = mic, .len = 0 };
+    uint8_t l_a[sizeof(uint16_t)];
+
     memset(mic, 0, IEEE802154_SEC_MAX_MAC_SIZE);
-    _cbc_next(ctx, mic, tmp, (uint8_t *)B0, sizeof(*B0));
-    byteorder_htobebufs(tmp, a_len);
-    off = _min(sizeof(tmp) - sizeof(uint16_t), a_len);
-    memcpy(tmp + sizeof(uint16_t), a, off);
-    _cbc_next(ctx, mic, tmp, tmp, sizeof(uint16_t) + off);
-    for (;off < a_len;) {
-        off += _cbc_next(ctx, mic, tmp, &(((uint8_t *)a)[off]), a_len - off);
-    }
-    for (off = 0; off < m_len;) {
-        off += _cbc_next(ctx, mic, tmp, &(((uint8_t *)m)[off]), m_len - off);
-    }
+    _cbc_mac_update(ctx, &mac, B0, sizeof(*B0));
+    byteorder_htobebufs(l_a, a_len);
+    _cbc_mac_update(ctx, &mac, l_a, sizeof(l_a));
+    _cbc_mac_update(ctx, &mac, a, a_len);
+    _cbc_mac_pad(&mac);
+    _cbc_mac_update(ctx, &mac, m, m_len);
+    _cbc_mac_pad(&mac);
+    _cbc_mac_flush(ctx, &mac);
 }
 
+/**
+ * @brief   En- or decrypt the MIC with the key stream block A0 and the
+ *          payload with the blocks A1, A2, ...
+ *
+ * The blocks of the key stream are computed in batches of up to
+ * @ref SEC_BATCH_BLOCKS blocks.
+ */
 static void _ctr(ieee802154_sec_context_t *ctx,
-                 ieee802154_sec_ccm_block_t *A0,
-                 const void *m, uint16_t m_len)
+                 const ieee802154_sec_ccm_block_t *A0,
+                 uint8_t *mic, uint8_t mic_size,
+                 uint8_t *m, uint16_t m_len)
 {
-    uint8_t tmp1[IEEE802154_SEC_BLOCK_SIZE] = { 0 };
-    uint8_t tmp2[IEEE802154_SEC_BLOCK_SIZE] = { 0 };
-
-    for (uint16_t off = 0; off < m_len;) {
-        _advance_ctr_Ai(A0);
-        off += _ecb(ctx, tmp1, tmp2,
-                    &(((uint8_t *)m)[off]), (uint8_t *)A0, m_len - off);
+    uint8_t stream[SEC_BATCH_BLOCKS * IEEE802154_SEC_BLOCK_SIZE];
+    uint16_t last = (m_len + IEEE802154_SEC_BLOCK_SIZE - 1) /
+                    IEEE802154_SEC_BLOCK_SIZE;
+    uint16_t counter = mic_size ? 0 : 1;
+
+    while (counter <= last) {
+        uint8_t nblocks = _min(SEC_BATCH_BLOCKS, last - counter + 1);
+
+        for (unsigned i = 0; i < nblocks; i++) {
+            ieee802154_sec_ccm_block_t *Ai =
+                (ieee802154_sec_ccm_block_t *)&stream[i * IEEE802154_SEC_BLOCK_SIZE];
+            *Ai = *A0;
+            Ai->counter = htons(counter + i);
+        }
+        _ecb(ctx, stream, stream, nblocks);
+
+        for (unsigned i = 0; i < nblocks; i++, counter++) {
+            const uint8_t *key_stream = &stream[i * IEEE802154_SEC_BLOCK_SIZE];
+            if (counter == 0) {
+                _memxor(mic, key_stream, mic_size);
+            }
+            else {
+                uint16_t off = (counter - 1) * IEEE802154_SEC_BLOCK_SIZE;
+                _memxor(&m[off], key_stream,
+                        _min(IEEE802154_SEC_BLOCK_SIZE, m_len - off));
+            }
+        }
     }
 }
 
-static void _ctr_mic(ieee802154_sec_context_t *ctx,
-                     ieee802154_sec_ccm_block_t *A0,
-                     void *mic, uint8_t mic_size)
-{
-    uint8_t tmp1[IEEE802154_SEC_BLOCK_SIZE] = { 0 };
-    uint8_t tmp2[IEEE802154_SEC_BLOCK_SIZE] = { 0 };
-
-    _ecb(ctx, tmp1, tmp2, mic, (uint8_t *)A0, mic_size);
-}
-
 void ieee802154_sec_init(ieee802154_sec_context_t *ctx)
 {
     /* device driver can override this */
     ctx->dev.cipher_ops = &ieee802154_radio_cipher_ops;
     /* device driver can override this */
     ctx->dev.ctx = ctx;
+    ctx->key_lookup = NULL;
+    ctx->key = NULL;
+#if IS_USED(MODULE_IEEE802154_SECURITY_KEY_CACHE)
+    memset(ctx->key_cache, 0, sizeof(ctx->key_cache));
+    ctx->key_cache_clock = 0;
+#endif
     /* MIC64 is the only mandatory security mode */
     ctx->security_level = IEEE802154_SEC_SCF_SECLEVEL_ENC_MIC64;
     ctx->key_id_mode = IEEE802154_SEC_SCF_KEYMODE_IMPLICIT;
@@ -434,7 +555,7 @@ int ieee802154_sec_encrypt_frame(ieee802154_sec_context_t *ctx,
 
     /* attempt to find the encrypton key */
     const uint8_t *key;
-    if (!(key = _get_encryption_key(ctx, header, *header_size, aux))) {
+    if (!(key = _get_key(ctx, header, *header_size, false))) {
         return -IEEE802154_SEC_NO_KEY;
     }
     _set_key(ctx, key);
@@ -450,16 +571,11 @@ int ieee802154_sec_encrypt_frame(ieee802154_sec_context_t *ctx,
     if (_req_mac(ctx->security_level)) {
         _init_cbc_B0(&ccm, ctx->frame_counter, ctx->security_level, m_len, *mic_size, src_address);
         _comp_mic(ctx, mic, &ccm, a, a_len, m, m_len);
-
-        /* encrypt MIC */
-        _init_ctr_A0(&ccm, ctx->frame_counter, ctx->security_level, src_address);
-        _ctr_mic(ctx, &ccm, mic, *mic_size);
-    }
-    /* encrypt payload */
-    if (_req_encryption(ctx->security_level)) {
-        _init_ctr_A0(&ccm, ctx->frame_counter, ctx->security_level, src_address);
-        _ctr(ctx, &ccm, m, m_len);
     }
+    /* encrypt MIC and payload */
+    _init_ctr_A0(&ccm, ctx->frame_counter, ctx->security_level, src_address);
+    _ctr(ctx, &ccm, mic, *mic_size,
+         m, _req_encryption(ctx->security_level) ? m_len : 0);
     *header_size += aux_size;
     ctx->frame_counter++;
     return IEEE802154_SEC_OK;
@@ -500,7 +616,7 @@ int ieee802154_sec_decrypt_frame(ieee802154_sec_context_t *ctx,
 
     /* attempt to find the decryption key */
     const uint8_t *key;
-    if (!(key = _get_decryption_key(ctx, header, *header_size, aux))) {
+    if (!(key = _get_key(ctx, header, *header_size, true))) {
         return -IEEE802154_SEC_NO_KEY;
     }
     _set_key(ctx, key);
@@ -519,16 +635,10 @@ int ieee802154_sec_decrypt_frame(ieee802154_sec_context_t *ctx,
        But we do not store this information because we also do not have
        a proper key store, to avoid complexity on embedded devices. */
 
-    /* decrypt MIC */
-    if (mac_size) {
-        _init_ctr_A0(&ccm, frame_counter, security_level, src_address);
-        _ctr_mic(ctx, &ccm, mac, mac_size);
-    }
-    /* decrypt cipher */
-    if (_req_encryption(security_level)) {
-        _init_ctr_A0(&ccm, frame_counter, security_level, src_address);
-        _ctr(ctx, &ccm, c, c_len);
-    }
+    /* decrypt MIC and cipher */
+    _init_ctr_A0(&ccm, frame_counter, security_level, src_address);
+    _ctr(ctx, &ccm, mac, mac_size,
+         c, _req_encryption(security_level) ? c_len : 0);
     /* check MIC */
     if (_req_mac(security_level)) {
         uint8_t tmp_mic[IEEE802154_SEC_MAX_MAC_SIZE];
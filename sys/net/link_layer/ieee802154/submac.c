@@ -18,6 +18,7 @@
 #include <string.h>
 #include "net/ieee802154/submac.h"
 #include "net/ieee802154.h"
+#include "iolist.h"
 #include "ztimer.h"
 #include "random.h"
 #include "luid.h"
@@ -67,6 +68,41 @@ static bool _has_retrans_left(ieee802154_submac_t *submac)
     return submac->retrans < CONFIG_IEEE802154_DEFAULT_MAX_FRAME_RETRANS;
 }
 
+static bool _has_staged(ieee802154_submac_t *submac)
+{
+#if IS_USED(MODULE_IEEE802154_SUBMAC_PIPELINE)
+    return submac->staged.iol_len != 0;
+#else
+    (void)submac;
+    return false;
+#endif
+}
+
+static void _report_tx_done(ieee802154_submac_t *submac, int status,
+                            ieee802154_tx_info_t *info)
+{
+#if IS_USED(MODULE_IEEE802154_SUBMAC_PIPELINE)
+    /* the new state is only set after the FSM handler returns, so a frame
+     * staged from within the callback would never be picked up */
+    submac->in_tx_done = true;
+    submac->cb->tx_done(submac, status, info);
+    submac->in_tx_done = false;
+#else
+    submac->cb->tx_done(submac, status, info);
+#endif
+}
+
+static void _tx_init(ieee802154_submac_t *submac, const iolist_t *iolist)
+{
+    uint8_t *buf = iolist->iol_base;
+
+    submac->wait_for_ack = buf[0] & IEEE802154_FCF_ACK_REQ;
+    submac->psdu = iolist;
+    submac->retrans = 0;
+    submac->csma_retries_nb = 0;
+    submac->backoff_mask = (1 << submac->be.min) - 1;
+}
+
 static ieee802154_fsm_state_t _tx_end(ieee802154_submac_t *submac, int status,
                                       ieee802154_tx_info_t *info)
 {
@@ -80,10 +116,42 @@ static ieee802154_fsm_state_t _tx_end(ieee802154_submac_t *submac, int status,
     res = ieee802154_radio_set_idle(&submac->dev, true);
 
     assert(res >= 0);
-    submac->cb->tx_done(submac, status, info);
+
+#if IS_USED(MODULE_IEEE802154_SUBMAC_PIPELINE)
+    if (_has_staged(submac)) {
+        /* The radio is in TX_ON already, so load the staged frame before
+         * reporting. This frees the staging buffer for the next one. */
+        _tx_init(submac, &submac->staged);
+        ieee802154_radio_write(&submac->dev, &submac->staged);
+        submac->staged.iol_len = 0;
+        ieee802154_submac_bh_request(submac);
+        _report_tx_done(submac, status, info);
+        return IEEE802154_FSM_STATE_PREPARE;
+    }
+#endif
+
+    _report_tx_done(submac, status, info);
     return IEEE802154_FSM_STATE_IDLE;
 }
 
+static ieee802154_fsm_state_t _tx_end_frame_pending(ieee802154_submac_t *submac,
+                                                    ieee802154_tx_info_t *info)
+{
+    /* A staged frame is sent first */
+    if (!IS_USED(MODULE_IEEE802154_SUBMAC_PIPELINE) || _has_staged(submac)) {
+        return _tx_end(submac, TX_STATUS_FRAME_PENDING, info);
+    }
+
+    /* The peer is about to send a frame, keep listening instead of turning
+     * the transceiver off and on again */
+    if (ieee802154_radio_set_rx(&submac->dev) < 0) {
+        return _tx_end(submac, TX_STATUS_FRAME_PENDING, info);
+    }
+    submac->wait_for_ack = false;
+    _report_tx_done(submac, TX_STATUS_FRAME_PENDING, info);
+    return IEEE802154_FSM_STATE_RX;
+}
+
 static void _print_debug(ieee802154_fsm_state_t old, ieee802154_fsm_state_t new,
                          ieee802154_fsm_ev_t ev)
 {
@@ -266,7 +334,8 @@ static ieee802154_fsm_state_t _fsm_state_tx_process_tx_done(ieee802154_submac_t
     switch (info->status) {
     case TX_STATUS_FRAME_PENDING:
         assert(_does_handle_ack(&submac->dev));
-    /* FALL-THRU */
+        submac->csma_retries_nb = 0;
+        return _tx_end_frame_pending(submac, info);
     case TX_STATUS_SUCCESS:
         submac->csma_retries_nb = 0;
         /* If the radio handles ACK, the TX_DONE event marks completion of
@@ -354,8 +423,10 @@ static ieee802154_fsm_state_t _fsm_state_wait_for_ack(ieee802154_submac_t *subma
             tx_info.retrans = submac->retrans;
             bool fp = (ack[0] & IEEE802154_FCF_FRAME_PEND);
             ieee802154_radio_set_frame_filter_mode(&submac->dev, IEEE802154_FILTER_ACCEPT);
-            return _tx_end(submac, fp ? TX_STATUS_FRAME_PENDING : TX_STATUS_SUCCESS,
-                           &tx_info);
+            if (fp) {
+                return _tx_end_frame_pending(submac, &tx_info);
+            }
+            return _tx_end(submac, TX_STATUS_SUCCESS, &tx_info);
         }
         return IEEE802154_FSM_STATE_WAIT_FOR_ACK;
     case IEEE802154_FSM_EV_CRC_ERROR:
@@ -408,6 +479,19 @@ int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist)
     ieee802154_fsm_state_t current_state = submac->fsm_state;
 
     if (current_state != IEEE802154_FSM_STATE_RX && current_state != IEEE802154_FSM_STATE_IDLE) {
+#if IS_USED(MODULE_IEEE802154_SUBMAC_PIPELINE)
+        if ((iolist != NULL) && !_has_staged(submac) && !submac->in_tx_done) {
+            ssize_t len = iolist_to_buffer(iolist, submac->staged_buf,
+                                           sizeof(submac->staged_buf));
+            if (len <= 0) {
+                return -EOVERFLOW;
+            }
+            submac->staged.iol_next = NULL;
+            submac->staged.iol_base = submac->staged_buf;
+            submac->staged.iol_len = len;
+            return 0;
+        }
+#endif
         return -EBUSY;
     }
 
@@ -415,14 +499,7 @@ int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist)
         return 0;
     }
 
-    uint8_t *buf = iolist->iol_base;
-    bool cnf = buf[0] & IEEE802154_FCF_ACK_REQ;
-
-    submac->wait_for_ack = cnf;
-    submac->psdu = iolist;
-    submac->retrans = 0;
-    submac->csma_retries_nb = 0;
-    submac->backoff_mask = (1 << submac->be.min) - 1;
+    _tx_init(submac, iolist);
 
     if (ieee802154_submac_process_ev(submac, IEEE802154_FSM_EV_REQUEST_TX)
         != IEEE802154_FSM_STATE_PREPARE) {
@@ -640,6 +717,10 @@ int ieee802154_submac_init(ieee802154_submac_t *submac, const network_uint16_t *
     ieee802154_dev_t *dev = &submac->dev;
 
     submac->fsm_state = IEEE802154_FSM_STATE_RX;
+#if IS_USED(MODULE_IEEE802154_SUBMAC_PIPELINE)
+    submac->staged.iol_len = 0;
+    submac->in_tx_done = false;
+#endif
 
     int res;
 
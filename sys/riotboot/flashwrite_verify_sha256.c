@@ -33,8 +33,6 @@ int riotboot_flashwrite_verify_sha256(const uint8_t *sha256_digest,
 {
     char digest[SHA256_DIGEST_LENGTH];
 
-    sha256_context_t sha256;
-
     if (img_len < 4) {
         LOG_INFO("riotboot: verify_sha256(): image too small\n");
         return -1;
@@ -45,16 +43,20 @@ int riotboot_flashwrite_verify_sha256(const uint8_t *sha256_digest,
     LOG_INFO("riotboot: verifying digest at %p (img at: %p size: %" PRIuSIZE ")\n",
              sha256_digest, img_start, img_len);
 
-    sha256_init(&sha256);
-
+    /* account for injected RIOTBOOT_MAGIC by skipping RIOTBOOT_MAGIC_LEN */
+    iolist_t img = {
+        .iol_base = img_start + 4,
+        .iol_len = img_len - 4,
+    };
     /* add RIOTBOOT_MAGIC since it isn't written into flash until
      * riotboot_flashwrite_finish()" */
-    sha256_update(&sha256, "RIOT", 4);
-
-    /* account for injected RIOTBOOT_MAGIC by skipping RIOTBOOT_MAGIC_LEN */
-    sha256_update(&sha256, img_start + 4, img_len - 4);
+    iolist_t magic = {
+        .iol_next = &img,
+        .iol_base = (void *)"RIOT",
+        .iol_len = 4,
+    };
 
-    sha256_final(&sha256, digest);
+    sha256_iolist(&magic, digest);
 
     return memcmp(sha256_digest, digest, SHA256_DIGEST_LENGTH) != 0;
 }
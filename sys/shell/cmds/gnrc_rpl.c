@@ -334,9 +334,9 @@ int _gnrc_rpl_dodag_show(void)
 
         gnrc_rpl_parent_t *parent = NULL;
         LL_FOREACH(gnrc_rpl_instances[i].dodag.parents, parent) {
-            printf("\t\tparent [addr: %s | rank: %d]\n",
+            printf("\t\tparent [addr: %s | rank: %d | cost: %d]\n",
                     ipv6_addr_to_str(addr_str, &parent->addr, sizeof(addr_str)),
-                    parent->rank);
+                    parent->rank, parent->path_cost);
         }
     }
     return 0;
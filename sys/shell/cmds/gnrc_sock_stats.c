@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   Shell command to show receive queue statistics of GNRC socks
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "net/gnrc/nettype.h"
+#include "shell.h"
+#include "sock_types.h"
+
+static const char *_type_str(gnrc_nettype_t type)
+{
+    switch (type) {
+        case GNRC_NETTYPE_UDP:
+            return "UDP";
+        case GNRC_NETTYPE_IPV6:
+            return "IPv6";
+        default:
+            return "?";
+    }
+}
+
+static void _print_socks(void)
+{
+    printf("%-5s %5s %7s %5s %4s %10s %10s\n",
+           "type", "demux", "queued", "depth", "hwm", "received", "dropped");
+    gnrc_sock_stats_lock();
+    for (gnrc_sock_reg_t *reg = gnrc_sock_iter(NULL); reg != NULL;
+         reg = gnrc_sock_iter(reg)) {
+        gnrc_sock_stats_t stats;
+        unsigned queued = gnrc_sock_get_stats(reg, &stats);
+
+        printf("%-5s %5" PRIu32 " %7u %5u %4u %10" PRIu32 " %10" PRIu32 "\n",
+               _type_str(reg->type), reg->entry.demux_ctx, queued,
+               stats.depth, stats.high_water, stats.received, stats.dropped);
+    }
+    gnrc_sock_stats_unlock();
+}
+
+static int _usage(const char *cmd)
+{
+    printf("usage: %s [reset|depth <demux> <n>]\n", cmd);
+    return 1;
+}
+
+static int _gnrc_sock_stats(int argc, char **argv)
+{
+    if (argc == 1) {
+        _print_socks();
+        return 0;
+    }
+    if ((argc == 2) && (strcmp(argv[1], "reset") == 0)) {
+        gnrc_sock_stats_lock();
+        for (gnrc_sock_reg_t *reg = gnrc_sock_iter(NULL); reg != NULL;
+             reg = gnrc_sock_iter(reg)) {
+            gnrc_sock_reset_stats(reg);
+        }
+        gnrc_sock_stats_unlock();
+        return 0;
+    }
+    if ((argc == 4) && (strcmp(argv[1], "depth") == 0)) {
+        uint32_t demux = strtoul(argv[2], NULL, 10);
+        unsigned depth = strtoul(argv[3], NULL, 10);
+        unsigned found = 0;
+        int res = 0;
+
+        gnrc_sock_stats_lock();
+        for (gnrc_sock_reg_t *reg = gnrc_sock_iter(NULL); reg != NULL;
+             reg = gnrc_sock_iter(reg)) {
+            if (reg->entry.demux_ctx != demux) {
+                continue;
+            }
+            if (gnrc_sock_set_queue_depth(reg, depth) < 0) {
+                res = -1;
+                break;
+            }
+            found++;
+        }
+        gnrc_sock_stats_unlock();
+        if (res < 0) {
+            printf("error: depth must be within 1 and %u\n",
+                   (unsigned)GNRC_SOCK_MBOX_SIZE);
+            return 1;
+        }
+        if (found == 0) {
+            printf("error: no sock on %" PRIu32 "\n", demux);
+            return 1;
+        }
+        return 0;
+    }
+    return _usage(argv[0]);
+}
+
+SHELL_COMMAND(sock, "Show receive queue statistics of socks",
+              _gnrc_sock_stats);
+
+/** @} */
@@ -22,6 +22,7 @@
  * @}
  */
 
+#include <errno.h>
 #include <inttypes.h>
 #include <nanocbor/nanocbor.h>
 #include <assert.h>
@@ -44,6 +45,9 @@
 #include "suit/transport/vfs.h"
 #endif
 #include "suit/transport/mock.h"
+#if IS_USED(MODULE_SUIT_VCDIFF)
+#include "suit/vcdiff.h"
+#endif
 
 #if defined(MODULE_PROGRESS_BAR)
 #include "progress_bar.h"
@@ -291,6 +295,11 @@ static int _dtv_set_param(suit_manifest_t *manifest, int key,
             case SUIT_PARAMETER_URI:
                 ref = &comp->param_uri;
                 break;
+#if IS_USED(MODULE_SUIT_VCDIFF)
+            case SUIT_PARAMETER_SOURCE_COMPONENT:
+                ref = &comp->param_source_component;
+                break;
+#endif
             default:
                 LOG_DEBUG("Unsupported parameter %" PRIi32 "\n", param_key);
                 return SUIT_ERR_UNSUPPORTED;
@@ -320,6 +329,13 @@ static int _start_storage(suit_manifest_t *manifest, suit_component_t *comp)
 
     suit_storage_set_active_location(comp->storage_backend, name);
 
+#if IS_USED(MODULE_SUIT_DIGEST_STREAM)
+    /* A digest from an earlier fetch doesn't cover the new payload */
+    comp->state &= ~SUIT_COMPONENT_STATE_DIGESTED;
+    sha256_init(&manifest->payload_sha256);
+    manifest->payload_hashed = 0;
+#endif
+
     return suit_storage_start(comp->storage_backend, manifest, img_size);
 }
 
@@ -347,7 +363,37 @@ static inline void _print_download_progress(suit_manifest_t *manifest,
 #endif
 }
 
-#if defined(MODULE_SUIT_TRANSPORT_COAP) || defined(MODULE_SUIT_TRANSPORT_VFS)
+#if defined(MODULE_SUIT_TRANSPORT_COAP) || defined(MODULE_SUIT_TRANSPORT_VFS) || \
+    defined(MODULE_SUIT_TRANSPORT_MOCK)
+/* Same as coap_blockwise_cb_t, the mock transport doesn't depend on nanocoap */
+typedef int (*_fetch_cb_t)(void *arg, size_t offset, uint8_t *buf, size_t len,
+                           int more);
+
+#if IS_USED(MODULE_SUIT_DIGEST_STREAM)
+static void _digest_update(suit_manifest_t *manifest, size_t offset,
+                           const uint8_t *buf, size_t len)
+{
+    /* Only hash the payload while it arrives in order, otherwise the digest
+     * is computed by reading back the storage */
+    if (offset == manifest->payload_hashed) {
+        sha256_update(&manifest->payload_sha256, buf, len);
+        manifest->payload_hashed += len;
+    }
+    else {
+        manifest->payload_hashed = SIZE_MAX;
+    }
+}
+
+static void _digest_finish(suit_manifest_t *manifest, suit_component_t *comp,
+                           size_t total)
+{
+    if (manifest->payload_hashed == total) {
+        sha256_final(&manifest->payload_sha256, comp->payload_digest);
+        suit_component_set_flag(comp, SUIT_COMPONENT_STATE_DIGESTED);
+    }
+}
+#endif
+
 static int _storage_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
                            int more)
 {
@@ -382,14 +428,83 @@ static int _storage_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
 
     _print_download_progress(manifest, offset, len, image_size);
 
+#if IS_USED(MODULE_SUIT_DIGEST_STREAM)
+    /* Hash the chunk while it is still in the receive buffer */
+    _digest_update(manifest, offset, buf, len);
+#endif
+
     int res = suit_storage_write(comp->storage_backend, manifest, buf, offset, len);
+    if (res < 0) {
+        /* Don't finalize (or trust the digest of) a partially written payload */
+        return res;
+    }
     if (!more) {
         LOG_INFO("Finalizing payload store\n");
         /* Finalize the write if no more data available */
         res = suit_storage_finish(comp->storage_backend, manifest);
+#if IS_USED(MODULE_SUIT_DIGEST_STREAM)
+        if (res == SUIT_OK) {
+            _digest_finish(manifest, comp, total);
+        }
+#endif
+    }
+    return res;
+}
+
+#if IS_USED(MODULE_SUIT_VCDIFF)
+/* Only one payload is fetched at a time */
+static suit_vcdiff_t _vcdiff;
+
+static int _vcdiff_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
+                          int more)
+{
+    suit_vcdiff_t *vcdiff = arg;
+
+    /* The decoder has no way back, the delta must arrive in order */
+    if (offset != vcdiff->delta_len) {
+        LOG_ERROR("Delta payload at offset %" PRIuSIZE ", expected %" PRIuSIZE "\n",
+                  offset, vcdiff->delta_len);
+        return -EINVAL;
+    }
+
+    int res = suit_vcdiff_apply(vcdiff, buf, len);
+    if ((res == 0) && !more) {
+        res = suit_vcdiff_finish(vcdiff);
     }
     return res;
 }
+
+static int _start_vcdiff(suit_manifest_t *manifest, suit_component_t *comp,
+                         _fetch_cb_t *cb, void **cb_arg)
+{
+    nanocbor_value_t param_source;
+    uint32_t source;
+
+    if (suit_param_ref_to_cbor(manifest, &comp->param_source_component,
+                               &param_source) == 0) {
+        /* Not a delta payload */
+        return SUIT_OK;
+    }
+    if (nanocbor_get_uint32(&param_source, &source) < 0) {
+        return SUIT_ERR_INVALID_MANIFEST;
+    }
+    /* The source must be the installed payload of the component itself */
+    if (source != manifest->component_current) {
+        LOG_ERROR("Delta against other components is not supported\n");
+        return SUIT_ERR_UNSUPPORTED;
+    }
+
+    int res = suit_vcdiff_init(&_vcdiff, comp->storage_backend,
+                               *cb, *cb_arg);
+    if (res == SUIT_OK) {
+        LOG_INFO("Payload is a delta against the installed image\n");
+        /* Reconstructed image is passed on to the original callback */
+        *cb = _vcdiff_helper;
+        *cb_arg = &_vcdiff;
+    }
+    return res;
+}
+#endif
 #endif
 
 static int _dtv_fetch(suit_manifest_t *manifest, int key,
@@ -439,6 +554,19 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
         return SUIT_ERR_STORAGE;
     }
 
+#if defined(MODULE_SUIT_TRANSPORT_COAP) || defined(MODULE_SUIT_TRANSPORT_VFS) || \
+    defined(MODULE_SUIT_TRANSPORT_MOCK)
+    _fetch_cb_t cb = _storage_helper;
+    void *cb_arg = manifest;
+
+#if IS_USED(MODULE_SUIT_VCDIFF)
+    res = _start_vcdiff(manifest, comp, &cb, &cb_arg);
+    if (res < 0) {
+        return res;
+    }
+#endif
+#endif
+
     res = -1;
 
     if (0) {}
@@ -446,18 +574,17 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
     else if ((strncmp(manifest->urlbuf, "coap://", 7) == 0) ||
              (IS_USED(MODULE_NANOCOAP_DTLS) && strncmp(manifest->urlbuf, "coaps://", 8) == 0)) {
         res = nanocoap_get_blockwise_url(manifest->urlbuf, CONFIG_SUIT_COAP_BLOCKSIZE,
-                                         _storage_helper,
-                                         manifest);
+                                         cb, cb_arg);
     }
 #endif
 #ifdef MODULE_SUIT_TRANSPORT_MOCK
     else if (strncmp(manifest->urlbuf, "test://", 7) == 0) {
-        res = suit_transport_mock_fetch(manifest);
+        res = suit_transport_mock_fetch(manifest, cb, cb_arg);
     }
 #endif
 #ifdef MODULE_SUIT_TRANSPORT_VFS
     else if (strncmp(manifest->urlbuf, "file://", 7) == 0) {
-        res = suit_transport_vfs_fetch(manifest, _storage_helper, manifest);
+        res = suit_transport_vfs_fetch(manifest, cb, cb_arg);
     }
 #endif
     else {
@@ -505,6 +632,19 @@ static int _validate_payload(suit_component_t *component, const uint8_t *digest,
     uint8_t payload_digest[SHA256_DIGEST_LENGTH];
     suit_storage_t *storage = component->storage_backend;
 
+#if IS_USED(MODULE_SUIT_DIGEST_STREAM)
+    if (suit_component_check_flag(component, SUIT_COMPONENT_STATE_DIGESTED)) {
+        /* Digest was computed over the payload while fetching it, a
+         * mismatch doesn't need the storage to be read back */
+        if (memcmp(digest, component->payload_digest, SHA256_DIGEST_LENGTH)) {
+            return SUIT_ERR_DIGEST_MISMATCH;
+        }
+        if (IS_ACTIVE(CONFIG_SUIT_DIGEST_STREAM_SKIP_READBACK)) {
+            return SUIT_OK;
+        }
+    }
+#endif
+
     if (suit_storage_has_readptr(storage)) {
         /* Direct read possible */
         const uint8_t *payload = NULL;
@@ -23,6 +23,7 @@
 #include "architecture.h"
 #include "kernel_defines.h"
 #include "log.h"
+#include "macros/utils.h"
 #include "xfa.h"
 
 #include "suit.h"
@@ -52,10 +53,16 @@ static int _flashwrite_start(suit_storage_t *storage,
                              size_t len)
 {
     (void)manifest;
-    (void)len;
     suit_storage_flashwrite_t *fw = _get_fw(storage);
     int target_slot = riotboot_slot_other();
 
+    /* Refuse the image before any page of the slot is erased */
+    if (len > riotboot_slot_size(target_slot)) {
+        LOG_ERROR("Image size %" PRIuSIZE " exceeds slot size %" PRIuSIZE "\n",
+                  len, riotboot_slot_size(target_slot));
+        return SUIT_ERR_STORAGE_EXCEEDED;
+    }
+
     return riotboot_flashwrite_init(&fw->writer, target_slot);
 }
 
@@ -113,10 +120,13 @@ static int _flashwrite_read(suit_storage_t *storage, uint8_t *buf,
     static const size_t _prefix_len = sizeof(_prefix) - 1;
     int target_slot = riotboot_slot_other();
     size_t slot_size = riotboot_slot_size(target_slot);
+    uint8_t *const start = buf;
+    const size_t start_offset = offset;
+    const size_t start_len = len;
 
     /* Insert the "RIOT" magic number */
     if (offset < (_prefix_len)) {
-        size_t prefix_to_copy = _prefix_len - offset;
+        size_t prefix_to_copy = MIN(_prefix_len - offset, len);
         memcpy(buf, _prefix + offset, prefix_to_copy);
         len -= prefix_to_copy;
         offset = _prefix_len;
@@ -130,7 +140,7 @@ static int _flashwrite_read(suit_storage_t *storage, uint8_t *buf,
      * contains the magic number already copied above. */
     if (offset < RIOTBOOT_FLASHPAGE_BUFFER_SIZE) {
         const size_t chunk_remaining =
-            RIOTBOOT_FLASHPAGE_BUFFER_SIZE - _prefix_len;
+            RIOTBOOT_FLASHPAGE_BUFFER_SIZE - offset;
         /* How much of the first page must be copied */
         size_t firstpage_to_copy = len > chunk_remaining ?
             (chunk_remaining) : len;
@@ -152,9 +162,37 @@ static int _flashwrite_read(suit_storage_t *storage, uint8_t *buf,
     uint8_t *slot = (uint8_t *)riotboot_slot_get_hdr(target_slot);
 
     memcpy(buf, slot + offset, len);
+
+    /* The last bytes written may still wait in the write buffer, e.g. when
+     * a delta payload copies from the image reconstructed so far */
+    size_t pending = fw->writer.offset % RIOTBOOT_FLASHPAGE_BUFFER_SIZE;
+    size_t pending_start = fw->writer.offset - pending;
+    size_t from = MAX(MAX(start_offset, pending_start), _prefix_len);
+    size_t to = MIN(start_offset + start_len, fw->writer.offset);
+    if (from < to) {
+        memcpy(start + (from - start_offset),
+               fw->writer.flashpage_buf + (from - pending_start), to - from);
+    }
+
     return 0;
 }
 
+static int _flashwrite_read_installed(suit_storage_t *storage, uint8_t *buf,
+                                      size_t offset, size_t len)
+{
+    (void)storage;
+    int current_slot = riotboot_slot_current();
+
+    if (offset + len > riotboot_slot_size(current_slot)) {
+        return SUIT_ERR_STORAGE;
+    }
+
+    const uint8_t *slot = (const uint8_t *)riotboot_slot_get_hdr(current_slot);
+
+    memcpy(buf, slot + offset, len);
+    return SUIT_OK;
+}
+
 static bool _flashwrite_has_location(const suit_storage_t *storage,
                                      const char *location)
 {
@@ -229,6 +267,7 @@ static const suit_storage_driver_t suit_storage_flashwrite_driver = {
     .write = _flashwrite_write,
     .finish = _flashwrite_finish,
     .read = _flashwrite_read,
+    .read_installed = _flashwrite_read_installed,
     .install = _flashwrite_install,
     .has_location = _flashwrite_has_location,
     .set_active_location = _flashwrite_set_active_location,
@@ -14,29 +14,36 @@
 #include "log.h"
 
 #include "suit.h"
-#include "suit/storage.h"
 #include "suit/transport/mock.h"
 
 /* Must be defined by the test */
 extern const suit_transport_mock_payload_t payloads[];
 extern const size_t num_payloads;
 
-static const suit_component_t *_get_component(const suit_manifest_t *manifest)
-{
-    assert(manifest->component_current < CONFIG_SUIT_COMPONENT_MAX);
-    return &manifest->components[manifest->component_current];
-}
-
-int suit_transport_mock_fetch(const suit_manifest_t *manifest)
+int suit_transport_mock_fetch(const suit_manifest_t *manifest,
+                              suit_transport_mock_cb_t cb, void *ctx)
 {
     size_t file = manifest->component_current;
-    const suit_component_t *comp = _get_component(manifest);
+    size_t offset = 0;
 
     assert(file < num_payloads);
 
     LOG_INFO("Mock writing payload %d\n", (unsigned)file);
 
-    suit_storage_write(comp->storage_backend, manifest, payloads[file].buf, 0,
-                       payloads[file].len);
+    do {
+        size_t len = payloads[file].len - offset;
+        if (len > CONFIG_SUIT_TRANSPORT_MOCK_BLOCKSIZE) {
+            len = CONFIG_SUIT_TRANSPORT_MOCK_BLOCKSIZE;
+        }
+        int more = offset + len < payloads[file].len;
+        /* the callback doesn't modify the block */
+        int res = cb(ctx, offset, (uint8_t *)payloads[file].buf + offset, len,
+                     more);
+        if (res < 0) {
+            return res;
+        }
+        offset += len;
+    } while (offset < payloads[file].len);
+
     return 0;
 }
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_suit_vcdiff
+ * @{
+ *
+ * @file
+ * @brief       SUIT VCDIFF delta payloads
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "architecture.h"
+#include "log.h"
+#include "suit.h"
+#include "suit/storage.h"
+#include "suit/vcdiff.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static int _source_read(void *dev, uint8_t *dest, size_t offset, size_t len)
+{
+    suit_vcdiff_t *ctx = dev;
+
+    return suit_storage_read_installed(ctx->storage, dest, offset, len);
+}
+
+static int _target_read(void *dev, uint8_t *dest, size_t offset, size_t len)
+{
+    suit_vcdiff_t *ctx = dev;
+
+    if (offset + len > ctx->offset + ctx->buf_len) {
+        return SUIT_ERR_STORAGE;
+    }
+
+    /* The delta may copy from the part of the image that is already passed
+     * on to the storage backend */
+    if (offset < ctx->offset) {
+        size_t stored = ctx->offset - offset;
+        if (stored > len) {
+            stored = len;
+        }
+        int res = suit_storage_read(ctx->storage, dest, offset, stored);
+        if (res < 0) {
+            return res;
+        }
+        dest += stored;
+        offset += stored;
+        len -= stored;
+    }
+
+    memcpy(dest, &ctx->buf[offset - ctx->offset], len);
+    return SUIT_OK;
+}
+
+static int _target_write(void *dev, uint8_t *src, size_t offset, size_t len)
+{
+    suit_vcdiff_t *ctx = dev;
+
+    DEBUG("suit_vcdiff: target 0x%" PRIxSIZE " + %" PRIuSIZE "B\n", offset, len);
+
+    /* The image is reconstructed front to back */
+    if (offset != ctx->offset + ctx->buf_len) {
+        return SUIT_ERR_STORAGE;
+    }
+
+    while (len) {
+        size_t to_copy = sizeof(ctx->buf) - ctx->buf_len;
+        if (to_copy > len) {
+            to_copy = len;
+        }
+        memcpy(&ctx->buf[ctx->buf_len], src, to_copy);
+        ctx->buf_len += to_copy;
+        src += to_copy;
+        len -= to_copy;
+
+        if (ctx->buf_len == sizeof(ctx->buf)) {
+            int res = ctx->cb(ctx->arg, ctx->offset, ctx->buf, ctx->buf_len, 1);
+            if (res < 0) {
+                return res;
+            }
+            ctx->offset += ctx->buf_len;
+            ctx->buf_len = 0;
+        }
+    }
+
+    return SUIT_OK;
+}
+
+/* No erase or flush: like the VFS driver of the tinyvcdiff package, the
+ * target only needs read and write, the reconstructed image goes through the
+ * callback and the storage backend takes care of erasing and flushing. */
+static const vcdiff_driver_t _source_driver = {
+    .read = _source_read,
+};
+
+static const vcdiff_driver_t _target_driver = {
+    .read = _target_read,
+    .write = _target_write,
+};
+
+int suit_vcdiff_init(suit_vcdiff_t *ctx, suit_storage_t *storage,
+                     suit_vcdiff_cb_t cb, void *arg)
+{
+    if (!suit_storage_has_installed(storage)) {
+        LOG_ERROR("suit_vcdiff: storage can't provide the installed payload\n");
+        return SUIT_ERR_UNSUPPORTED;
+    }
+
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->storage = storage;
+    ctx->cb = cb;
+    ctx->arg = arg;
+
+    vcdiff_init(&ctx->vcdiff);
+    vcdiff_set_source_driver(&ctx->vcdiff, &_source_driver, ctx);
+    vcdiff_set_target_driver(&ctx->vcdiff, &_target_driver, ctx);
+
+    return SUIT_OK;
+}
+
+int suit_vcdiff_apply(suit_vcdiff_t *ctx, const uint8_t *buf, size_t len)
+{
+    int res = vcdiff_apply_delta(&ctx->vcdiff, buf, len);
+
+    if (res < 0) {
+        LOG_ERROR("suit_vcdiff: applying delta failed: %d\n", res);
+        return res;
+    }
+    ctx->delta_len += len;
+    return res;
+}
+
+int suit_vcdiff_finish(suit_vcdiff_t *ctx)
+{
+    int res = vcdiff_finish(&ctx->vcdiff);
+
+    if (res < 0) {
+        LOG_ERROR("suit_vcdiff: incomplete delta: %d\n", res);
+        return res;
+    }
+
+    res = ctx->cb(ctx->arg, ctx->offset, ctx->buf, ctx->buf_len, 0);
+    ctx->offset += ctx->buf_len;
+    ctx->buf_len = 0;
+    return res;
+}
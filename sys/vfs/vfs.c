@@ -27,6 +27,7 @@
 #include "clist.h"
 #include "compiler_hints.h"
 #include "container.h"
+#include "hashes.h"
 #include "modules.h"
 #include "mutex.h"
 #include "sched.h"
@@ -145,9 +146,30 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
  */
 static inline int _fd_is_valid(int fd);
 
+/**
+ * @internal
+ * @brief Drop all entries of the mount cache
+ *
+ * Must be called with _mount_mutex held, whenever the list of mounts changes.
+ */
+static inline void _mount_cache_clear(void);
+
 static mutex_t _mount_mutex = MUTEX_INIT;
 static mutex_t _open_mutex = MUTEX_INIT;
 
+#if IS_USED(MODULE_VFS_MOUNT_CACHE)
+/**
+ * @internal
+ * @brief Mounts indexed by the hash of the first path component
+ *
+ * Only mount points that consist of a single path component are cached, and
+ * only while no other mount point has the same first component. This makes
+ * the cached mount the longest match for every path starting with that
+ * component. Protected by _mount_mutex, cleared on every mount and umount.
+ */
+static vfs_mount_t *_mount_cache[CONFIG_VFS_MOUNT_CACHE_SIZE];
+#endif
+
 int vfs_close(int fd)
 {
     DEBUG("vfs_close: %d\n", fd);
@@ -356,6 +378,25 @@ ssize_t vfs_read(int fd, void *dest, size_t count)
     return filp->f_op->read(filp, dest, count);
 }
 
+ssize_t vfs_read_ptr(int fd, const void **dest, size_t count)
+{
+    DEBUG("vfs_read_ptr: %d, %p, %" PRIuSIZE "\n", fd, (void *)dest, count);
+    vfs_file_t *filp = NULL;
+
+    int res = _prep_read(fd, dest, &filp);
+    if (res) {
+        DEBUG("vfs_read_ptr: can't open file - %d\n", res);
+        return res;
+    }
+
+    if (filp->f_op->read_ptr == NULL) {
+        /* driver can't provide the file contents */
+        return -ENOTSUP;
+    }
+
+    return filp->f_op->read_ptr(filp, dest, count);
+}
+
 ssize_t vfs_readline(int fd, char *dst, size_t len_max)
 {
     DEBUG("vfs_readline: %d, %p, %" PRIuSIZE "\n", fd, (void *)dst, len_max);
@@ -600,6 +641,7 @@ int vfs_mount(vfs_mount_t *mountp)
     }
     /* Insert last in list. This property is relied on by vfs_iterate_mount_dirs. */
     clist_rpush(&_vfs_mounts_list, &mountp->list_entry);
+    _mount_cache_clear();
     mutex_unlock(&_mount_mutex);
     DEBUG("vfs_mount: mount done\n");
     return 0;
@@ -646,6 +688,7 @@ int vfs_umount(vfs_mount_t *mountp, bool force)
         mutex_unlock(&_mount_mutex);
         return -EINVAL;
     }
+    _mount_cache_clear();
     mutex_unlock(&_mount_mutex);
     return 0;
 }
@@ -1134,17 +1177,96 @@ static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *moun
     return fd;
 }
 
-static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
+#if IS_USED(MODULE_VFS_MOUNT_CACHE)
+/* Length of the first component of @p path, including the leading slash */
+static size_t _first_component_len(const char *path)
+{
+    const char *end = strchr(path + 1, '/');
+
+    return end ? (size_t)(end - path) : strlen(path);
+}
+
+static unsigned _mount_cache_slot(const char *name, size_t len)
+{
+    return djb2_hash((const uint8_t *)name, len) % CONFIG_VFS_MOUNT_CACHE_SIZE;
+}
+
+static vfs_mount_t *_mount_cache_get(const char *name)
+{
+    if (name[0] != '/') {
+        return NULL;
+    }
+
+    size_t len = _first_component_len(name);
+    vfs_mount_t *mountp = _mount_cache[_mount_cache_slot(name, len)];
+
+    if ((mountp != NULL) && (mountp->mount_point_len == len) &&
+        (strncmp(name, mountp->mount_point, len) == 0)) {
+        return mountp;
+    }
+    return NULL;
+}
+
+static void _mount_cache_put(const char *name, vfs_mount_t *mountp)
+{
+    if ((mountp == NULL) || (name[0] != '/')) {
+        return;
+    }
+
+    size_t len = _first_component_len(name);
+    if ((mountp->mount_point_len != len) ||
+        (strncmp(name, mountp->mount_point, len) != 0)) {
+        /* mount point is not the first path component, e.g. a fallback to
+         * "/" or a mount point like "/a/b" */
+        return;
+    }
+
+    /* a mount point like "/a/b" would take precedence over "/a" */
+    clist_node_t *node = _vfs_mounts_list.next;
+    do {
+        node = node->next;
+        vfs_mount_t *it = container_of(node, vfs_mount_t, list_entry);
+        if ((it != mountp) &&
+            (_first_component_len(it->mount_point) == len) &&
+            (strncmp(name, it->mount_point, len) == 0)) {
+            return;
+        }
+    } while (node != _vfs_mounts_list.next);
+
+    _mount_cache[_mount_cache_slot(name, len)] = mountp;
+}
+
+static inline void _mount_cache_clear(void)
+{
+    memset(_mount_cache, 0, sizeof(_mount_cache));
+}
+#else
+static vfs_mount_t *_mount_cache_get(const char *name)
+{
+    (void)name;
+    return NULL;
+}
+
+static void _mount_cache_put(const char *name, vfs_mount_t *mountp)
+{
+    (void)name;
+    (void)mountp;
+}
+
+static inline void _mount_cache_clear(void)
+{
+}
+#endif
+
+static vfs_mount_t *_lookup_mount(const char *name)
 {
     size_t longest_match = 0;
     size_t name_len = strlen(name);
-    mutex_lock(&_mount_mutex);
 
     clist_node_t *node = _vfs_mounts_list.next;
     if (node == NULL) {
         /* list empty */
-        mutex_unlock(&_mount_mutex);
-        return -ENOENT;
+        return NULL;
     }
     vfs_mount_t *mountp = NULL;
     do {
@@ -1172,6 +1294,19 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
             mountp = it;
         }
     } while (node != _vfs_mounts_list.next);
+
+    return mountp;
+}
+
+static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
+{
+    mutex_lock(&_mount_mutex);
+
+    vfs_mount_t *mountp = _mount_cache_get(name);
+    if (mountp == NULL) {
+        mountp = _lookup_mount(name);
+        _mount_cache_put(name, mountp);
+    }
     if (mountp == NULL) {
         /* not found */
         mutex_unlock(&_mount_mutex);
@@ -1190,8 +1325,11 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
     if (rel_path != NULL) {
         if (mountp->fs->flags & VFS_FS_FLAG_WANT_ABS_PATH) {
             *rel_path = name;
+        } else if (mountp->mount_point_len > 1) {
+            *rel_path = name + mountp->mount_point_len;
         } else {
-            *rel_path = name + longest_match;
+            /* special case for mount_point == "/" */
+            *rel_path = name;
         }
     }
     return 0;
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the source address selection of GNRC for packets
+ *              without a fixed source address
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "fmt.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/netif/raw.h"
+#include "net/netdev_test.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define ITERATIONS  (10000U)
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_netif_t _netif;
+static netdev_test_t _dev;
+
+/* source addresses of the interface and destinations they are selected for */
+static const ipv6_addr_t _src[] = {
+    { .u8 = { 0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01 } },
+    { .u8 = { 0xfd, 0x00, 0, 0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01 } },
+    { .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01 } },
+};
+static const ipv6_addr_t _dst[] = {
+    { .u8 = { 0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x42 } },
+    { .u8 = { 0xfd, 0x00, 0, 0x01, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x42 } },
+    { .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x42 } },
+};
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    const uint16_t type = NETDEV_TYPE_SLIP;
+    memcpy(value, &type, sizeof(type));
+    return sizeof(uint16_t);
+}
+
+static int _setup(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    if (gnrc_netif_raw_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                              GNRC_NETIF_PRIO, "netdev_test",
+                              &_dev.netdev.netdev) < 0) {
+        return -1;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_src); i++) {
+        if (gnrc_netif_ipv6_addr_add_internal(&_netif, &_src[i], 64U,
+                        GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) < 0) {
+            return -1;
+        }
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_dst); i++) {
+        ipv6_addr_t *src = gnrc_netif_ipv6_addr_best_src(&_netif, &_dst[i],
+                                                         false);
+        if ((src == NULL) || !ipv6_addr_equal(src, &_src[i])) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int main(void)
+{
+    uint32_t start, stop;
+    unsigned found = 0;
+
+    print_str("Verifying the selected source addresses: ");
+    if (_setup() != 0) {
+        print_str("FAIL\n");
+        return 1;
+    }
+    print_str("OK\n");
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        found += gnrc_netif_ipv6_addr_best_src(&_netif,
+                                               &_dst[i % ARRAY_SIZE(_dst)],
+                                               false) != NULL;
+    }
+    stop = ztimer_now(ZTIMER_USEC);
+
+    print_str("Selecting 10.000 source addresses: ");
+    print_u32_dec(stop - start);
+    print_str(" µs\n");
+
+    /* keep the compiler from optimizing the selection away */
+    return found == 0;
+}
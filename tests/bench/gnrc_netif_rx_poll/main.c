@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure frames received per second by a flooded GNRC
+ *              network interface
+ *
+ * @}
+ */
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "clk.h"
+#include "macros/units.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif/raw.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/netdev_test.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+#ifndef TEST_FRAME_LEN
+#define TEST_FRAME_LEN      (64U)
+#endif
+
+#define NETIF_PRIO          (THREAD_PRIORITY_MAIN - 1)
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_netif_t _netif;
+static netdev_test_t _dev;
+
+static atomic_bool _flooding;
+static uint32_t _received;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    const uint16_t type = NETDEV_TYPE_SLIP;
+    memcpy(value, &type, sizeof(type));
+    return sizeof(uint16_t);
+}
+
+static int _get_rx_poll(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((netopt_enable_t *)value) = NETOPT_ENABLE;
+    return sizeof(netopt_enable_t);
+}
+
+/* behaves like netdev_tap under a flood: report a frame on every interrupt
+ * and trigger the next interrupt after each frame read */
+static void _isr(netdev_t *dev)
+{
+    if (atomic_load(&_flooding)) {
+        dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+    }
+}
+
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)info;
+
+    if (buf == NULL) {
+        if (len > 0) {
+            /* drop frame */
+            return len;
+        }
+        return atomic_load(&_flooding) ? (int)TEST_FRAME_LEN : 0;
+    }
+    memset(buf, 0, len);
+    /* IPv6 version field, so the frame looks like a packet */
+    buf[0] = 0x60;
+    if (atomic_load(&_flooding)) {
+        netdev_trigger_event_isr(dev);
+    }
+    return len;
+}
+
+static void _count(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)cmd;
+    (void)ctx;
+    _received++;
+    gnrc_pktbuf_release(pkt);
+}
+
+static void _timer_callback(void *arg)
+{
+    (void)arg;
+    atomic_store(&_flooding, false);
+}
+
+int main(void)
+{
+    static gnrc_netreg_entry_cbd_t cbd = { .cb = _count };
+    static gnrc_netreg_entry_t entry;
+    ztimer_t timer = { .callback = _timer_callback };
+
+    puts("main starting");
+
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_RX_POLL, _get_rx_poll);
+    netdev_test_set_isr_cb(&_dev, _isr);
+    netdev_test_set_recv_cb(&_dev, _recv);
+    gnrc_netif_raw_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                          NETIF_PRIO, "netdev_test", &_dev.netdev.netdev);
+
+    gnrc_netreg_entry_init_cb(&entry, GNRC_NETREG_DEMUX_CTX_ALL, &cbd);
+    /* without gnrc_ipv6 the raw interface leaves the type undefined */
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &entry);
+
+    atomic_store(&_flooding, true);
+    ztimer_set(ZTIMER_USEC, &timer, TEST_DURATION_US);
+    netdev_trigger_event_isr(&_dev.netdev.netdev);
+
+    /* the interface thread has the higher priority, so this only returns
+     * once the flood is over and all frames were passed up */
+    ztimer_sleep(ZTIMER_USEC, TEST_DURATION_US);
+
+    printf("{ \"result\" : %" PRIu32, _received);
+    printf(", \"ticks\" : %" PRIu32,
+           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1))) /
+           _received);
+    puts(" }");
+
+    return 0;
+}
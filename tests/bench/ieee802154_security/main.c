@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure how many secured IEEE 802.15.4 frames per second can
+ *              be encoded and decoded by a coordinator with per-link keys
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ieee802154.h"
+#include "net/ieee802154_security.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef TEST_PEERS
+#define TEST_PEERS          (4U)
+#endif
+
+#ifndef TEST_FRAMES
+#define TEST_FRAMES         (10000U)
+#endif
+
+#define TEST_PAYLOAD_LEN    (64U)
+
+typedef struct {
+    uint8_t data[IEEE802154_FRAME_LEN_MAX];
+    uint8_t len;
+} frame_t;
+
+static const uint8_t _coord_addr[IEEE802154_LONG_ADDRESS_LEN] = {
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static uint8_t _peer_addr[TEST_PEERS][IEEE802154_LONG_ADDRESS_LEN];
+static uint8_t _peer_key[TEST_PEERS][IEEE802154_SEC_KEY_LENGTH];
+
+static ieee802154_sec_context_t _coord;
+static ieee802154_sec_context_t _peer;
+
+/* frames received from each peer */
+static frame_t _rx[TEST_PEERS];
+
+/* peer the _peer context currently acts as */
+static unsigned _peer_idx;
+
+/* the key of a link is found by the address of the peer */
+static const uint8_t *_coord_key_lookup(const ieee802154_sec_context_t *ctx,
+                                        const uint8_t *mhr, uint8_t mhr_len,
+                                        bool rx)
+{
+    (void)ctx;
+    (void)mhr_len;
+    uint8_t addr[IEEE802154_LONG_ADDRESS_LEN];
+    le_uint16_t pan;
+    int res = rx ? ieee802154_get_src(mhr, addr, &pan)
+                 : ieee802154_get_dst(mhr, addr, &pan);
+
+    if (res != IEEE802154_LONG_ADDRESS_LEN) {
+        return NULL;
+    }
+    for (unsigned i = 0; i < TEST_PEERS; i++) {
+        if (!memcmp(addr, _peer_addr[i], sizeof(addr))) {
+            return _peer_key[i];
+        }
+    }
+    return NULL;
+}
+
+static const uint8_t *_peer_key_lookup(const ieee802154_sec_context_t *ctx,
+                                       const uint8_t *mhr, uint8_t mhr_len,
+                                       bool rx)
+{
+    (void)ctx;
+    (void)mhr;
+    (void)mhr_len;
+    (void)rx;
+    return _peer_key[_peer_idx];
+}
+
+static int _encode(ieee802154_sec_context_t *ctx, frame_t *frame,
+                   const uint8_t *src, const uint8_t *dst,
+                   const uint8_t *payload)
+{
+    uint8_t mic[IEEE802154_SEC_MAX_MAC_SIZE];
+    uint8_t mic_size;
+    uint8_t hdr_len;
+    uint8_t *data;
+    int res;
+
+    hdr_len = ieee802154_set_frame_hdr(frame->data,
+                                       src, IEEE802154_LONG_ADDRESS_LEN,
+                                       dst, IEEE802154_LONG_ADDRESS_LEN,
+                                       byteorder_htols(0x23),
+                                       byteorder_htols(0x23),
+                                       IEEE802154_FCF_TYPE_DATA |
+                                       IEEE802154_FCF_SECURITY_EN, 0);
+    /* the auxiliary header is placed behind the MAC header */
+    data = &frame->data[hdr_len + IEEE802154_SEC_MAX_AUX_HDR_LEN];
+    memcpy(data, payload, TEST_PAYLOAD_LEN);
+    res = ieee802154_sec_encrypt_frame(ctx, frame->data, &hdr_len,
+                                       data, TEST_PAYLOAD_LEN,
+                                       mic, &mic_size, src);
+    if (res) {
+        return res;
+    }
+    memmove(&frame->data[hdr_len], data, TEST_PAYLOAD_LEN);
+    memcpy(&frame->data[hdr_len + TEST_PAYLOAD_LEN], mic, mic_size);
+    frame->len = hdr_len + TEST_PAYLOAD_LEN + mic_size;
+
+    return 0;
+}
+
+static int _decode(ieee802154_sec_context_t *ctx, frame_t *frame,
+                   uint8_t **payload)
+{
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN];
+    uint8_t hdr_len = ieee802154_get_frame_hdr_len(frame->data);
+    uint16_t payload_size;
+    uint8_t *mic;
+    uint8_t mic_size;
+    le_uint16_t pan;
+
+    ieee802154_get_src(frame->data, src, &pan);
+    return ieee802154_sec_decrypt_frame(ctx, frame->len, frame->data,
+                                        &hdr_len, payload, &payload_size,
+                                        &mic, &mic_size, src);
+}
+
+int main(void)
+{
+    static uint8_t payload[TEST_PAYLOAD_LEN];
+    frame_t frame;
+    uint8_t *rx_payload;
+    uint32_t start, encode, decode;
+    bool ok = true;
+
+    for (unsigned i = 0; i < TEST_PAYLOAD_LEN; i++) {
+        payload[i] = i;
+    }
+
+    ieee802154_sec_init(&_coord);
+    ieee802154_sec_init(&_peer);
+    _coord.key_lookup = _coord_key_lookup;
+    _peer.key_lookup = _peer_key_lookup;
+
+    for (unsigned i = 0; i < TEST_PEERS; i++) {
+        _peer_addr[i][0] = 0x02;
+        _peer_addr[i][7] = i + 1;
+        for (unsigned j = 0; j < IEEE802154_SEC_KEY_LENGTH; j++) {
+            _peer_key[i][j] = i * 31 + j;
+        }
+        _peer_idx = i;
+        if (_encode(&_peer, &_rx[i], _peer_addr[i], _coord_addr, payload)) {
+            ok = false;
+        }
+    }
+
+    /* We don't want to check return values in the benchmark loops, so we
+     * just do a simple self test now. */
+    printf("Verifying round trip: ");
+    for (unsigned i = 0; i < TEST_PEERS; i++) {
+        frame = _rx[i];
+        if (_decode(&_coord, &frame, &rx_payload) ||
+            memcmp(rx_payload, payload, TEST_PAYLOAD_LEN)) {
+            ok = false;
+        }
+    }
+    puts(ok ? "OK" : "FAIL");
+
+    printf("Verifying MIC check: ");
+    frame = _rx[0];
+    frame.data[frame.len - 1] ^= 1;
+    puts(_decode(&_coord, &frame, &rx_payload) ==
+         -IEEE802154_SEC_MAC_CHECK_FAILURE ? "OK" : "FAIL");
+
+    printf("Processing %u frames of %u bytes for %u peers\n",
+           TEST_FRAMES, TEST_PAYLOAD_LEN, TEST_PEERS);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_FRAMES; i++) {
+        _encode(&_coord, &frame, _coord_addr, _peer_addr[i % TEST_PEERS],
+                payload);
+    }
+    encode = ztimer_now(ZTIMER_USEC) - start;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_FRAMES; i++) {
+        frame = _rx[i % TEST_PEERS];
+        _decode(&_coord, &frame, &rx_payload);
+    }
+    decode = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("{ \"encode\" : %" PRIu32 ", \"decode\" : %" PRIu32 " }\n",
+           (uint32_t)((uint64_t)TEST_FRAMES * US_PER_SEC / encode),
+           (uint32_t)((uint64_t)TEST_FRAMES * US_PER_SEC / decode));
+
+    return 0;
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("Verifying round trip: OK")
+    child.expect_exact("Verifying MIC check: OK")
+    child.expect(r"{ \"encode\" : \d+, \"decode\" : \d+ }", timeout=30)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
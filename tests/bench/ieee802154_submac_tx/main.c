@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure acknowledged IEEE 802.15.4 frames per second between
+ *              two socket_zep radios
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "atomic_utils.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ieee802154.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+/* frames handed to the sending interface but not yet received */
+#ifndef TEST_IN_FLIGHT
+#define TEST_IN_FLIGHT      (4U)
+#endif
+
+#define TEST_FLAG_RX        (0x1)
+
+/* payload of the frames, to tell them apart from other traffic */
+#define TEST_MAGIC          "RIOTbench"
+#define TEST_PAYLOAD_LEN    (64U)
+
+static uint32_t _received;
+static thread_t *_main;
+
+static void _count(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)cmd;
+    (void)ctx;
+    if ((pkt->size >= sizeof(TEST_MAGIC) - 1) &&
+        (memcmp(pkt->data, TEST_MAGIC, sizeof(TEST_MAGIC) - 1) == 0)) {
+        atomic_store_u32(&_received, atomic_load_u32(&_received) + 1);
+        thread_flags_set(_main, TEST_FLAG_RX);
+    }
+    gnrc_pktbuf_release(pkt);
+}
+
+static int _send(gnrc_netif_t *netif, const uint8_t *dst, size_t dst_len)
+{
+    gnrc_pktsnip_t *pkt, *hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, TEST_PAYLOAD_LEN, GNRC_NETTYPE_UNDEF);
+    if (pkt == NULL) {
+        return -ENOMEM;
+    }
+    memset(pkt->data, 0, TEST_PAYLOAD_LEN);
+    memcpy(pkt->data, TEST_MAGIC, sizeof(TEST_MAGIC) - 1);
+
+    hdr = gnrc_netif_hdr_build(NULL, 0, dst, dst_len);
+    if (hdr == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return -ENOMEM;
+    }
+    pkt = gnrc_pkt_prepend(pkt, hdr);
+
+    return gnrc_netapi_send(netif->pid, pkt) ? 0 : -EIO;
+}
+
+int main(void)
+{
+    static gnrc_netreg_entry_cbd_t cbd = { .cb = _count };
+    static gnrc_netreg_entry_t entry;
+    uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];
+    uint32_t sent = 0, start, now, n;
+
+    gnrc_netif_t *tx = gnrc_netif_iter(NULL);
+    gnrc_netif_t *rx = gnrc_netif_iter(tx);
+
+    if ((tx == NULL) || (rx == NULL) ||
+        (gnrc_netapi_get(rx->pid, NETOPT_ADDRESS_LONG, 0, dst, sizeof(dst)) < 0)) {
+        puts("Two socket_zep interfaces are needed");
+        return 1;
+    }
+
+    _main = thread_get_active();
+    gnrc_netreg_entry_init_cb(&entry, GNRC_NETREG_DEMUX_CTX_ALL, &cbd);
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &entry);
+
+    puts("Sending frames");
+    start = ztimer_now(ZTIMER_USEC);
+    do {
+        while (sent - atomic_load_u32(&_received) < TEST_IN_FLIGHT) {
+            if (_send(tx, dst, sizeof(dst)) < 0) {
+                puts("Unable to send");
+                return 1;
+            }
+            sent++;
+        }
+        thread_flags_wait_any(TEST_FLAG_RX);
+        now = ztimer_now(ZTIMER_USEC);
+    } while (now - start < TEST_DURATION_US);
+    n = atomic_load_u32(&_received);
+
+    printf("{ \"result\" : %" PRIu32 ", \"fps\" : %" PRIu32 " }\n", n,
+           (uint32_t)(((uint64_t)n * 1000000U) / (now - start)));
+
+    return 0;
+}
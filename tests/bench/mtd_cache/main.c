@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for small reads and writes with and without the
+ *              MTD block cache
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "board.h"
+#include "fmt.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mtd_emulated.h"
+#include "ztimer.h"
+
+#define BENCH_SIZE      (16 * 1024U)
+#define BENCH_CHUNK     (16U)
+
+MTD_EMULATED_DEV(0, 4, 16, 256);
+
+static mtd_cache_t _cache_emulated = MTD_CACHE_INIT(&mtd_emulated_dev0.base);
+#ifdef MTD_0
+static mtd_cache_t _cache_board;
+#endif
+
+static uint8_t _chunk[BENCH_CHUNK];
+
+static void _print_result(const char *what, const char *how, uint32_t usec)
+{
+    print_str(what);
+    print_str(" ");
+    print_str(how);
+    print_str(": ");
+    print_u32_dec(usec);
+    print_str(" µs\n");
+}
+
+static void _print_stats(mtd_cache_t *cache)
+{
+    mtd_cache_stats_t stats;
+
+    mtd_cache_stats(cache, &stats);
+    print_str("hits: ");
+    print_u32_dec(stats.hits);
+    print_str(", misses: ");
+    print_u32_dec(stats.misses);
+    print_str(", readahead: ");
+    print_u32_dec(stats.readahead);
+    print_str(", writebacks: ");
+    print_u32_dec(stats.writebacks);
+    print_str("\n");
+}
+
+static uint32_t _read_bytes(mtd_dev_t *dev)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    uint8_t byte;
+
+    for (uint32_t addr = 0; addr < BENCH_SIZE; addr++) {
+        mtd_read(dev, &byte, addr, 1);
+    }
+
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+static uint32_t _write_chunks(mtd_dev_t *dev)
+{
+    mtd_erase(dev, 0, BENCH_SIZE);
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (uint32_t addr = 0; addr < BENCH_SIZE; addr += sizeof(_chunk)) {
+        mtd_write_page_raw(dev, _chunk, 0, addr, sizeof(_chunk));
+    }
+    mtd_flush(dev);
+
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+static bool _verify(mtd_dev_t *dev)
+{
+    uint8_t buf[sizeof(_chunk)];
+
+    for (uint32_t addr = 0; addr < BENCH_SIZE; addr += sizeof(buf)) {
+        mtd_read(dev, buf, addr, sizeof(buf));
+        if (memcmp(buf, _chunk, sizeof(buf))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void _bench(const char *name, mtd_cache_t *cache)
+{
+    mtd_dev_t *parent = cache->parent;
+    mtd_dev_t *dev = &cache->mtd;
+
+    mtd_init(dev);
+
+    print_str(name);
+    print_str(": 16 KiB read byte by byte\n");
+    _print_result(name, "direct", _read_bytes(parent));
+    _print_result(name, "cached", _read_bytes(dev));
+    _print_stats(cache);
+
+    print_str(name);
+    print_str(": 16 KiB written in chunks of 16 bytes\n");
+    _print_result(name, "direct", _write_chunks(parent));
+    _print_result(name, "cached", _write_chunks(dev));
+    _print_stats(cache);
+
+    print_str("Verifying written data: ");
+    print_str(_verify(parent) ? "OK\n" : "FAIL\n");
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_chunk); i++) {
+        _chunk[i] = i;
+    }
+
+    _bench("emulated", &_cache_emulated);
+
+#ifdef MTD_0
+    _cache_board = (mtd_cache_t)MTD_CACHE_INIT(MTD_0);
+    _bench("MTD_0", &_cache_board);
+#endif
+
+    return 0;
+}
@@ -0,0 +1,33 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    while True:
+        idx = child.expect([r"([^:\r\n]+): 16 KiB read byte by byte\r\n",
+                            r"\{ \"threads\""])
+        if idx == 1:
+            break
+        name = child.match.group(1)
+        child.expect(r"{} direct: [0-9]+ µs\r\n".format(name))
+        child.expect(r"{} cached: [0-9]+ µs\r\n".format(name))
+        child.expect(r"hits: [0-9]+, misses: [0-9]+, readahead: [0-9]+, "
+                     r"writebacks: [0-9]+\r\n")
+        child.expect_exact("{}: 16 KiB written in chunks of 16 bytes\r\n".format(name))
+        child.expect(r"{} direct: [0-9]+ µs\r\n".format(name))
+        child.expect(r"{} cached: [0-9]+ µs\r\n".format(name))
+        child.expect(r"hits: [0-9]+, misses: [0-9]+, readahead: [0-9]+, "
+                     r"writebacks: [0-9]+\r\n")
+        child.expect_exact("Verifying written data: OK\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
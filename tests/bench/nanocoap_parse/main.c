@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 ML!PA Consulting GmbH
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for nanocoap message parsing and option lookup
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "fmt.h"
+#include "net/nanocoap.h"
+#include "ztimer.h"
+
+#define ITERATIONS  (10000U)
+
+static uint8_t req[128];
+static size_t req_len;
+
+/* a typical request as sent by a client polling a sensor resource */
+static int _build_request(void)
+{
+    coap_pkt_t pkt;
+    const uint8_t token[] = { 0xde, 0xad, 0xbe, 0xef };
+    const uint8_t etag[] = { 0x12, 0x34, 0x56, 0x78 };
+
+    coap_pkt_init(&pkt, req, sizeof(req),
+                  coap_build_hdr((coap_hdr_t *)req, COAP_TYPE_CON, token, sizeof(token),
+                                 COAP_METHOD_GET, 0x4242));
+    coap_opt_add_string(&pkt, COAP_OPT_URI_HOST, "sensor.example", '\0');
+    coap_opt_add_opaque(&pkt, COAP_OPT_ETAG, etag, sizeof(etag));
+    coap_opt_add_uri_path(&pkt, "/sensors/env/temperature");
+    coap_opt_add_uri_query(&pkt, "unit", "celsius");
+    coap_opt_add_uri_query(&pkt, "avg", "10");
+    coap_opt_add_accept(&pkt, COAP_FORMAT_CBOR);
+    coap_opt_add_uint(&pkt, COAP_OPT_BLOCK2, (2 << 4) | COAP_BLOCKSIZE_64);
+    coap_opt_add_uint(&pkt, COAP_OPT_SIZE2, 0);
+    ssize_t len = coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE);
+    if (len < 0) {
+        return len;
+    }
+    req_len = len;
+    return 0;
+}
+
+/* options a resource handler typically asks for */
+static unsigned _lookup(coap_pkt_t *pkt)
+{
+    uint32_t value = 0;
+    uint8_t *etag;
+    unsigned found = 0;
+
+    found += coap_opt_get_opaque(pkt, COAP_OPT_ETAG, &etag) > 0;
+    found += coap_opt_get_uint(pkt, COAP_OPT_ACCEPT, &value) == 0;
+    found += coap_opt_get_uint(pkt, COAP_OPT_BLOCK2, &value) == 0;
+    found += coap_opt_get_uint(pkt, COAP_OPT_SIZE2, &value) == 0;
+    found += coap_find_option(pkt, COAP_OPT_URI_QUERY) != NULL;
+    found += coap_find_option(pkt, COAP_OPT_CONTENT_FORMAT) != NULL;
+    found += coap_find_option(pkt, COAP_OPT_NO_RESPONSE) != NULL;
+    return found;
+}
+
+int main(void)
+{
+    coap_pkt_t pkt;
+    uint32_t start, stop;
+    unsigned found = 0;
+
+    print_str("Verifying that the benchmark request parses: ");
+    if ((_build_request() != 0) || (coap_parse(&pkt, req, req_len) != 0) ||
+        (_lookup(&pkt) != 5)) {
+        print_str("FAIL\n");
+        return 1;
+    }
+    print_str("OK\n");
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        coap_parse(&pkt, req, req_len);
+    }
+    stop = ztimer_now(ZTIMER_USEC);
+
+    print_str("Parsing 10.000 requests: ");
+    print_u32_dec(stop - start);
+    print_str(" µs\n");
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        found += _lookup(&pkt);
+    }
+    stop = ztimer_now(ZTIMER_USEC);
+
+    print_str("Looking up 7 options in 10.000 requests: ");
+    print_u32_dec(stop - start);
+    print_str(" µs\n");
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        coap_parse(&pkt, req, req_len);
+        found += _lookup(&pkt);
+    }
+    stop = ztimer_now(ZTIMER_USEC);
+
+    print_str("Parsing and looking up 7 options in 10.000 requests: ");
+    print_u32_dec(stop - start);
+    print_str(" µs\n");
+
+    /* keep the compiler from optimizing the lookups away */
+    return found == 0;
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 ML!PA Consulting GmbH
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("Verifying that the benchmark request parses: OK\r\n")
+    child.expect(r"Parsing 10\.000 requests: [0-9]+ µs\r\n")
+    child.expect(r"Looking up 7 options in 10\.000 requests: [0-9]+ µs\r\n")
+    child.expect(r"Parsing and looking up 7 options in 10\.000 requests: [0-9]+ µs\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure frames received per second from a flooded TAP
+ *              interface
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "atomic_utils.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif/conf.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "sched.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+/* payload of the flood frames, to tell them apart from host traffic */
+#define TEST_MAGIC          "RIOTbench"
+
+static uint32_t _received;
+
+static void _count(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)cmd;
+    (void)ctx;
+    if ((pkt->size >= sizeof(TEST_MAGIC) - 1) &&
+        (memcmp(pkt->data, TEST_MAGIC, sizeof(TEST_MAGIC) - 1) == 0)) {
+        atomic_store_u32(&_received, atomic_load_u32(&_received) + 1);
+    }
+    gnrc_pktbuf_release(pkt);
+}
+
+int main(void)
+{
+    static gnrc_netreg_entry_cbd_t cbd = { .cb = _count };
+    static gnrc_netreg_entry_t entry;
+    uint32_t start, stop, n;
+
+    /* a flooded interface thread never blocks, so make sure we are scheduled
+     * when the measurement is over */
+    sched_change_priority(thread_get_active(), GNRC_NETIF_PRIO - 1);
+
+    /* the flood uses an EtherType GNRC does not know */
+    gnrc_netreg_entry_init_cb(&entry, GNRC_NETREG_DEMUX_CTX_ALL, &cbd);
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &entry);
+
+    puts("Waiting for frames");
+    while (atomic_load_u32(&_received) == 0) {
+        ztimer_sleep(ZTIMER_USEC, 10000);
+    }
+
+    n = atomic_load_u32(&_received);
+    start = ztimer_now(ZTIMER_USEC);
+    ztimer_sleep(ZTIMER_USEC, TEST_DURATION_US);
+    stop = ztimer_now(ZTIMER_USEC);
+    n = atomic_load_u32(&_received) - n;
+
+    printf("{ \"result\" : %" PRIu32 ", \"pps\" : %" PRIu32 " }\n", n,
+           (uint32_t)(((uint64_t)n * 1000000U) / (stop - start)));
+
+    return 0;
+}
@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import socket
+import sys
+import threading
+
+from testrunner import run
+
+# broadcast frame with the local experimental EtherType, the payload starts
+# with the magic the node counts
+FRAME = bytes.fromhex("ffffffffffff" "020000000001" "88b5") + \
+    b"RIOTbench".ljust(46, b"\0")
+
+
+def flood(iface, stop):
+    with socket.socket(socket.AF_PACKET, socket.SOCK_RAW) as sock:
+        sock.bind((iface, 0))
+        while not stop.is_set():
+            try:
+                sock.send(FRAME)
+            except OSError:
+                # TAP queue is full, the node is not keeping up
+                pass
+
+
+def testfunc(child):
+    child.expect_exact("Waiting for frames")
+    stop = threading.Event()
+    flooder = threading.Thread(target=flood,
+                               args=(os.environ.get("PORT", "tap0"), stop))
+    flooder.start()
+    try:
+        child.expect(r"{ \"result\" : \d+, \"pps\" : \d+ }", timeout=10)
+    finally:
+        stop.set()
+        flooder.join()
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
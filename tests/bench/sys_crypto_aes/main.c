@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the AES block cipher modes
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "crypto/ciphers.h"
+#include "crypto/modes/cbc.h"
+#include "crypto/modes/ccm.h"
+#include "crypto/modes/ctr.h"
+#include "crypto/modes/ecb.h"
+#include "fmt.h"
+#include "ztimer.h"
+
+#define BENCH_RUNS      (100U)
+#define BENCH_LEN       (1024U)
+#define CCM_MAC_LEN     (8U)
+
+static uint8_t input[BENCH_LEN];
+static uint8_t output[BENCH_LEN + CCM_MAC_LEN];
+
+/* FIPS-197, appendix C.1 */
+static const uint8_t key[16] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+};
+static const uint8_t plain[16] = {
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+    0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff,
+};
+static const uint8_t cipher_text[16] = {
+    0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+    0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a,
+};
+
+static const uint8_t nonce[13] = {
+    0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0xa0,
+    0xa1, 0xa2, 0xa3, 0xa4, 0xa5,
+};
+
+static void _print_result(const char *mode, uint32_t usec)
+{
+    print_str(mode);
+    print_str(": 100 x 1024 bytes: ");
+    print_u32_dec(usec);
+    print_str(" µs\n");
+}
+
+int main(void)
+{
+    cipher_t cipher;
+    uint8_t ctr[16];
+    uint8_t iv[16];
+    uint32_t start;
+    bool ok = true;
+
+    if (cipher_init(&cipher, CIPHER_AES, key, sizeof(key)) != CIPHER_INIT_SUCCESS) {
+        print_str("cipher_init() failed\n");
+        return 1;
+    }
+
+    /* We don't want check return values in the benchmark loops, so we just
+     * do a simple self test now. */
+    print_str("Verifying AES-128 ECB against FIPS-197: ");
+    for (unsigned i = 0; i < BENCH_LEN; i += sizeof(plain)) {
+        memcpy(&input[i], plain, sizeof(plain));
+    }
+    cipher_encrypt_ecb(&cipher, input, BENCH_LEN, output);
+    for (unsigned i = 0; i < BENCH_LEN; i += sizeof(cipher_text)) {
+        ok = ok && !memcmp(&output[i], cipher_text, sizeof(cipher_text));
+    }
+    print_str(ok ? "OK\n" : "FAIL\n");
+
+    print_str("Verifying AES-128 CTR round trip: ");
+    for (unsigned i = 0; i < BENCH_LEN; i++) {
+        input[i] = i;
+    }
+    memset(ctr, 0, sizeof(ctr));
+    cipher_encrypt_ctr(&cipher, ctr, 8, input, BENCH_LEN - 3, output);
+    memset(ctr, 0, sizeof(ctr));
+    cipher_decrypt_ctr(&cipher, ctr, 8, output, BENCH_LEN - 3, output);
+    ok = !memcmp(input, output, BENCH_LEN - 3);
+    print_str(ok ? "OK\n" : "FAIL\n");
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        cipher_encrypt_ecb(&cipher, input, BENCH_LEN, output);
+    }
+    _print_result("ECB", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        memset(iv, 0, sizeof(iv));
+        cipher_encrypt_cbc(&cipher, iv, input, BENCH_LEN, output);
+    }
+    _print_result("CBC", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        memset(ctr, 0, sizeof(ctr));
+        cipher_encrypt_ctr(&cipher, ctr, 8, input, BENCH_LEN, output);
+    }
+    _print_result("CTR", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        cipher_encrypt_ccm(&cipher, NULL, 0, CCM_MAC_LEN, 2, nonce,
+                           sizeof(nonce), input, BENCH_LEN, output);
+    }
+    _print_result("CCM", ztimer_now(ZTIMER_USEC) - start);
+
+    return 0;
+}
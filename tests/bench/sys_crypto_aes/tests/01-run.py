@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("Verifying AES-128 ECB against FIPS-197: OK\r\n")
+    child.expect_exact("Verifying AES-128 CTR round trip: OK\r\n")
+    for mode in ("ECB", "CBC", "CTR", "CCM"):
+        child.expect(r"{}: 100 x 1024 bytes: [0-9]+ µs\r\n".format(mode))
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
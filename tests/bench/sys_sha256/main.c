@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for hashing many messages and scattered buffers
+ *              with SHA-256
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "fmt.h"
+#include "hashes/sha256.h"
+#include "iolist.h"
+#include "ztimer.h"
+
+#define BENCH_RUNS      (100U)
+#define BENCH_MSGS      (32U)
+#define BENCH_MSG_LEN   (64U)
+
+static uint8_t input[BENCH_MSGS * BENCH_MSG_LEN];
+static uint8_t digests[BENCH_MSGS][SHA256_DIGEST_LENGTH];
+static const void *data[BENCH_MSGS];
+static size_t len[BENCH_MSGS];
+static iolist_t chunks[BENCH_MSGS];
+
+static void _print_result(const char *what, const char *unit, uint32_t usec)
+{
+    print_str(what);
+    print_str(", 100 x 32 ");
+    print_str(unit);
+    print_str(" of 64 bytes: ");
+    print_u32_dec(usec);
+    print_str(" µs\n");
+}
+
+int main(void)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    uint32_t start;
+    bool ok = true;
+
+    for (unsigned i = 0; i < sizeof(input); i++) {
+        input[i] = i;
+    }
+    for (unsigned i = 0; i < BENCH_MSGS; i++) {
+        data[i] = &input[i * BENCH_MSG_LEN];
+        len[i] = BENCH_MSG_LEN;
+        chunks[i].iol_next = (i + 1 < BENCH_MSGS) ? &chunks[i + 1] : NULL;
+        chunks[i].iol_base = &input[i * BENCH_MSG_LEN];
+        chunks[i].iol_len = BENCH_MSG_LEN;
+    }
+
+    /* We don't want check return value in the benchmark loop, so we just do
+     * a simple self test now. */
+    print_str("Verifying that sha256_mb() matches sha256(): ");
+    sha256_mb(data, len, BENCH_MSGS, digests);
+    for (unsigned i = 0; i < BENCH_MSGS; i++) {
+        sha256(data[i], len[i], digest);
+        ok = ok && !memcmp(digest, digests[i], sizeof(digest));
+    }
+    print_str(ok ? "OK\n" : "FAIL\n");
+
+    print_str("Verifying that sha256_iolist() matches sha256(): ");
+    sha256_iolist(chunks, digests[0]);
+    sha256(input, sizeof(input), digest);
+    print_str(!memcmp(digest, digests[0], sizeof(digest)) ? "OK\n" : "FAIL\n");
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        for (unsigned j = 0; j < BENCH_MSGS; j++) {
+            sha256(data[j], len[j], digests[j]);
+        }
+    }
+    _print_result("sha256()", "messages",
+                  ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        sha256_mb(data, len, BENCH_MSGS, digests);
+    }
+    _print_result("sha256_mb()", "messages",
+                  ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        sha256_context_t ctx;
+
+        sha256_init(&ctx);
+        for (unsigned j = 0; j < BENCH_MSGS; j++) {
+            sha256_update(&ctx, chunks[j].iol_base, chunks[j].iol_len);
+        }
+        sha256_final(&ctx, digest);
+    }
+    _print_result("sha256_update()", "chunks",
+                  ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        sha256_iolist(chunks, digest);
+    }
+    _print_result("sha256_iolist()", "chunks",
+                  ztimer_now(ZTIMER_USEC) - start);
+
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("Verifying that sha256_mb() matches sha256(): OK\r\n")
+    child.expect_exact("Verifying that sha256_iolist() matches sha256(): OK\r\n")
+    child.expect(r"sha256\(\), 100 x 32 messages of 64 bytes: [0-9]+ µs\r\n")
+    child.expect(r"sha256_mb\(\), 100 x 32 messages of 64 bytes: [0-9]+ µs\r\n")
+    child.expect(r"sha256_update\(\), 100 x 32 chunks of 64 bytes: [0-9]+ µs\r\n")
+    child.expect(r"sha256_iolist\(\), 100 x 32 chunks of 64 bytes: [0-9]+ µs\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
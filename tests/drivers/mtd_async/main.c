@@ -0,0 +1,287 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_async module test
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "event.h"
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mtd_async.h"
+#include "ztimer.h"
+
+/* Test mock object implementing a simple RAM-based mtd with a slow erase */
+#define SECTOR_COUNT        4
+#define PAGE_PER_SECTOR     4
+#define PAGE_SIZE           64
+#define WRITE_SIZE          4
+
+#define SECTOR_SIZE         (PAGE_PER_SECTOR * PAGE_SIZE)
+#define MEMORY_SIZE         (SECTOR_SIZE * SECTOR_COUNT)
+
+#define ERASE_TIME_MS       (50U)
+
+static uint8_t _dummy_memory[MEMORY_SIZE];
+
+static uint8_t _buffer[PAGE_SIZE];
+
+/* operations in the order they reached the device */
+static char _log[8];
+static unsigned _log_len;
+
+static void _log_op(char op)
+{
+    if (_log_len < sizeof(_log)) {
+        _log[_log_len++] = op;
+    }
+}
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    size = MIN(dev->page_size - offset, size);
+
+    memcpy(buff, _dummy_memory + addr, size);
+    _log_op('r');
+
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    size = MIN(dev->page_size - offset, size);
+
+    memcpy(_dummy_memory + addr, buff, size);
+    _log_op('w');
+
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    if (sector + count > dev->sector_count) {
+        return -EOVERFLOW;
+    }
+
+    /* let other threads run while the "device" is busy */
+    ztimer_sleep(ZTIMER_MSEC, ERASE_TIME_MS);
+
+    memset(_dummy_memory + sector * SECTOR_SIZE, 0xff, count * SECTOR_SIZE);
+    _log_op('e');
+
+    return 0;
+}
+
+static const mtd_desc_t driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t _dev = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+    .write_size = WRITE_SIZE,
+};
+
+static mtd_dev_t *dev = &_dev;
+
+static event_queue_t _queue;
+
+static void _done(event_t *event)
+{
+    (void)event;
+}
+
+static mtd_async_req_t _req[3];
+
+static void setup(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_req); i++) {
+        _req[i] = (mtd_async_req_t){
+            .done.handler = _done,
+            .queue = &_queue,
+        };
+    }
+    memset(_dummy_memory, 0, sizeof(_dummy_memory));
+    memset(_buffer, 0, sizeof(_buffer));
+    _log_len = 0;
+}
+
+static mtd_async_req_t *_wait(void)
+{
+    event_t *event = event_wait_timeout_ztimer(&_queue, ZTIMER_MSEC,
+                                               4 * ERASE_TIME_MS);
+    if (event == NULL) {
+        return NULL;
+    }
+    return container_of(event, mtd_async_req_t, done);
+}
+
+static void test_mtd_async_erase_write_read(void)
+{
+    const char data[] = "abcdefghijklmnopqrstuvwxyz";
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_erase_sector(&_req[0], dev, 1, 1));
+    TEST_ASSERT(_wait() == &_req[0]);
+    TEST_ASSERT_EQUAL_INT(0, _req[0].res);
+    TEST_ASSERT_EQUAL_INT(0xff, _dummy_memory[SECTOR_SIZE]);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_write_page_raw(&_req[0], dev, data,
+                                                      PAGE_PER_SECTOR, 8,
+                                                      sizeof(data)));
+    TEST_ASSERT(_wait() == &_req[0]);
+    TEST_ASSERT_EQUAL_INT(0, _req[0].res);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_read_page(&_req[0], dev, _buffer,
+                                                 PAGE_PER_SECTOR, 8,
+                                                 sizeof(data)));
+    TEST_ASSERT(_wait() == &_req[0]);
+    TEST_ASSERT_EQUAL_INT(0, _req[0].res);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_buffer, data, sizeof(data)));
+}
+
+static void test_mtd_async_nonblocking(void)
+{
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_erase_sector(&_req[0], dev, 0, 1));
+    TEST_ASSERT(ztimer_now(ZTIMER_MSEC) - start < ERASE_TIME_MS);
+    TEST_ASSERT(mtd_async_pending(&_req[0]));
+
+    /* a pending request must not be submitted again */
+    TEST_ASSERT_EQUAL_INT(-EBUSY, mtd_async_erase_sector(&_req[0], dev, 1, 1));
+
+    TEST_ASSERT(_wait() == &_req[0]);
+    TEST_ASSERT(!mtd_async_pending(&_req[0]));
+    TEST_ASSERT_EQUAL_INT(0, _req[0].res);
+    TEST_ASSERT(ztimer_now(ZTIMER_MSEC) - start >= ERASE_TIME_MS);
+    TEST_ASSERT_EQUAL_INT(1, _log_len);
+}
+
+static void test_mtd_async_pending_until_delivered(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_read_page(&_req[0], dev, _buffer,
+                                                 0, 0, sizeof(_buffer)));
+    /* let the request complete without taking the completion event */
+    ztimer_sleep(ZTIMER_MSEC, 10);
+    TEST_ASSERT(!_req[0].pending);
+
+    /* posting the queued event again would lose the second completion */
+    TEST_ASSERT(mtd_async_pending(&_req[0]));
+    TEST_ASSERT_EQUAL_INT(-EBUSY, mtd_async_read_page(&_req[0], dev, _buffer,
+                                                      0, 0, sizeof(_buffer)));
+
+    TEST_ASSERT(_wait() == &_req[0]);
+    TEST_ASSERT(!mtd_async_pending(&_req[0]));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_read_page(&_req[0], dev, _buffer,
+                                                 0, 0, sizeof(_buffer)));
+    TEST_ASSERT(_wait() == &_req[0]);
+    TEST_ASSERT_EQUAL_INT(0, _req[0].res);
+}
+
+static void test_mtd_async_order(void)
+{
+    const uint8_t data[] = { 1, 2, 3, 4 };
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_erase_sector(&_req[0], dev, 0, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_write_page_raw(&_req[1], dev, data,
+                                                      0, 0, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_read_page(&_req[2], dev, _buffer,
+                                                 0, 0, sizeof(data)));
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_req); i++) {
+        TEST_ASSERT(_wait() == &_req[i]);
+        TEST_ASSERT_EQUAL_INT(0, _req[i].res);
+    }
+
+    TEST_ASSERT_EQUAL_INT(3, _log_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_log, "ewr", 3));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_buffer, data, sizeof(data)));
+}
+
+static void test_mtd_async_error(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_erase_sector(&_req[0], dev,
+                                                    SECTOR_COUNT, 1));
+    TEST_ASSERT(_wait() == &_req[0]);
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, _req[0].res);
+}
+
+static void test_mtd_async_no_queue(void)
+{
+    _req[0].queue = NULL;
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_async_read_page(&_req[0], dev, _buffer,
+                                                 0, 0, sizeof(_buffer)));
+    while (mtd_async_pending(&_req[0])) {
+        ztimer_sleep(ZTIMER_MSEC, 1);
+    }
+    TEST_ASSERT_EQUAL_INT(0, _req[0].res);
+    TEST_ASSERT(_wait() == NULL);
+}
+
+Test *tests_mtd_async_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_async_erase_write_read),
+        new_TestFixture(test_mtd_async_nonblocking),
+        new_TestFixture(test_mtd_async_pending_until_delivered),
+        new_TestFixture(test_mtd_async_order),
+        new_TestFixture(test_mtd_async_error),
+        new_TestFixture(test_mtd_async_no_queue),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_async_tests, setup, NULL, fixtures);
+
+    return (Test *)&mtd_async_tests;
+}
+
+int main(void)
+{
+    event_queue_init(&_queue);
+    mtd_init(dev);
+
+    TESTS_START();
+    TESTS_RUN(tests_mtd_async_tests());
+    TESTS_END();
+    return 0;
+}
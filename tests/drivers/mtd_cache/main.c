@@ -0,0 +1,343 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_cache module test
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+
+/* Test mock object implementing a simple RAM-based mtd */
+#define SECTOR_COUNT        16
+#define PAGE_PER_SECTOR     4
+#define PAGE_SIZE           64
+#define WRITE_SIZE          4
+
+#define SECTOR_SIZE         (PAGE_PER_SECTOR * PAGE_SIZE)
+#define MEMORY_SIZE         (SECTOR_SIZE * SECTOR_COUNT)
+
+static uint8_t _dummy_memory[MEMORY_SIZE];
+
+static uint8_t _buffer[CONFIG_MTD_CACHE_LINE_SIZE];
+
+/* accesses that reached the backing device */
+static unsigned _bytes_read;
+static unsigned _bytes_written;
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    size = MIN(dev->page_size - offset, size);
+
+    memcpy(buff, _dummy_memory + addr, size);
+    _bytes_read += size;
+
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    size = MIN(dev->page_size - offset, size);
+
+    memcpy(_dummy_memory + addr, buff, size);
+    _bytes_written += size;
+
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    uint32_t addr = sector * dev->page_size * dev->pages_per_sector;
+
+    if (sector + count > dev->sector_count) {
+        return -EOVERFLOW;
+    }
+
+    memset(_dummy_memory + addr, 0xff,
+           count * dev->page_size * dev->pages_per_sector);
+
+    return 0;
+}
+
+static const mtd_desc_t driver = {
+    .init = _init,
+    .read_page    = _read_page,
+    .write_page   = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t dev = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+    .write_size = WRITE_SIZE,
+};
+
+static mtd_cache_t _cache = MTD_CACHE_INIT(&dev);
+
+static mtd_dev_t *_dev = &_cache.mtd;
+
+static void _test_mem(const uint8_t *buffer, size_t len, uint8_t expected)
+{
+    for (size_t i = 0; i < len; i++) {
+        TEST_ASSERT_EQUAL_INT(expected, buffer[i]);
+    }
+}
+
+static void test_mtd_cache_init(void)
+{
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT, _dev->sector_count);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, _dev->pages_per_sector);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, _dev->page_size);
+    TEST_ASSERT_EQUAL_INT(WRITE_SIZE, _dev->write_size);
+}
+
+static void test_mtd_cache_read(void)
+{
+    mtd_cache_stats_t stats;
+    uint8_t byte;
+
+    for (unsigned i = 0; i < sizeof(_dummy_memory); i++) {
+        _dummy_memory[i] = i;
+    }
+
+    /* first access fetches one line */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, &byte, 1, 1));
+    TEST_ASSERT_EQUAL_INT(1, byte);
+    TEST_ASSERT_EQUAL_INT(CONFIG_MTD_CACHE_LINE_SIZE, _bytes_read);
+
+    /* the rest of the line is cached */
+    for (unsigned i = 2; i < CONFIG_MTD_CACHE_LINE_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, &byte, i, 1));
+        TEST_ASSERT_EQUAL_INT(i & 0xff, byte);
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_MTD_CACHE_LINE_SIZE, _bytes_read);
+
+    mtd_cache_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.misses);
+    TEST_ASSERT_EQUAL_INT(CONFIG_MTD_CACHE_LINE_SIZE - 2, stats.hits);
+    TEST_ASSERT_EQUAL_INT(0, stats.readahead);
+
+    /* statistics are reset */
+    mtd_cache_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.misses);
+    TEST_ASSERT_EQUAL_INT(0, stats.hits);
+}
+
+static void test_mtd_cache_readahead(void)
+{
+    mtd_cache_stats_t stats;
+
+    memset(_dummy_memory + SECTOR_SIZE, 0xaa, SECTOR_SIZE);
+
+    /* a read crossing into the next line continues a sequential access */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, SECTOR_SIZE - 8, 16));
+    _test_mem(_buffer, 8, 0xff);
+    _test_mem(_buffer + 8, 8, 0xaa);
+
+    mtd_cache_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(2, stats.misses);
+    TEST_ASSERT_EQUAL_INT(CONFIG_MTD_CACHE_READAHEAD, stats.readahead);
+    TEST_ASSERT_EQUAL_INT((2 + CONFIG_MTD_CACHE_READAHEAD) * CONFIG_MTD_CACHE_LINE_SIZE,
+                          _bytes_read);
+
+    /* lines fetched ahead are hits */
+    _bytes_read = 0;
+    for (unsigned i = 0; i < CONFIG_MTD_CACHE_READAHEAD; i++) {
+        uint8_t byte;
+        uint32_t addr = (2 + i) * CONFIG_MTD_CACHE_LINE_SIZE;
+        TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, &byte, addr, 1));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _bytes_read);
+
+    mtd_cache_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.misses);
+    TEST_ASSERT_EQUAL_INT(CONFIG_MTD_CACHE_READAHEAD, stats.hits);
+}
+
+static void test_mtd_cache_bypass(void)
+{
+    mtd_cache_stats_t stats;
+
+    memset(_dummy_memory, 0xaa, CONFIG_MTD_CACHE_LINE_SIZE);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 0, CONFIG_MTD_CACHE_LINE_SIZE));
+    _test_mem(_buffer, CONFIG_MTD_CACHE_LINE_SIZE, 0xaa);
+
+    memset(_buffer, 0xbb, CONFIG_MTD_CACHE_LINE_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_dev, _buffer, 0,
+                                                CONFIG_MTD_CACHE_LINE_SIZE,
+                                                CONFIG_MTD_CACHE_LINE_SIZE));
+    _test_mem(_dummy_memory + CONFIG_MTD_CACHE_LINE_SIZE,
+              CONFIG_MTD_CACHE_LINE_SIZE, 0xbb);
+
+    mtd_cache_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(2, stats.bypass);
+    TEST_ASSERT_EQUAL_INT(0, stats.misses);
+}
+
+static void test_mtd_cache_write(void)
+{
+    mtd_cache_stats_t stats;
+    uint8_t data[4];
+
+    /* small consecutive writes are collected */
+    for (unsigned i = 0; i < 32; i += sizeof(data)) {
+        memset(data, i, sizeof(data));
+        TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_dev, data, 0, 16 + i,
+                                                    sizeof(data)));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _bytes_written);
+    _test_mem(_dummy_memory + 16, 32, 0xff);
+
+    /* reads see the pending data */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, _buffer, 16, 32));
+    for (unsigned i = 0; i < 32; i++) {
+        TEST_ASSERT_EQUAL_INT(i & ~3, _buffer[i]);
+    }
+
+    /* and they are written back at once */
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(32, _bytes_written);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_buffer, _dummy_memory + 16, 32));
+    _test_mem(_dummy_memory, 16, 0xff);
+    _test_mem(_dummy_memory + 48, CONFIG_MTD_CACHE_LINE_SIZE - 48, 0xff);
+
+    mtd_cache_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.writebacks);
+
+    /* nothing left to write back */
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(32, _bytes_written);
+}
+
+static void test_mtd_cache_write_gap(void)
+{
+    mtd_cache_stats_t stats;
+    uint8_t data[4] = { 0 };
+
+    /* bytes between two writes must not be written */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_dev, data, 0, 0, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_dev, data, 0, 8, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(8, _bytes_written);
+    _test_mem(_dummy_memory, 4, 0);
+    _test_mem(_dummy_memory + 4, 4, 0xff);
+    _test_mem(_dummy_memory + 8, 4, 0);
+
+    mtd_cache_stats(&_cache, &stats);
+    TEST_ASSERT_EQUAL_INT(2, stats.writebacks);
+}
+
+static void test_mtd_cache_evict(void)
+{
+    uint8_t data = 0;
+
+    /* dirty lines are written back when they are evicted, the lines are
+     * written backwards to not trigger read-ahead */
+    for (unsigned i = CONFIG_MTD_CACHE_LINES + 1; i > 0; i--) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_dev, &data, 0,
+                                                    (i - 1) * CONFIG_MTD_CACHE_LINE_SIZE,
+                                                    1));
+    }
+    TEST_ASSERT_EQUAL_INT(1, _bytes_written);
+    TEST_ASSERT_EQUAL_INT(0, _dummy_memory[CONFIG_MTD_CACHE_LINES * CONFIG_MTD_CACHE_LINE_SIZE]);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(CONFIG_MTD_CACHE_LINES + 1, _bytes_written);
+    for (unsigned i = 0; i <= CONFIG_MTD_CACHE_LINES; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _dummy_memory[i * CONFIG_MTD_CACHE_LINE_SIZE]);
+    }
+}
+
+static void test_mtd_cache_erase(void)
+{
+    uint8_t data = 0;
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(_dev, &data, 0, 0, 1));
+
+    /* erasing drops pending writes */
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(_dev, 0, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(_dev));
+    TEST_ASSERT_EQUAL_INT(0, _bytes_written);
+
+    /* and cached data */
+    _dummy_memory[SECTOR_SIZE] = 0;
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, &data, SECTOR_SIZE, 1));
+    TEST_ASSERT_EQUAL_INT(0, data);
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(_dev, 1, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(_dev, &data, SECTOR_SIZE, 1));
+    TEST_ASSERT_EQUAL_INT(0xff, data);
+}
+
+static void set_up(void)
+{
+    memset(_dummy_memory, 0xff, sizeof(_dummy_memory));
+    /* start with an empty cache */
+    mtd_init(_dev);
+    _bytes_read = 0;
+    _bytes_written = 0;
+}
+
+Test *tests_mtd_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_cache_init),
+        new_TestFixture(test_mtd_cache_read),
+        new_TestFixture(test_mtd_cache_readahead),
+        new_TestFixture(test_mtd_cache_bypass),
+        new_TestFixture(test_mtd_cache_write),
+        new_TestFixture(test_mtd_cache_write_gap),
+        new_TestFixture(test_mtd_cache_evict),
+        new_TestFixture(test_mtd_cache_erase),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_cache_tests, set_up, NULL, fixtures);
+
+    return (Test *)&mtd_cache_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_cache_tests());
+    TESTS_END();
+    return 0;
+}
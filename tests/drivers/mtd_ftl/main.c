@@ -0,0 +1,417 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_ftl module test
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mtd_emulated.h"
+#include "mtd_ftl.h"
+
+#define SECTOR_COUNT        16
+#define PAGE_PER_SECTOR     4
+#define PAGE_SIZE           64
+
+#define HOT_WRITES          5000
+
+MTD_EMULATED_DEV(0, SECTOR_COUNT, PAGE_PER_SECTOR, PAGE_SIZE);
+
+static mtd_dev_t *_flash = &mtd_emulated_dev0.base;
+
+/* Test mock object simulating the wear of the emulated flash */
+static unsigned _erases[SECTOR_COUNT];
+/* erases after which a sector fails, 0 for unlimited */
+static unsigned _endurance[SECTOR_COUNT];
+/* sector whose data pages fail to program, -1 for none */
+static int _fail_sector;
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    return mtd_init(_flash);
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    (void)dev;
+
+    return _flash->driver->read_page(_flash, buff, page, offset, size);
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    (void)dev;
+
+    if ((page / PAGE_PER_SECTOR == (unsigned)_fail_sector) && (page % PAGE_PER_SECTOR)) {
+        return -EIO;
+    }
+
+    return _flash->driver->write_page(_flash, buff, page, offset, size);
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    (void)dev;
+
+    for (uint32_t s = sector; s < sector + count; s++) {
+        if (_endurance[s] && (_erases[s] >= _endurance[s])) {
+            return -EIO;
+        }
+        _erases[s]++;
+    }
+
+    return _flash->driver->erase_sector(_flash, sector, count);
+}
+
+static const mtd_desc_t driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t _dev = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+    .write_size = 1,
+};
+
+MTD_FTL_DEV(0, &_dev, SECTOR_COUNT, PAGE_PER_SECTOR, PAGE_SIZE);
+
+static mtd_dev_t *dev = &mtd_ftl_dev0.mtd;
+
+static uint8_t _buffer[PAGE_SIZE];
+
+static unsigned _pages(void)
+{
+    return dev->sector_count * dev->pages_per_sector;
+}
+
+static void _fill(uint8_t value)
+{
+    for (unsigned page = 0; page < _pages(); page++) {
+        memset(_buffer, value + page, sizeof(_buffer));
+        TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(dev, _buffer, page, 0, sizeof(_buffer)));
+    }
+}
+
+static bool _check_page(unsigned page, uint8_t value)
+{
+    uint8_t expected[PAGE_SIZE];
+
+    memset(expected, value, sizeof(expected));
+    if (mtd_read_page(dev, _buffer, page, 0, sizeof(_buffer))) {
+        return false;
+    }
+    return memcmp(_buffer, expected, sizeof(_buffer)) == 0;
+}
+
+static bool _check_fill(unsigned first, uint8_t value)
+{
+    for (unsigned page = first; page < _pages(); page++) {
+        if (!_check_page(page, value + page)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void _write_hot(unsigned count)
+{
+    for (unsigned i = 0; i < count; i++) {
+        uint8_t value = i;
+        TEST_ASSERT_EQUAL_INT(0, mtd_write(dev, &value, i % sizeof(_buffer), 1));
+    }
+}
+
+static void setup(void)
+{
+    mtd_init(_flash);
+    memset(mtd_emulated_dev0.memory, 0xff, mtd_emulated_dev0.size);
+    memset(_erases, 0, sizeof(_erases));
+    memset(_endurance, 0, sizeof(_endurance));
+    _fail_sector = -1;
+
+    mtd_init(dev);
+}
+
+static void test_mtd_ftl_init(void)
+{
+    mtd_ftl_stats_t stats;
+
+    /* one page per sector is taken by the header */
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT - CONFIG_MTD_FTL_SPARE_SECTORS, dev->sector_count);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR - 1, dev->pages_per_sector);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, dev->page_size);
+
+    mtd_ftl_stats(&mtd_ftl_dev0, &stats);
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT, stats.free);
+    TEST_ASSERT_EQUAL_INT(0, stats.bad);
+
+    TEST_ASSERT(_check_page(0, 0xff));
+    TEST_ASSERT(_check_page(_pages() - 1, 0xff));
+}
+
+static void test_mtd_ftl_write_read(void)
+{
+    const char data[] = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, "
+                        "sed do eiusmod tempor incididunt ut labore et dolore magna";
+    char buf[sizeof(data)];
+
+    /* crosses a page boundary */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(dev, data, PAGE_SIZE + 40, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(dev, buf, PAGE_SIZE + 40, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, buf, sizeof(data)));
+
+    /* the rest of the pages is untouched */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(dev, _buffer, 1, 0, 40));
+    for (unsigned i = 0; i < 40; i++) {
+        TEST_ASSERT_EQUAL_INT(0xff, _buffer[i]);
+    }
+    TEST_ASSERT(_check_page(0, 0xff));
+
+    /* overwrite without erasing */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write(dev, "xyz", PAGE_SIZE + 41, 3));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(dev, buf, PAGE_SIZE + 40, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp("Lxyzm", buf, 5));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data + 5, buf + 5, sizeof(data) - 5));
+
+    /* out of bounds */
+    TEST_ASSERT_EQUAL_INT(-EOVERFLOW, mtd_write_page_raw(dev, data, _pages(), 0, 1));
+}
+
+static void test_mtd_ftl_remount(void)
+{
+    _fill(0);
+    _write_hot(200);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(dev));
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(dev, _buffer, 0, 0, sizeof(_buffer)));
+    for (unsigned i = 0; i < sizeof(_buffer); i++) {
+        /* the last write of each byte */
+        unsigned last = i + sizeof(_buffer) * ((200 - 1 - i) / sizeof(_buffer));
+        TEST_ASSERT_EQUAL_INT((uint8_t)last, _buffer[i]);
+    }
+    TEST_ASSERT(_check_fill(1, 0));
+
+    /* writing continues after the remount */
+    _fill(0x40);
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(dev));
+    TEST_ASSERT(_check_fill(0, 0x40));
+}
+
+static void test_mtd_ftl_erase(void)
+{
+    mtd_ftl_stats_t stats;
+
+    _fill(0);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(dev, 1, 1));
+    for (unsigned page = 0; page < _pages(); page++) {
+        bool erased = (page / dev->pages_per_sector) == 1;
+        TEST_ASSERT(_check_page(page, erased ? 0xff : page));
+    }
+
+    /* the erase is persistent */
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(dev));
+    for (unsigned page = 0; page < _pages(); page++) {
+        bool erased = (page / dev->pages_per_sector) == 1;
+        TEST_ASSERT(_check_page(page, erased ? 0xff : page));
+    }
+
+    /* erasing erased sectors takes no flash page */
+    mtd_ftl_stats(&mtd_ftl_dev0, &stats);
+    uint16_t free = stats.free;
+    for (unsigned i = 0; i < 10; i++) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(dev, 1, 1));
+    }
+    mtd_ftl_stats(&mtd_ftl_dev0, &stats);
+    TEST_ASSERT_EQUAL_INT(free, stats.free);
+}
+
+static void test_mtd_ftl_erase_gc(void)
+{
+    const uint8_t pages[] = { 7, 3, 4, 5 };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(pages); i++) {
+        memset(_buffer, pages[i], sizeof(_buffer));
+        TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(dev, _buffer, pages[i], 0, sizeof(_buffer)));
+    }
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(dev, 1, 1));
+
+    /* garbage collects the sector recording the erase, while the stale
+     * copies of the erased pages are still on the flash */
+    for (unsigned i = 0; i < 60; i++) {
+        memset(_buffer, i, sizeof(_buffer));
+        TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(dev, _buffer, 0, 0, sizeof(_buffer)));
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(dev));
+    TEST_ASSERT(_check_page(0, 59));
+    TEST_ASSERT(_check_page(3, 0xff));
+    TEST_ASSERT(_check_page(4, 0xff));
+    TEST_ASSERT(_check_page(5, 0xff));
+    TEST_ASSERT(_check_page(7, 7));
+
+    /* a page written after the erase is not erased again */
+    memset(_buffer, 0x44, sizeof(_buffer));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(dev, _buffer, 4, 0, sizeof(_buffer)));
+    for (unsigned i = 0; i < 60; i++) {
+        memset(_buffer, i, sizeof(_buffer));
+        TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(dev, _buffer, 0, 0, sizeof(_buffer)));
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(dev));
+    TEST_ASSERT(_check_page(3, 0xff));
+    TEST_ASSERT(_check_page(4, 0x44));
+    TEST_ASSERT(_check_page(5, 0xff));
+    TEST_ASSERT(_check_page(7, 7));
+}
+
+static void test_mtd_ftl_wear_leveling(void)
+{
+    mtd_ftl_stats_t stats;
+    unsigned min = UINT16_MAX;
+    unsigned max = 0;
+
+    /* cold data on all pages, a single page is written over and over */
+    _fill(0);
+    _write_hot(HOT_WRITES);
+
+    mtd_ftl_stats(&mtd_ftl_dev0, &stats);
+    for (unsigned s = 0; s < SECTOR_COUNT; s++) {
+        min = MIN(min, _erases[s]);
+        max = MAX(max, _erases[s]);
+    }
+
+    TEST_ASSERT(stats.wl_moves > 0);
+    TEST_ASSERT(max - min <= CONFIG_MTD_FTL_WEAR_THRESHOLD + 1);
+    TEST_ASSERT(stats.erase_max - stats.erase_min <= CONFIG_MTD_FTL_WEAR_THRESHOLD + 1);
+    TEST_ASSERT_EQUAL_INT(max, stats.erase_max);
+    /* far below one erase per write, as without translation */
+    TEST_ASSERT(max < HOT_WRITES / 10);
+
+    TEST_ASSERT(_check_fill(1, 0));
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(dev));
+    TEST_ASSERT(_check_fill(1, 0));
+
+    /* the erase counts are persistent */
+    mtd_ftl_stats(&mtd_ftl_dev0, &stats);
+    TEST_ASSERT_EQUAL_INT(max, stats.erase_max);
+    TEST_ASSERT_EQUAL_INT(min, stats.erase_min);
+}
+
+static void test_mtd_ftl_bad_erase(void)
+{
+    mtd_ftl_stats_t stats;
+
+    _endurance[3] = 2;
+
+    _fill(0);
+    _write_hot(500);
+
+    mtd_ftl_stats(&mtd_ftl_dev0, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.bad);
+    TEST_ASSERT_EQUAL_INT(2, _erases[3]);
+    TEST_ASSERT(_check_fill(1, 0));
+
+    /* the sector stays bad */
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(dev));
+    _write_hot(500);
+    mtd_ftl_stats(&mtd_ftl_dev0, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.bad);
+    TEST_ASSERT_EQUAL_INT(2, _erases[3]);
+    TEST_ASSERT(_check_fill(1, 0));
+}
+
+static void test_mtd_ftl_bad_write(void)
+{
+    mtd_ftl_stats_t stats;
+
+    _fail_sector = 5;
+
+    _fill(0);
+    _write_hot(500);
+
+    mtd_ftl_stats(&mtd_ftl_dev0, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.bad);
+    TEST_ASSERT(_check_fill(1, 0));
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_init(dev));
+    mtd_ftl_stats(&mtd_ftl_dev0, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.bad);
+    TEST_ASSERT(_check_fill(1, 0));
+}
+
+static void test_mtd_ftl_gc(void)
+{
+    mtd_ftl_stats_t stats;
+    unsigned steps = 0;
+    int res;
+
+    _fill(0);
+    _fill(0x80);
+
+    mtd_ftl_stats(&mtd_ftl_dev0, &stats);
+    uint16_t free = stats.free;
+    TEST_ASSERT(free < CONFIG_MTD_FTL_GC_FREE_SECTORS);
+
+    while ((res = mtd_ftl_gc(&mtd_ftl_dev0)) == 1) {
+        TEST_ASSERT(++steps < SECTOR_COUNT);
+    }
+    TEST_ASSERT_EQUAL_INT(0, res);
+    TEST_ASSERT(steps > 0);
+
+    mtd_ftl_stats(&mtd_ftl_dev0, &stats);
+    TEST_ASSERT(stats.free > free);
+    TEST_ASSERT(_check_fill(0, 0x80));
+}
+
+Test *tests_mtd_ftl_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_ftl_init),
+        new_TestFixture(test_mtd_ftl_write_read),
+        new_TestFixture(test_mtd_ftl_remount),
+        new_TestFixture(test_mtd_ftl_erase),
+        new_TestFixture(test_mtd_ftl_erase_gc),
+        new_TestFixture(test_mtd_ftl_wear_leveling),
+        new_TestFixture(test_mtd_ftl_bad_erase),
+        new_TestFixture(test_mtd_ftl_bad_write),
+        new_TestFixture(test_mtd_ftl_gc),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_ftl_tests, setup, NULL, fixtures);
+
+    return (Test *)&mtd_ftl_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_ftl_tests());
+    TESTS_END();
+    return 0;
+}
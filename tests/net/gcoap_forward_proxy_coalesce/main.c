@@ -0,0 +1,249 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests for coalescing requests in the gcoap forward proxy
+ *
+ * Clients send requests through the proxy to a scripted origin server on the
+ * loopback interface. The origin server collects the requests that reach it
+ * before answering them, so the requests of all clients are outstanding at
+ * the proxy at the same time.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/gcoap.h"
+#include "net/sock/udp.h"
+#include "thread.h"
+
+#define ORIGIN_PORT         (5684U)
+#define CLIENT_PORT         (6000U)
+#define CLIENT_NUMOF        (3U)
+#define ORIGIN_REQS_MAX     (4U)
+/* time the origin server waits for further requests before answering */
+#define COLLECT_TIMEOUT_US  (50U * US_PER_MS)
+#define RESP_TIMEOUT_US     (500U * US_PER_MS)
+
+typedef struct {
+    uint8_t buf[64];
+    size_t len;
+} _request_t;
+
+static const uint8_t _etag[] = { 0xe7, 0x46 };
+static const char _payload[] = "hello";
+
+static char _origin_stack[THREAD_STACKSIZE_DEFAULT];
+static sock_udp_t _origin_sock;
+static sock_udp_ep_t _proxy_ep;
+static _request_t _pending[ORIGIN_REQS_MAX];
+static uint8_t _origin_buf[64];
+static volatile unsigned _origin_reqs;
+
+static sock_udp_t _clients[CLIENT_NUMOF];
+static uint8_t _client_buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+
+static void _origin_reply(const coap_pkt_t *req)
+{
+    unsigned code = (coap_get_code_raw(req) == COAP_METHOD_GET) ?
+                    COAP_CODE_CONTENT : COAP_CODE_CHANGED;
+    uint8_t *pos = _origin_buf;
+
+    pos += coap_build_hdr((coap_hdr_t *)pos, COAP_TYPE_ACK, coap_get_token(req),
+                          coap_get_token_len(req), code, coap_get_id(req));
+    pos += coap_put_option(pos, 0, COAP_OPT_ETAG, _etag, sizeof(_etag));
+    *pos++ = 0xFF;
+    memcpy(pos, _payload, sizeof(_payload) - 1);
+    pos += sizeof(_payload) - 1;
+
+    sock_udp_send(&_origin_sock, _origin_buf, pos - _origin_buf, &_proxy_ep);
+}
+
+static void *_origin(void *arg)
+{
+    (void)arg;
+    unsigned numof = 0;
+
+    while (1) {
+        _request_t *req = &_pending[numof];
+        ssize_t res = sock_udp_recv(&_origin_sock, req->buf, sizeof(req->buf),
+                                    numof ? COLLECT_TIMEOUT_US : SOCK_NO_TIMEOUT,
+                                    &_proxy_ep);
+        if (res > 0) {
+            coap_pkt_t pkt;
+
+            if ((coap_parse(&pkt, req->buf, res) < 0) ||
+                (coap_get_code_class(&pkt) != COAP_CLASS_REQ)) {
+                continue;
+            }
+            _origin_reqs++;
+            req->len = res;
+            if (++numof < ORIGIN_REQS_MAX) {
+                continue;
+            }
+        }
+        else if (numof == 0) {
+            continue;
+        }
+
+        while (numof) {
+            coap_pkt_t pkt;
+
+            req = &_pending[--numof];
+            coap_parse(&pkt, req->buf, req->len);
+            _origin_reply(&pkt);
+        }
+    }
+
+    return NULL;
+}
+
+static void _request(unsigned client, unsigned method, const char *path,
+                     uint8_t token, uint16_t id, bool etag)
+{
+    sock_udp_ep_t proxy = {
+        .family = AF_INET6,
+        .addr = IPV6_ADDR_LOOPBACK,
+        .port = CONFIG_GCOAP_PORT,
+    };
+    char uri[32] = "coap://[::1]:5684/";
+    uint8_t buf[64];
+    uint8_t *pos = buf;
+    uint16_t lastonum = 0;
+
+    strcat(uri, path);
+    pos += coap_build_hdr((coap_hdr_t *)pos, COAP_TYPE_CON, &token, 1, method, id);
+    if (etag) {
+        pos += coap_put_option(pos, lastonum, COAP_OPT_ETAG, _etag, sizeof(_etag));
+        lastonum = COAP_OPT_ETAG;
+    }
+    pos += coap_opt_put_proxy_uri(pos, lastonum, uri);
+
+    sock_udp_send(&_clients[client], buf, pos - buf, &proxy);
+}
+
+static void _expect_response(unsigned client, unsigned code, uint8_t token,
+                             uint16_t id)
+{
+    coap_pkt_t pkt;
+    ssize_t res = sock_udp_recv(&_clients[client], _client_buf,
+                                sizeof(_client_buf), RESP_TIMEOUT_US, NULL);
+
+    TEST_ASSERT(res > 0);
+    TEST_ASSERT_EQUAL_INT(0, coap_parse(&pkt, _client_buf, res));
+    TEST_ASSERT_EQUAL_INT(COAP_TYPE_ACK, coap_get_type(&pkt));
+    TEST_ASSERT_EQUAL_INT(id, coap_get_id(&pkt));
+    TEST_ASSERT_EQUAL_INT(1, coap_get_token_len(&pkt));
+    TEST_ASSERT_EQUAL_INT(token, *(uint8_t *)coap_get_token(&pkt));
+    TEST_ASSERT_EQUAL_INT(code, coap_get_code_raw(&pkt));
+
+    uint8_t *etag;
+    TEST_ASSERT_EQUAL_INT(sizeof(_etag), coap_opt_get_opaque(&pkt, COAP_OPT_ETAG, &etag));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_etag, etag, sizeof(_etag)));
+    if (code == COAP_CODE_VALID) {
+        TEST_ASSERT_EQUAL_INT(0, pkt.payload_len);
+    }
+    else {
+        TEST_ASSERT_EQUAL_INT(sizeof(_payload) - 1, pkt.payload_len);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(_payload, pkt.payload, pkt.payload_len));
+    }
+}
+
+static void _expect_no_response(unsigned client)
+{
+    TEST_ASSERT_EQUAL_INT(-ETIMEDOUT,
+                          sock_udp_recv(&_clients[client], _client_buf,
+                                        sizeof(_client_buf), RESP_TIMEOUT_US, NULL));
+}
+
+static void set_up(void)
+{
+    _origin_reqs = 0;
+}
+
+static void test_coalesce_get(void)
+{
+    _request(0, COAP_METHOD_GET, "a", 0x10, 0x100, false);
+    _request(1, COAP_METHOD_GET, "a", 0x11, 0x101, false);
+    /* the ETag is not part of the cache key, but gets its own answer */
+    _request(2, COAP_METHOD_GET, "a", 0x12, 0x102, true);
+
+    _expect_response(0, COAP_CODE_CONTENT, 0x10, 0x100);
+    _expect_response(1, COAP_CODE_CONTENT, 0x11, 0x101);
+    _expect_response(2, COAP_CODE_VALID, 0x12, 0x102);
+    TEST_ASSERT_EQUAL_INT(1, _origin_reqs);
+}
+
+static void test_coalesce_retransmission(void)
+{
+    _request(0, COAP_METHOD_GET, "b", 0x20, 0x200, false);
+    _request(1, COAP_METHOD_GET, "b", 0x21, 0x201, false);
+    _request(1, COAP_METHOD_GET, "b", 0x21, 0x201, false);
+
+    _expect_response(0, COAP_CODE_CONTENT, 0x20, 0x200);
+    _expect_response(1, COAP_CODE_CONTENT, 0x21, 0x201);
+    _expect_no_response(1);
+    TEST_ASSERT_EQUAL_INT(1, _origin_reqs);
+}
+
+static void test_no_coalesce_post(void)
+{
+    _request(0, COAP_METHOD_POST, "c", 0x30, 0x300, false);
+    _request(1, COAP_METHOD_POST, "c", 0x31, 0x301, false);
+
+    _expect_response(0, COAP_CODE_CHANGED, 0x30, 0x300);
+    _expect_response(1, COAP_CODE_CHANGED, 0x31, 0x301);
+    TEST_ASSERT_EQUAL_INT(2, _origin_reqs);
+}
+
+static void test_no_coalesce_other_resource(void)
+{
+    _request(0, COAP_METHOD_GET, "d", 0x40, 0x400, false);
+    _request(1, COAP_METHOD_GET, "e", 0x41, 0x401, false);
+
+    _expect_response(0, COAP_CODE_CONTENT, 0x40, 0x400);
+    _expect_response(1, COAP_CODE_CONTENT, 0x41, 0x401);
+    TEST_ASSERT_EQUAL_INT(2, _origin_reqs);
+}
+
+static Test *tests_gcoap_forward_proxy_coalesce(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_coalesce_get),
+        new_TestFixture(test_coalesce_retransmission),
+        new_TestFixture(test_no_coalesce_post),
+        new_TestFixture(test_no_coalesce_other_resource),
+    };
+
+    EMB_UNIT_TESTCALLER(gcoap_forward_proxy_coalesce_tests, set_up, NULL, fixtures);
+    return (Test *)&gcoap_forward_proxy_coalesce_tests;
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = { .family = AF_INET6, .port = ORIGIN_PORT };
+
+    sock_udp_create(&_origin_sock, &local, NULL, 0);
+    for (unsigned i = 0; i < CLIENT_NUMOF; i++) {
+        local.port = CLIENT_PORT + i;
+        sock_udp_create(&_clients[i], &local, NULL, 0);
+    }
+    thread_create(_origin_stack, sizeof(_origin_stack), THREAD_PRIORITY_MAIN - 1,
+                  0, _origin, NULL, "origin server");
+
+    TESTS_START();
+    TESTS_RUN(tests_gcoap_forward_proxy_coalesce());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the adaptive LWMAC wake-up interval
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "shell.h"
+
+#include "net/gnrc.h"
+#include "net/gnrc/mac/types.h"
+#include "net/gnrc/pktdump.h"
+
+static int _mac_cmd(int argc, char **argv)
+{
+    if ((argc < 2) || (strcmp(argv[1], "duty") != 0)) {
+        printf("usage: %s duty\n", argv[0]);
+        return 1;
+    }
+
+    gnrc_netif_t *netif = gnrc_netif_iter(NULL);
+    if (netif == NULL) {
+        puts("error: no interface");
+        return 1;
+    }
+
+    /* the interface prints its statistics when handling the message */
+    msg_t msg = { .type = GNRC_MAC_TYPE_GET_DUTYCYCLE };
+    msg_send(&msg, netif->pid);
+    return 0;
+}
+
+SHELL_COMMAND(mac, "print LWMAC radio duty-cycle statistics", _mac_cmd);
+
+int main(void)
+{
+    puts("LWMAC adaptive wake-up test application");
+
+    gnrc_netreg_entry_t dump = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                          gnrc_pktdump_pid);
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &dump);
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(NULL, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import signal
+import sys
+import time
+
+import pexpect
+from testrunner import run
+
+
+MEDIUM = "lwmac_adaptive"
+RECEIVER = "00:00:00:00:00:00:00:01"
+SENDER = "00:00:00:00:00:00:00:02"
+BURST = 8
+
+received = 0
+
+
+def wakeup_level(child):
+    """Query the receiver's wake-up level, counting the packets dumped
+    in-between"""
+    global received
+    child.sendline("mac duty")
+    while child.expect([r"PKTDUMP: data received:",
+                        r"wake-up interval: \d+ us \(level (\d+)\)"]) == 0:
+        received += 1
+    return int(child.match.group(1))
+
+
+def testfunc(child):
+    child.expect_exact("LWMAC adaptive wake-up test application")
+    sender = pexpect.spawnu(os.environ["ELFFILE"],
+                            ["-z", "shm:" + MEDIUM, "--eui64=" + SENDER],
+                            timeout=10)
+    try:
+        sender.expect_exact("LWMAC adaptive wake-up test application")
+        # give both nodes time to learn about each other's wake-up phase
+        time.sleep(1)
+        assert wakeup_level(child) == 0
+
+        # a burst of packets makes the receiver wake up more often
+        for i in range(BURST):
+            sender.sendline("txtsnd 4 {} burst{}".format(RECEIVER, i))
+        levels = []
+        for _ in range(10):
+            time.sleep(0.1)
+            levels.append(wakeup_level(child))
+        assert max(levels) > 0, levels
+
+        # ... and it falls back to the configured interval when idle
+        time.sleep(2)
+        assert wakeup_level(child) == 0
+        assert received == BURST, received
+
+        sender.sendline("mac duty")
+        sender.expect(r"sent: {}, MAC delay avg: \d+ us".format(BURST))
+    finally:
+        # also stop the helper processes native forks for async I/O
+        os.killpg(sender.pid, signal.SIGKILL)
+        sender.wait()
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=10))
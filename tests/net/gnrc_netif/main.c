@@ -29,6 +29,7 @@
 #include "net/ipv6.h"
 #include "net/gnrc.h"
 #include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/ipv6/nib/pl.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/netif.h"
 #include "net/gnrc/netif/ethernet.h"
@@ -543,6 +544,86 @@ static void test_ipv6_addr_best_src__deprecated_addr(void)
     TEST_ASSERT(!ipv6_addr_equal(&src, out));
 }
 
+static void test_ipv6_addr_best_src__addr_change(void)
+{
+    static const ipv6_addr_t ula_src = { .u8 = NETIF0_IPV6_ULA };
+    static const ipv6_addr_t ula_dst = { .u8 = { ULA1, ULA2, ULA3, ULA4,
+                                                 ULA5, ULA6, ULA7, ULA8,
+                                                 0, 0, 0, 0, 0, 0, 0, 1 } };
+    ipv6_addr_t *out = NULL;
+    int idx;
+
+    test_ipv6_addr_add__success();  /* adds link-local address */
+    TEST_ASSERT(0 <= (idx = gnrc_netif_ipv6_addr_add_internal(&netifs[0], &ula_src, 64U,
+                                                     GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_TENTATIVE)));
+    /* tentative addresses must not be selected */
+    TEST_ASSERT_NOT_NULL((out = gnrc_netif_ipv6_addr_best_src(&netifs[0],
+                                                              &ula_dst,
+                                                              false)));
+    TEST_ASSERT(!ipv6_addr_equal(&ula_src, out));
+    /* address becomes valid the way the NIB does it after DAD */
+    netifs[0].ipv6.addrs_flags[idx] = GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID;
+    TEST_ASSERT_NOT_NULL((out = gnrc_netif_ipv6_addr_best_src(&netifs[0],
+                                                              &ula_dst,
+                                                              false)));
+    TEST_ASSERT(ipv6_addr_equal(&ula_src, out));
+    /* same result when asked again */
+    TEST_ASSERT(out == gnrc_netif_ipv6_addr_best_src(&netifs[0], &ula_dst,
+                                                     false));
+    gnrc_netif_ipv6_addr_remove_internal(&netifs[0], &ula_src);
+    TEST_ASSERT_NOT_NULL((out = gnrc_netif_ipv6_addr_best_src(&netifs[0],
+                                                              &ula_dst,
+                                                              false)));
+    TEST_ASSERT(!ipv6_addr_equal(&ula_src, out));
+    TEST_ASSERT(ipv6_addr_is_link_local(out));
+}
+
+static void test_ipv6_addr_best_src__prefix_change(void)
+{
+    static const ipv6_addr_t pfx = { .u8 = { GP1, GP2, GP3, GP4,
+                                             0xff, 0xff, 0, 0 } };
+    static const ipv6_addr_t src1 = { .u8 = { GP1, GP2, GP3, GP4,
+                                              0xff, 0xff, 0, 0,
+                                              0, 0, 0, 0, 0, 0, 0, 1 } };
+    static const ipv6_addr_t src2 = { .u8 = { GP1, GP2, GP3, GP4,
+                                              0xff, 0xff, 0, 0,
+                                              0, 0, 0, 0, 0, 0, 0, 4 } };
+    static const ipv6_addr_t dst = { .u8 = { GP1, GP2, GP3, GP4,
+                                             0xff, 0xff, 0, 0,
+                                             0, 0, 0, 0, 0, 0, 0, 5 } };
+    gnrc_ipv6_nib_pl_t ple;
+    void *state = NULL;
+    ipv6_addr_t *out = NULL;
+    int idx1, idx2;
+
+    /* prefixes left by other tests would cap the match as well */
+    while (gnrc_ipv6_nib_pl_iter(netifs[0].pid, &state, &ple)) {
+        gnrc_ipv6_nib_pl_del(netifs[0].pid, &ple.pfx, ple.pfx_len);
+        state = NULL;
+    }
+    /* tentative addresses don't add their prefix to the prefix list */
+    TEST_ASSERT(0 <= (idx1 = gnrc_netif_ipv6_addr_add_internal(&netifs[0], &src1, 64U,
+                                                      GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_TENTATIVE)));
+    TEST_ASSERT(0 <= (idx2 = gnrc_netif_ipv6_addr_add_internal(&netifs[0], &src2, 64U,
+                                                      GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_TENTATIVE)));
+    netifs[0].ipv6.addrs_flags[idx1] = GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID;
+    netifs[0].ipv6.addrs_flags[idx2] = GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID;
+    /* rule 8: src2 has the longest matching prefix with dst */
+    TEST_ASSERT_NOT_NULL((out = gnrc_netif_ipv6_addr_best_src(&netifs[0],
+                                                              &dst, false)));
+    TEST_ASSERT(ipv6_addr_equal(&src2, out));
+    /* the prefix caps the match of both addresses at 64, so the first one
+     * wins */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_pl_set(netifs[0].pid, &pfx, 64U,
+                                                  UINT32_MAX, UINT32_MAX));
+    TEST_ASSERT_NOT_NULL((out = gnrc_netif_ipv6_addr_best_src(&netifs[0],
+                                                              &dst, false)));
+    TEST_ASSERT(ipv6_addr_equal(&src1, out));
+    gnrc_ipv6_nib_pl_del(netifs[0].pid, &pfx, 64U);
+    gnrc_netif_ipv6_addr_remove_internal(&netifs[0], &src1);
+    gnrc_netif_ipv6_addr_remove_internal(&netifs[0], &src2);
+}
+
 static void test_get_by_ipv6_addr__empty(void)
 {
     static const ipv6_addr_t addr = { .u8 = NETIF0_IPV6_LL };
@@ -1729,6 +1810,8 @@ static Test *embunit_tests_gnrc_netif(void)
             new_TestFixture(test_ipv6_addr_best_src__ula_src_dst),
             new_TestFixture(test_ipv6_addr_best_src__global_src_ula_dst),
             new_TestFixture(test_ipv6_addr_best_src__deprecated_addr),
+            new_TestFixture(test_ipv6_addr_best_src__addr_change),
+            new_TestFixture(test_ipv6_addr_best_src__prefix_change),
             new_TestFixture(test_get_by_ipv6_addr__empty),
             new_TestFixture(test_get_by_ipv6_addr__unspecified_addr),
             new_TestFixture(test_get_by_ipv6_addr__success),
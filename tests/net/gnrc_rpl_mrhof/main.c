@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests for the MRHOF objective function and the parent
+ *              selection of RPL
+ *
+ * The DODAG is not bound to an interface, so the link metric of all parents
+ * is the initial ETX of @ref NETSTATS_NB_ETX_INIT and the path cost via a
+ * parent is its rank plus MinHopRankIncrease.
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "embUnit.h"
+#include "evtimer_msg.h"
+#include "msg.h"
+#include "net/gnrc/rpl.h"
+#include "net/gnrc/rpl/dodag.h"
+#include "net/gnrc/rpl/mrhof.h"
+#include "net/netstats/neighbor.h"
+#include "thread.h"
+#include "trickle.h"
+
+#define INSTANCE_ID     (1U)
+#define MIN_HOP_RANK    (CONFIG_GNRC_RPL_DEFAULT_MIN_HOP_RANK_INCREASE)
+#define THRESHOLD       (CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD)
+
+static const ipv6_addr_t _dodag_id = {
+    .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01 }
+};
+
+/* from gnrc_rpl_internal/globals.h */
+extern evtimer_msg_t gnrc_rpl_evtimer;
+
+static msg_t _main_msg_queue[8];
+static gnrc_rpl_instance_t *_inst;
+static gnrc_rpl_dodag_t *_dodag;
+
+/* MRHOF, but counting how often the parent set is sorted */
+static gnrc_rpl_of_t _counting_of;
+static unsigned _cmp_calls;
+
+static int _counting_parent_cmp(gnrc_rpl_parent_t *parent1,
+                                gnrc_rpl_parent_t *parent2)
+{
+    _cmp_calls++;
+    return gnrc_rpl_get_of_mrhof()->parent_cmp(parent1, parent2);
+}
+
+static gnrc_rpl_parent_t *_parent(uint8_t id, uint16_t rank)
+{
+    ipv6_addr_t addr = {
+        .u8 = { 0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, id }
+    };
+    gnrc_rpl_parent_t *parent;
+
+    gnrc_rpl_parent_add_by_addr(_dodag, &addr, &parent);
+    assert(parent != NULL);
+    parent->rank = rank;
+    gnrc_rpl_parent_update(_dodag, parent);
+    return parent;
+}
+
+static void _set_rank(gnrc_rpl_parent_t *parent, uint16_t rank)
+{
+    parent->rank = rank;
+    gnrc_rpl_parent_update(_dodag, parent);
+}
+
+static void test_mrhof_path_cost(void)
+{
+    gnrc_rpl_parent_t *parent = _parent(1, 2 * MIN_HOP_RANK);
+
+    TEST_ASSERT_EQUAL_INT(NETSTATS_NB_ETX_INIT * NETSTATS_NB_ETX_DIVISOR,
+                          parent->link_metric);
+    TEST_ASSERT_EQUAL_INT(3 * MIN_HOP_RANK, parent->path_cost);
+    TEST_ASSERT(_dodag->parents == parent);
+    TEST_ASSERT_EQUAL_INT(3 * MIN_HOP_RANK, _dodag->my_rank);
+}
+
+static void test_mrhof_better_parent(void)
+{
+    gnrc_rpl_parent_t *parent1 = _parent(1, 3 * MIN_HOP_RANK);
+    gnrc_rpl_parent_t *parent2 = _parent(2, 3 * MIN_HOP_RANK - THRESHOLD + 1);
+
+    /* cheaper, but not by PARENT_SWITCH_THRESHOLD */
+    TEST_ASSERT(_dodag->parents == parent1);
+    TEST_ASSERT(parent1->next == parent2);
+    TEST_ASSERT_EQUAL_INT(4 * MIN_HOP_RANK, _dodag->my_rank);
+
+    /* exactly PARENT_SWITCH_THRESHOLD cheaper */
+    _set_rank(parent2, 3 * MIN_HOP_RANK - THRESHOLD);
+    TEST_ASSERT(_dodag->parents == parent2);
+    TEST_ASSERT_EQUAL_INT(4 * MIN_HOP_RANK - THRESHOLD, _dodag->my_rank);
+}
+
+static void test_mrhof_keep_preferred_parent(void)
+{
+    gnrc_rpl_parent_t *parent1 = _parent(1, 3 * MIN_HOP_RANK);
+    gnrc_rpl_parent_t *parent2 = _parent(2, 3 * MIN_HOP_RANK - THRESHOLD / 2);
+
+    TEST_ASSERT(_dodag->parents == parent1);
+
+    /* the preferred parent got worse, but is still within the threshold */
+    _set_rank(parent1, 3 * MIN_HOP_RANK + THRESHOLD / 2 - 1);
+    TEST_ASSERT(_dodag->parents == parent1);
+    TEST_ASSERT_EQUAL_INT(4 * MIN_HOP_RANK + THRESHOLD / 2 - 1,
+                          _dodag->my_rank);
+
+    /* ... and now it isn't */
+    _set_rank(parent1, 3 * MIN_HOP_RANK + THRESHOLD / 2);
+    TEST_ASSERT(_dodag->parents == parent2);
+    TEST_ASSERT_EQUAL_INT(4 * MIN_HOP_RANK - THRESHOLD / 2, _dodag->my_rank);
+}
+
+static void test_mrhof_infinite_preferred_parent(void)
+{
+    gnrc_rpl_parent_t *parent1 = _parent(1, 3 * MIN_HOP_RANK);
+    gnrc_rpl_parent_t *parent2 = _parent(2, 3 * MIN_HOP_RANK - 1);
+
+    TEST_ASSERT(_dodag->parents == parent1);
+    /* no head start for a parent that lost its route */
+    _set_rank(parent1, GNRC_RPL_INFINITE_RANK);
+    TEST_ASSERT(_dodag->parents == parent2);
+    TEST_ASSERT_EQUAL_INT(4 * MIN_HOP_RANK - 1, _dodag->my_rank);
+}
+
+static void test_parent_update__unchanged(void)
+{
+    _inst->of = &_counting_of;
+
+    gnrc_rpl_parent_t *parent1 = _parent(1, 3 * MIN_HOP_RANK);
+    gnrc_rpl_parent_t *parent2 = _parent(2, 3 * MIN_HOP_RANK);
+
+    TEST_ASSERT(_dodag->parents == parent1);
+    TEST_ASSERT(_cmp_calls > 0);
+
+    /* a DIO that doesn't change the cost of a parent doesn't re-sort */
+    _cmp_calls = 0;
+    gnrc_rpl_parent_update(_dodag, parent1);
+    gnrc_rpl_parent_update(_dodag, parent2);
+    TEST_ASSERT_EQUAL_INT(0, _cmp_calls);
+    TEST_ASSERT(_dodag->parents == parent1);
+    TEST_ASSERT_EQUAL_INT(4 * MIN_HOP_RANK, _dodag->my_rank);
+
+    /* a changed rank does */
+    _set_rank(parent2, 2 * MIN_HOP_RANK);
+    TEST_ASSERT(_cmp_calls > 0);
+    TEST_ASSERT(_dodag->parents == parent2);
+    TEST_ASSERT_EQUAL_INT(3 * MIN_HOP_RANK, _dodag->my_rank);
+}
+
+static void _setup(void)
+{
+    _cmp_calls = 0;
+    TEST_ASSERT(gnrc_rpl_instance_add(INSTANCE_ID, &_inst));
+    _inst->mop = GNRC_RPL_MOP_NON_STORING_MODE;
+    _inst->of = gnrc_rpl_get_of_mrhof();
+    TEST_ASSERT(gnrc_rpl_dodag_init(_inst, &_dodag_id, KERNEL_PID_UNDEF));
+    _dodag = &_inst->dodag;
+    trickle_start(gnrc_rpl_pid, &_dodag->trickle, GNRC_RPL_MSG_TYPE_TRICKLE_MSG,
+                  (1 << _dodag->dio_min), _dodag->dio_interval_doubl,
+                  _dodag->dio_redun);
+}
+
+static void _teardown(void)
+{
+    gnrc_rpl_instance_remove(_inst);
+}
+
+static Test *tests_gnrc_rpl_mrhof(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mrhof_path_cost),
+        new_TestFixture(test_mrhof_better_parent),
+        new_TestFixture(test_mrhof_keep_preferred_parent),
+        new_TestFixture(test_mrhof_infinite_preferred_parent),
+        new_TestFixture(test_parent_update__unchanged),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, _setup, _teardown, fixtures);
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    msg_init_queue(_main_msg_queue, ARRAY_SIZE(_main_msg_queue));
+    /* the timers of the DODAG and its parents notify this thread instead of
+     * the RPL thread, which is not started */
+    gnrc_rpl_pid = thread_getpid();
+    evtimer_init_msg(&gnrc_rpl_evtimer);
+
+    _counting_of = *gnrc_rpl_get_of_mrhof();
+    _counting_of.parent_cmp = _counting_parent_cmp;
+
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_rpl_mrhof());
+    TESTS_END();
+
+    return 0;
+}
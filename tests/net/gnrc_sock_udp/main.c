@@ -518,6 +518,78 @@ static void test_sock_udp_recv_buf__success(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_recv_batch__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_ep_t remote;
+    sock_udp_mmsg_t msgs[3] = {
+        { .data = _test_buffer, .max_len = sizeof("ABCD"), .remote = &remote },
+        { .data = _test_buffer + sizeof("ABCD"), .max_len = sizeof("EFGH") },
+        { .data = _test_buffer + sizeof("ABCDEFGH"), .max_len = 1 },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "EFGH", sizeof("EFGH"),
+                          _TEST_NETIF));
+    /* only waits for the first datagram, third slot stays empty */
+    expect(2 == sock_udp_recv_batch(&_sock, msgs, ARRAY_SIZE(msgs),
+                                    SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].len);
+    expect(memcmp("ABCD", msgs[0].data, sizeof("ABCD")) == 0);
+    expect(sizeof("EFGH") == msgs[1].len);
+    expect(memcmp("EFGH", msgs[1].data, sizeof("EFGH")) == 0);
+    expect(AF_INET6 == remote.family);
+    expect(memcmp(&src_addr, &remote.addr.ipv6, sizeof(ipv6_addr_t)) == 0);
+    expect(_TEST_PORT_REMOTE == remote.port);
+    expect(-EAGAIN == sock_udp_recv_batch(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
+#ifdef MODULE_GNRC_SOCK_STATS
+static void test_sock_udp_recv__stats(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    gnrc_sock_stats_t stats;
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(-EINVAL == gnrc_sock_set_queue_depth(&_sock.reg, 0));
+    expect(0 == gnrc_sock_set_queue_depth(&_sock.reg, 2));
+    for (unsigned i = 0; i < 3; i++) {
+        expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                              _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                              _TEST_NETIF));
+    }
+    expect(2 == gnrc_sock_get_stats(&_sock.reg, &stats));
+    expect(2 == stats.received);
+    expect(1 == stats.dropped);
+    expect(2 == stats.high_water);
+    expect(2 == stats.depth);
+    gnrc_sock_stats_lock();
+    expect(gnrc_sock_iter(NULL) == &_sock.reg);
+    gnrc_sock_stats_unlock();
+    expect(sizeof("ABCD") == sock_udp_recv(&_sock, _test_buffer,
+                                           sizeof(_test_buffer), 0, NULL));
+    expect(1 == gnrc_sock_get_stats(&_sock.reg, &stats));
+    gnrc_sock_reset_stats(&_sock.reg);
+    expect(1 == gnrc_sock_get_stats(&_sock.reg, &stats));
+    expect((0 == stats.received) && (0 == stats.dropped) &&
+           (0 == stats.high_water));
+    expect(sizeof("ABCD") == sock_udp_recv(&_sock, _test_buffer,
+                                           sizeof(_test_buffer), 0, NULL));
+    expect(_check_net());
+}
+#endif
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -685,6 +757,79 @@ static void test_sock_udp_sendv__socketed(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_send_batch__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    const sock_udp_mmsg_t msgs[] = {
+        { .data = "ABCD", .len = sizeof("ABCD") },
+        { .data = "EFGH", .len = sizeof("EFGH") },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(2 == sock_udp_send_batch(&_sock, msgs, ARRAY_SIZE(msgs)));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, false));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "EFGH", sizeof("EFGH"),
+                         _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
+static void test_sock_udp_send_batch__multiple_remotes(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t wrong_addr = { .u8 = _TEST_ADDR_WRONG };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t sock_remote = { .addr = { .ipv6 = _TEST_ADDR_WRONG },
+                                               .family = AF_INET6,
+                                               .port = _TEST_PORT_REMOTE + _TEST_PORT_LOCAL };
+    sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                             .family = AF_INET6,
+                             .port = _TEST_PORT_REMOTE };
+    /* same end point in another buffer */
+    sock_udp_ep_t remote_cpy = remote;
+    sock_udp_ep_t other_port = remote;
+    other_port.port = _TEST_PORT_REMOTE + 1;
+    /* no more than the message queue of the test stack holds */
+    const sock_udp_mmsg_t msgs[] = {
+        { .data = "ABCD", .len = sizeof("ABCD"), .remote = &remote },
+        { .data = "EFGH", .len = sizeof("EFGH"), .remote = &remote_cpy },
+        { .data = "IJKL", .len = sizeof("IJKL"), .remote = &other_port },
+        { .data = "MNOP", .len = sizeof("MNOP") },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, &sock_remote, SOCK_FLAGS_REUSE_EP));
+    expect(ARRAY_SIZE(msgs) == sock_udp_send_batch(&_sock, msgs, ARRAY_SIZE(msgs)));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, false));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "EFGH", sizeof("EFGH"),
+                         _TEST_NETIF, false));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE + 1, "IJKL", sizeof("IJKL"),
+                         _TEST_NETIF, false));
+    expect(_check_packet(&src_addr, &wrong_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE + _TEST_PORT_LOCAL, "MNOP",
+                         sizeof("MNOP"), _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__socketed_other_remote(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
@@ -855,6 +1000,10 @@ int main(void)
     CALL(test_sock_udp_recv__non_blocking());
     CALL(test_sock_udp_recv__aux());
     CALL(test_sock_udp_recv_buf__success());
+    CALL(test_sock_udp_recv_batch__socketed());
+#ifdef MODULE_GNRC_SOCK_STATS
+    CALL(test_sock_udp_recv__stats());
+#endif
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());
@@ -866,6 +1015,8 @@ int main(void)
     CALL(test_sock_udp_send__socketed_no_local());
     CALL(test_sock_udp_send__socketed());
     CALL(test_sock_udp_sendv__socketed());
+    CALL(test_sock_udp_send_batch__socketed());
+    CALL(test_sock_udp_send_batch__multiple_remotes());
     CALL(test_sock_udp_send__socketed_other_remote());
     CALL(test_sock_udp_send__unsocketed_no_local_no_netif());
     CALL(test_sock_udp_send__unsocketed_no_netif());
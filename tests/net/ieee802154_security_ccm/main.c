@@ -0,0 +1,399 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Known answer tests for the CCM* mode of the IEEE 802.15.4
+ *              security layer
+ *
+ * The frame, key, source address and frame counter are those of the data
+ * frame in IEEE 802.15.4-2015, Annex C.2.2. The vectors of the security
+ * levels with a MIC were computed with an independent CCM* implementation
+ * that reproduces the MICs of Annex C.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/ieee802154_security.h"
+
+#define FRAME_COUNTER   (5U)
+#define PEER_KEYS       (CONFIG_IEEE802154_SEC_KEY_CACHE_SIZE + 1)
+
+static const uint8_t _key[IEEE802154_SEC_KEY_LENGTH] = {
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+};
+
+/* extended source address in the byte order of the nonce */
+static const uint8_t _src_addr[IEEE802154_LONG_ADDRESS_LEN] = {
+    0xac, 0xde, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01,
+};
+
+static const uint8_t _mhr[] = {
+    0x69, 0xdc, 0x84, 0x21, 0x43, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0xde, 0xac, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0xde, 0xac,
+};
+
+static const uint8_t _short_payload[] = {
+    0x61, 0x62, 0x63, 0x64,
+};
+
+/* spans several blocks and ends with a partial one */
+static const uint8_t _long_payload[] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+};
+
+typedef struct {
+    uint8_t level;
+    const uint8_t *plain;
+    uint8_t plain_len;
+    const uint8_t *cipher;
+    const uint8_t *mic;
+    uint8_t mic_len;
+} _kat_t;
+
+static const _kat_t _kats[] = {
+    {   /* Annex C.2.2 */
+        .level = IEEE802154_SEC_SCF_SECLEVEL_ENC,
+        .plain = _short_payload, .plain_len = sizeof(_short_payload),
+        .cipher = (const uint8_t []){ 0xd4, 0x3e, 0x02, 0x2b },
+    },
+    {
+        .level = IEEE802154_SEC_SCF_SECLEVEL_ENC_MIC32,
+        .plain = _short_payload, .plain_len = sizeof(_short_payload),
+        .cipher = (const uint8_t []){ 0x35, 0x66, 0xbd, 0x72 },
+        .mic = (const uint8_t []){ 0x1b, 0x0c, 0x6e, 0x27 },
+        .mic_len = 4,
+    },
+    {
+        .level = IEEE802154_SEC_SCF_SECLEVEL_ENC_MIC64,
+        .plain = _short_payload, .plain_len = sizeof(_short_payload),
+        .cipher = (const uint8_t []){ 0x77, 0xcb, 0x04, 0xd0 },
+        .mic = (const uint8_t []){
+            0x8e, 0x60, 0x78, 0xf2, 0xf2, 0xbe, 0x4c, 0x61,
+        },
+        .mic_len = 8,
+    },
+    {
+        .level = IEEE802154_SEC_SCF_SECLEVEL_ENC_MIC128,
+        .plain = _short_payload, .plain_len = sizeof(_short_payload),
+        .cipher = (const uint8_t []){ 0x4e, 0x8b, 0x60, 0xda },
+        .mic = (const uint8_t []){
+            0x3d, 0x80, 0xee, 0xbd, 0x89, 0x44, 0xcb, 0x78,
+            0x18, 0xeb, 0x3e, 0x5e, 0x08, 0x63, 0xf8, 0xe6,
+        },
+        .mic_len = 16,
+    },
+    {
+        .level = IEEE802154_SEC_SCF_SECLEVEL_ENC,
+        .plain = _long_payload, .plain_len = sizeof(_long_payload),
+        .cipher = (const uint8_t []){
+            0xb5, 0x5d, 0x63, 0x4c, 0xa2, 0x8e, 0x78, 0xe7,
+            0xc3, 0x7e, 0x3d, 0xe0, 0xa4, 0x10, 0x3d, 0x4e,
+            0x12, 0x6f, 0x04, 0xca, 0x87, 0x8a, 0x1e, 0x9f,
+            0x21, 0x53, 0xfe, 0x5e, 0xbd, 0x36, 0xd7, 0xc5,
+            0x41, 0xe4, 0x80, 0x02, 0x03, 0x09, 0x07, 0x9c,
+        },
+    },
+    {
+        .level = IEEE802154_SEC_SCF_SECLEVEL_ENC_MIC64,
+        .plain = _long_payload, .plain_len = sizeof(_long_payload),
+        .cipher = (const uint8_t []){
+            0x16, 0xa8, 0x65, 0xb7, 0x0b, 0xfc, 0x74, 0xd9,
+            0xb9, 0xc2, 0x4c, 0xec, 0x05, 0xf0, 0xe5, 0xf0,
+            0x51, 0xc0, 0xc0, 0x34, 0x8c, 0x72, 0x26, 0x75,
+            0xdf, 0x6f, 0x1b, 0x9b, 0xad, 0xc7, 0xd4, 0x56,
+            0xe4, 0x19, 0x71, 0xc2, 0xb0, 0x85, 0x51, 0x6a,
+        },
+        .mic = (const uint8_t []){
+            0x60, 0x58, 0x45, 0xd7, 0xd5, 0xca, 0x81, 0x24,
+        },
+        .mic_len = 8,
+    },
+};
+
+static ieee802154_sec_context_t _ctx;
+static uint8_t _frame[IEEE802154_FRAME_LEN_MAX];
+static uint8_t _peer_keys[PEER_KEYS][IEEE802154_SEC_KEY_LENGTH];
+static const uint8_t *_peer_key;
+
+static const uint8_t *_key_lookup(const ieee802154_sec_context_t *ctx,
+                                  const uint8_t *mhr, uint8_t mhr_len,
+                                  bool rx)
+{
+    (void)ctx;
+    (void)mhr;
+    (void)mhr_len;
+    (void)rx;
+    return _peer_key;
+}
+
+static void set_up(void)
+{
+    ieee802154_sec_init(&_ctx);
+    cipher_init(&_ctx.cipher, CIPHER_AES, _key, sizeof(_key));
+    _peer_key = _key;
+    for (unsigned i = 0; i < PEER_KEYS; i++) {
+        memset(_peer_keys[i], i + 1, IEEE802154_SEC_KEY_LENGTH);
+    }
+}
+
+/**
+ * @brief   Encrypt @p kat into @ref _frame
+ *
+ * @param[in]   kat         test vector
+ * @param[out]  frame_len   length of the secured frame, may be NULL
+ */
+static void _encrypt(const _kat_t *kat, uint8_t *frame_len)
+{
+    uint8_t header_len = sizeof(_mhr);
+    uint8_t aux_len;
+    uint8_t mic_len;
+
+    memcpy(_frame, _mhr, sizeof(_mhr));
+    /* the auxiliary header is 5 bytes with the implicit key mode */
+    aux_len = 5;
+    memcpy(&_frame[header_len + aux_len], kat->plain, kat->plain_len);
+
+    _ctx.security_level = kat->level;
+    _ctx.frame_counter = FRAME_COUNTER;
+    TEST_ASSERT_EQUAL_INT(IEEE802154_SEC_OK,
+                          ieee802154_sec_encrypt_frame(&_ctx, _frame, &header_len,
+                                                       &_frame[header_len + aux_len],
+                                                       kat->plain_len,
+                                                       &_frame[header_len + aux_len +
+                                                               kat->plain_len],
+                                                       &mic_len, _src_addr));
+    TEST_ASSERT_EQUAL_INT(sizeof(_mhr) + aux_len, header_len);
+    TEST_ASSERT_EQUAL_INT(kat->mic_len, mic_len);
+    TEST_ASSERT_EQUAL_INT(FRAME_COUNTER + 1, _ctx.frame_counter);
+
+    if (frame_len) {
+        *frame_len = header_len + kat->plain_len + mic_len;
+    }
+}
+
+static void _check_secured(const _kat_t *kat)
+{
+    static const uint8_t fc[] = { FRAME_COUNTER, 0x00, 0x00, 0x00 };
+    const uint8_t *aux = &_frame[sizeof(_mhr)];
+    const uint8_t *payload = aux + 5;
+
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_mhr, _frame, sizeof(_mhr)));
+    TEST_ASSERT_EQUAL_INT(kat->level, aux[0]);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(fc, &aux[1], sizeof(fc)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(kat->cipher, payload, kat->plain_len));
+    if (kat->mic_len) {
+        TEST_ASSERT_EQUAL_INT(0, memcmp(kat->mic, payload + kat->plain_len,
+                                        kat->mic_len));
+    }
+}
+
+/**
+ * @brief   Decrypt the frame in @ref _frame and expect @p expected
+ */
+static void _decrypt(const _kat_t *kat, uint8_t frame_len, int expected)
+{
+    uint8_t header_len = sizeof(_mhr);
+    uint8_t *payload;
+    uint16_t payload_len;
+    uint8_t *mic;
+    uint8_t mic_len;
+    int res;
+
+    res = ieee802154_sec_decrypt_frame(&_ctx, frame_len, _frame, &header_len,
+                                       &payload, &payload_len, &mic, &mic_len,
+                                       _src_addr);
+    TEST_ASSERT_EQUAL_INT(expected, res);
+    if (res == IEEE802154_SEC_OK) {
+        TEST_ASSERT_EQUAL_INT(sizeof(_mhr) + 5, header_len);
+        TEST_ASSERT(payload == &_frame[header_len]);
+        TEST_ASSERT_EQUAL_INT(kat->plain_len, payload_len);
+        TEST_ASSERT_EQUAL_INT(kat->mic_len, mic_len);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(kat->plain, payload, payload_len));
+    }
+}
+
+static void test_ccm_encrypt(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_kats); i++) {
+        _encrypt(&_kats[i], NULL);
+        _check_secured(&_kats[i]);
+    }
+}
+
+static void test_ccm_decrypt(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_kats); i++) {
+        const _kat_t *kat = &_kats[i];
+        uint8_t frame_len;
+
+        _encrypt(kat, &frame_len);
+
+        /* decrypt the frame as it is given in the test vector */
+        memcpy(&_frame[sizeof(_mhr) + 5 + kat->plain_len], kat->mic,
+               kat->mic_len);
+        _decrypt(kat, frame_len, IEEE802154_SEC_OK);
+    }
+}
+
+static void test_ccm_decrypt_mic_failure(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_kats); i++) {
+        const _kat_t *kat = &_kats[i];
+        uint8_t frame_len;
+
+        if (!kat->mic_len) {
+            continue;
+        }
+        /* a modified header */
+        _encrypt(kat, &frame_len);
+        _frame[2] ^= 0x01;
+        _decrypt(kat, frame_len, -IEEE802154_SEC_MAC_CHECK_FAILURE);
+        /* a modified payload */
+        _encrypt(kat, &frame_len);
+        _frame[sizeof(_mhr) + 5] ^= 0x01;
+        _decrypt(kat, frame_len, -IEEE802154_SEC_MAC_CHECK_FAILURE);
+        /* a modified MIC */
+        _encrypt(kat, &frame_len);
+        _frame[frame_len - 1] ^= 0x01;
+        _decrypt(kat, frame_len, -IEEE802154_SEC_MAC_CHECK_FAILURE);
+    }
+}
+
+static void test_ccm_key_lookup(void)
+{
+    const _kat_t *kat = &_kats[2];
+
+    _ctx.key_lookup = _key_lookup;
+
+    /* the key of the lookup is used, not the one of ctx->cipher */
+    cipher_init(&_ctx.cipher, CIPHER_AES, _peer_keys[0],
+                IEEE802154_SEC_KEY_LENGTH);
+    _encrypt(kat, NULL);
+    _check_secured(kat);
+
+    _peer_key = NULL;
+    TEST_ASSERT_EQUAL_INT(-IEEE802154_SEC_NO_KEY,
+                          ieee802154_sec_encrypt_frame(&_ctx, _frame,
+                                                       &(uint8_t){ sizeof(_mhr) },
+                                                       &_frame[sizeof(_mhr) + 5],
+                                                       kat->plain_len,
+                                                       &_frame[sizeof(_mhr) + 5 +
+                                                               kat->plain_len],
+                                                       &(uint8_t){ 0 },
+                                                       _src_addr));
+}
+
+#if IS_USED(MODULE_IEEE802154_SECURITY_KEY_CACHE)
+static int _cache_slot(const uint8_t *key)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_ctx.key_cache); i++) {
+        if (_ctx.key_cache[i].last_used &&
+            !memcmp(_ctx.key_cache[i].key, key, IEEE802154_SEC_KEY_LENGTH)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void test_ccm_key_cache(void)
+{
+    const _kat_t *kat = &_kats[5];
+    uint8_t reference[IEEE802154_FRAME_LEN_MAX];
+    uint8_t frame_len;
+    uint8_t len;
+    int slot;
+
+    _ctx.key_lookup = _key_lookup;
+
+    /* fill the cache with the Annex C key and all but one peer key */
+    _encrypt(kat, NULL);
+    _check_secured(kat);
+    for (unsigned i = 0; i < CONFIG_IEEE802154_SEC_KEY_CACHE_SIZE - 1; i++) {
+        _peer_key = _peer_keys[i];
+        _encrypt(kat, NULL);
+    }
+    for (unsigned i = 0; i < CONFIG_IEEE802154_SEC_KEY_CACHE_SIZE - 1; i++) {
+        TEST_ASSERT(_cache_slot(_peer_keys[i]) >= 0);
+    }
+
+    /* a cache hit keeps the entry and gives the same frame */
+    slot = _cache_slot(_key);
+    TEST_ASSERT(slot >= 0);
+    _peer_key = _key;
+    _encrypt(kat, &frame_len);
+    _check_secured(kat);
+    TEST_ASSERT_EQUAL_INT(slot, _cache_slot(_key));
+    _decrypt(kat, frame_len, IEEE802154_SEC_OK);
+    TEST_ASSERT_EQUAL_INT(slot, _cache_slot(_key));
+
+    /* a new key evicts the least recently used one, which is _peer_keys[0] */
+    slot = _cache_slot(_peer_keys[0]);
+    _peer_key = _peer_keys[PEER_KEYS - 1];
+    _encrypt(kat, &frame_len);
+    TEST_ASSERT_EQUAL_INT(-1, _cache_slot(_peer_keys[0]));
+    TEST_ASSERT_EQUAL_INT(slot, _cache_slot(_peer_keys[PEER_KEYS - 1]));
+    TEST_ASSERT(_cache_slot(_key) >= 0);
+    memcpy(reference, _frame, frame_len);
+    _decrypt(kat, frame_len, IEEE802154_SEC_OK);
+
+    /* the replaced schedule belongs to the new key: compare with a context
+     * that has it as its default key */
+    set_up();
+    cipher_init(&_ctx.cipher, CIPHER_AES, _peer_keys[PEER_KEYS - 1],
+                IEEE802154_SEC_KEY_LENGTH);
+    _encrypt(kat, &len);
+    TEST_ASSERT_EQUAL_INT(frame_len, len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(reference, _frame, frame_len));
+
+    /* the evicted key is expanded again and the Annex C key still hits */
+    _ctx.key_lookup = _key_lookup;
+    _peer_key = _peer_keys[0];
+    _encrypt(kat, NULL);
+    TEST_ASSERT(_cache_slot(_peer_keys[0]) >= 0);
+    _peer_key = _key;
+    _encrypt(kat, NULL);
+    _check_secured(kat);
+}
+#endif
+
+static Test *tests_ieee802154_security_ccm(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ccm_encrypt),
+        new_TestFixture(test_ccm_decrypt),
+        new_TestFixture(test_ccm_decrypt_mic_failure),
+        new_TestFixture(test_ccm_key_lookup),
+#if IS_USED(MODULE_IEEE802154_SECURITY_KEY_CACHE)
+        new_TestFixture(test_ccm_key_cache),
+#endif
+    };
+
+    EMB_UNIT_TESTCALLER(ieee802154_security_ccm_tests, set_up, NULL, fixtures);
+    return (Test *)&ieee802154_security_ccm_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_ieee802154_security_ccm());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,287 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests for pipelined block-wise GET requests of nanocoap_sock
+ *
+ * A scripted CoAP server on the loopback interface collects the requests that
+ * are in flight and answers them in reverse order.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/nanocoap_sock.h"
+#include "net/sock/udp.h"
+#include "thread.h"
+
+#define SERVER_PORT         (5683U)
+#define RESOURCE_LEN        (200U)
+#define BLKSIZE             COAP_BLOCKSIZE_16
+#define WINDOW              (4U)
+/* time the server waits for further requests before answering */
+#define COLLECT_TIMEOUT_US  (20U * US_PER_MS)
+
+typedef enum {
+    MODE_REORDER,           /**< piggybacked responses */
+    MODE_SEPARATE,          /**< empty ACK, then separate responses */
+    MODE_NO_BLOCKWISE,      /**< whole resource without Block2 option */
+    MODE_SIZE2_SHORT,       /**< Size2 announces half of the resource */
+} _mode_t;
+
+typedef struct {
+    uint8_t buf[64];
+    size_t len;
+} _request_t;
+
+static char _server_stack[THREAD_STACKSIZE_DEFAULT];
+static sock_udp_t _server_sock;
+static sock_udp_ep_t _client_ep;
+static _request_t _pending[WINDOW];
+static uint8_t _resp_buf[RESOURCE_LEN + 32];
+
+static volatile _mode_t _mode;
+static volatile unsigned _max_in_flight;
+static uint16_t _separate_id;
+
+static uint8_t _resource[RESOURCE_LEN];
+static uint8_t _received[RESOURCE_LEN];
+static size_t _received_len;
+static unsigned _calls;
+static bool _order_ok;
+
+static void _send(const coap_pkt_t *req, unsigned type, uint16_t id,
+                  bool response)
+{
+    coap_block1_t block2;
+    coap_pkt_t pkt = { .hdr = (void *)_resp_buf };
+    uint8_t *pos = _resp_buf;
+
+    if (!response) {
+        /* empty ACK */
+        pos += coap_build_hdr(pkt.hdr, type, NULL, 0, COAP_CODE_EMPTY, id);
+        sock_udp_send(&_server_sock, _resp_buf, pos - _resp_buf, &_client_ep);
+        return;
+    }
+
+    bool blockwise = (_mode != MODE_NO_BLOCKWISE) &&
+                     coap_get_block2((coap_pkt_t *)req, &block2);
+    if (blockwise && (block2.offset >= RESOURCE_LEN)) {
+        /* block past the end, requested after an understated Size2 */
+        pos += coap_build_hdr(pkt.hdr, type, coap_get_token(req),
+                              coap_get_token_len(req), COAP_CODE_BAD_OPTION, id);
+        sock_udp_send(&_server_sock, _resp_buf, pos - _resp_buf, &_client_ep);
+        return;
+    }
+
+    pos += coap_build_hdr(pkt.hdr, type, coap_get_token(req),
+                          coap_get_token_len(req), COAP_CODE_CONTENT, id);
+
+    size_t offset = 0;
+    size_t len = RESOURCE_LEN;
+    if (blockwise) {
+        bool more;
+
+        offset = block2.offset;
+        len = coap_szx2size(block2.szx);
+        more = offset + len < RESOURCE_LEN;
+        if (!more) {
+            len = RESOURCE_LEN - offset;
+        }
+        pos += coap_opt_put_uint(pos, 0, COAP_OPT_BLOCK2,
+                                 (block2.blknum << 4) | (more ? 0x8 : 0) | block2.szx);
+        if (block2.blknum == 0) {
+            uint32_t size2 = RESOURCE_LEN;
+            if (_mode == MODE_SIZE2_SHORT) {
+                size2 /= 2;
+            }
+            pos += coap_opt_put_uint(pos, COAP_OPT_BLOCK2, COAP_OPT_SIZE2, size2);
+        }
+    }
+    *pos++ = 0xFF;
+    memcpy(pos, &_resource[offset], len);
+    pos += len;
+
+    sock_udp_send(&_server_sock, _resp_buf, pos - _resp_buf, &_client_ep);
+}
+
+static void *_server(void *arg)
+{
+    (void)arg;
+    unsigned numof = 0;
+
+    while (1) {
+        _request_t *req = &_pending[numof];
+        ssize_t res = sock_udp_recv(&_server_sock, req->buf, sizeof(req->buf),
+                                    numof ? COLLECT_TIMEOUT_US : SOCK_NO_TIMEOUT,
+                                    &_client_ep);
+        if (res > 0) {
+            coap_pkt_t pkt;
+
+            /* ignore ACKs for separate responses */
+            if ((coap_parse(&pkt, req->buf, res) < 0) ||
+                (coap_get_code_raw(&pkt) != COAP_METHOD_GET)) {
+                continue;
+            }
+            if (_mode == MODE_SEPARATE) {
+                _send(&pkt, COAP_TYPE_ACK, coap_get_id(&pkt), false);
+            }
+            req->len = res;
+            if (++numof < WINDOW) {
+                continue;
+            }
+        }
+        else if (numof == 0) {
+            continue;
+        }
+
+        if (numof > _max_in_flight) {
+            _max_in_flight = numof;
+        }
+        while (numof) {
+            coap_pkt_t pkt;
+
+            req = &_pending[--numof];
+            coap_parse(&pkt, req->buf, req->len);
+            if (_mode == MODE_SEPARATE) {
+                _send(&pkt, COAP_TYPE_CON, _separate_id++, true);
+            }
+            else {
+                _send(&pkt, COAP_TYPE_ACK, coap_get_id(&pkt), true);
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static int _collect(void *arg, size_t offset, uint8_t *buf, size_t len, int more)
+{
+    (void)arg;
+
+    if ((offset != _received_len) || (offset + len > sizeof(_received)) ||
+        (!more != (offset + len == RESOURCE_LEN))) {
+        _order_ok = false;
+        return -1;
+    }
+    memcpy(&_received[offset], buf, len);
+    _received_len += len;
+    _calls++;
+    return 0;
+}
+
+static void _get(_mode_t mode, int *res)
+{
+    nanocoap_sock_t sock;
+    sock_udp_ep_t remote = {
+        .family = AF_INET6,
+        .addr = IPV6_ADDR_LOOPBACK,
+        .port = SERVER_PORT,
+    };
+    /* reorder buffer for all but one block of the window */
+    uint8_t work_buf[(WINDOW - 1) * 16];
+
+    _mode = mode;
+    _max_in_flight = 0;
+    memset(_received, 0, sizeof(_received));
+    _received_len = 0;
+    _calls = 0;
+    _order_ok = true;
+
+    *res = nanocoap_sock_connect(&sock, NULL, &remote);
+    if (*res == 0) {
+        *res = nanocoap_sock_get_blockwise_window(&sock, "/res", BLKSIZE,
+                                                  work_buf, sizeof(work_buf),
+                                                  _collect, NULL);
+        nanocoap_sock_close(&sock);
+    }
+}
+
+static void _check_resource(void)
+{
+    TEST_ASSERT(_order_ok);
+    TEST_ASSERT_EQUAL_INT(RESOURCE_LEN, _received_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_resource, _received, RESOURCE_LEN));
+}
+
+static void test_window_reorder(void)
+{
+    int res;
+
+    _get(MODE_REORDER, &res);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    _check_resource();
+    TEST_ASSERT_EQUAL_INT((RESOURCE_LEN + 15) / 16, _calls);
+    TEST_ASSERT_EQUAL_INT(WINDOW, _max_in_flight);
+}
+
+static void test_window_separate(void)
+{
+    int res;
+
+    _get(MODE_SEPARATE, &res);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    _check_resource();
+    TEST_ASSERT_EQUAL_INT(WINDOW, _max_in_flight);
+}
+
+static void test_window_no_blockwise(void)
+{
+    int res;
+
+    _get(MODE_NO_BLOCKWISE, &res);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    _check_resource();
+    TEST_ASSERT_EQUAL_INT(1, _calls);
+}
+
+static void test_window_size2_short(void)
+{
+    int res;
+
+    _get(MODE_SIZE2_SHORT, &res);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    _check_resource();
+}
+
+static Test *tests_nanocoap_sock_blockwise_window(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_window_reorder),
+        new_TestFixture(test_window_separate),
+        new_TestFixture(test_window_no_blockwise),
+        new_TestFixture(test_window_size2_short),
+    };
+
+    EMB_UNIT_TESTCALLER(nanocoap_sock_blockwise_window_tests, NULL, NULL, fixtures);
+    return (Test *)&nanocoap_sock_blockwise_window_tests;
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = { .family = AF_INET6, .port = SERVER_PORT };
+
+    for (unsigned i = 0; i < sizeof(_resource); i++) {
+        _resource[i] = i * 7;
+    }
+
+    sock_udp_create(&_server_sock, &local, NULL, 0);
+    thread_create(_server_stack, sizeof(_server_stack), THREAD_PRIORITY_MAIN - 1,
+                  0, _server, NULL, "coap server");
+
+    TESTS_START();
+    TESTS_RUN(tests_nanocoap_sock_blockwise_window());
+    TESTS_END();
+    return 0;
+}
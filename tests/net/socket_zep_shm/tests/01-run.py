@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import signal
+import struct
+import subprocess
+import sys
+import time
+
+import pexpect
+from testrunner import run
+
+RIOTBASE = os.getenv("RIOTBASE", os.path.abspath(
+    os.path.join(os.path.dirname(__file__), "../../../..")))
+sys.path.append(os.path.join(RIOTBASE, "dist/tools/zep_shm"))
+import zep_shm  # noqa: E402
+
+
+MEDIUM = "socket_zep_shm"
+# the first node is started by `make term`
+NODE_ADDR = "00:00:00:00:00:00:00:0{}"
+NODE_LL = "fe80::200:0:0:{}"
+PING_COUNT = 10
+
+
+def start_node(n):
+    node = pexpect.spawnu(os.environ["ELFFILE"],
+                          ["-z", "shm:" + MEDIUM, "--eui64=" + NODE_ADDR.format(n)],
+                          timeout=10)
+    node.expect_exact("socket ZEP shared memory test application")
+    return node
+
+
+def stop_node(node):
+    # also stop the helper processes native forks for async I/O
+    os.killpg(node.pid, signal.SIGKILL)
+    node.wait()
+
+
+def slot_of(medium, n):
+    addr = zep_shm.parse_mac(NODE_ADDR.format(n))
+    for slot in range(medium.nodes):
+        pid, slot_addr, _, _ = medium.node(slot)
+        if pid and slot_addr == addr:
+            return slot
+    raise AssertionError("node {} is not on the medium".format(n))
+
+
+def slot_offset(medium, slot):
+    return medium.node_offset + slot * medium.node_size
+
+
+def frames_delivered(medium, slot):
+    """Number of frames ever written to the receive ring of slot"""
+    return zep_shm.NODE.unpack_from(medium.mem, slot_offset(medium, slot))[8]
+
+
+def ping(child, n):
+    child.sendline("ping -c {} -i 20 -W 500 {}".format(PING_COUNT, NODE_LL.format(n)))
+    child.expect(r"{} packets transmitted, (\d+) packets received"
+                 .format(PING_COUNT), timeout=20)
+    return int(child.match.group(1))
+
+
+def testfunc(child):
+    child.expect_exact("socket ZEP shared memory test application")
+    nodes = [start_node(2), start_node(3)]
+    try:
+        medium = zep_shm.Medium(MEDIUM)
+        # let the nodes finish router solicitations
+        time.sleep(1)
+
+        # unicast frames and their ACKs only wake up the destination
+        bystander = slot_of(medium, 3)
+        before = frames_delivered(medium, bystander)
+        assert ping(child, 2) > PING_COUNT // 2
+        delivered = frames_delivered(medium, bystander) - before
+        assert delivered < PING_COUNT, delivered
+
+        # a node that died while holding the lock of a slot doesn't block
+        # the medium
+        dead = subprocess.Popen(["true"])
+        dead.wait()
+        lock = slot_offset(medium, slot_of(medium, 2))
+        struct.pack_into("<I", medium.mem, lock, dead.pid)
+        assert ping(child, 2) > PING_COUNT // 2
+        assert struct.unpack_from("<I", medium.mem, lock)[0] != dead.pid
+    finally:
+        for node in nodes:
+            stop_node(node)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=10))
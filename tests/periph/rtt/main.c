@@ -26,7 +26,9 @@
 #include <string.h>
 #include <inttypes.h>
 
+#include "container.h"
 #include "cpu.h"
+#include "modules.h"
 #include "periph_conf.h"
 #include "periph/rtt.h"
 #include "periph/rtc_mem.h"
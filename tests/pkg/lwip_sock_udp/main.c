@@ -23,6 +23,7 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include "container.h"
 #include "net/sock/udp.h"
 #include "test_utils/expect.h"
 #include "ztimer.h"
@@ -1142,6 +1143,42 @@ static void test_sock_udp_recv_buf6__success(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_recv_batch6__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR6_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR6_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_ep_t remote;
+    sock_udp_mmsg_t msgs[3] = {
+        { .data = _test_buffer, .max_len = sizeof("ABCD"), .remote = &remote },
+        { .data = _test_buffer + sizeof("ABCD"), .max_len = sizeof("EFGH") },
+        { .data = _test_buffer + sizeof("ABCDEFGH"), .max_len = 1 },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_6packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                           _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                           _TEST_NETIF));
+    ztimer_sleep(ZTIMER_MSEC, 1);    /* let lwIP stack take the packet */
+    expect(_inject_6packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                           _TEST_PORT_LOCAL, "EFGH", sizeof("EFGH"),
+                           _TEST_NETIF));
+    ztimer_sleep(ZTIMER_MSEC, 1);    /* let lwIP stack take the packet */
+    /* only waits for the first datagram, third slot stays empty */
+    expect(2 == sock_udp_recv_batch(&_sock, msgs, ARRAY_SIZE(msgs),
+                                    SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].len);
+    expect(memcmp("ABCD", msgs[0].data, sizeof("ABCD")) == 0);
+    expect(sizeof("EFGH") == msgs[1].len);
+    expect(memcmp("EFGH", msgs[1].data, sizeof("EFGH")) == 0);
+    expect(AF_INET6 == remote.family);
+    expect(memcmp(&src_addr, &remote.addr.ipv6, sizeof(ipv6_addr_t)) == 0);
+    expect(_TEST_PORT_REMOTE == remote.port);
+    expect(-EAGAIN == sock_udp_recv_batch(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
 static void test_sock_udp_send6__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR6_REMOTE },
@@ -1320,6 +1357,34 @@ static void test_sock_udp_sendv6__socketed(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_send_batch6__multiple_remotes(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR6_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR6_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR6_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR6_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    sock_udp_ep_t other_port = remote;
+    other_port.port = _TEST_PORT_REMOTE + 1;
+    const sock_udp_mmsg_t msgs[] = {
+        { .data = "ABCD", .len = sizeof("ABCD") },
+        { .data = "EFGHIJ", .len = sizeof("EFGHIJ"), .remote = &other_port },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(ARRAY_SIZE(msgs) == sock_udp_send_batch(&_sock, msgs, ARRAY_SIZE(msgs)));
+    /* the test stack only keeps the last frame sent */
+    expect(_check_6packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                          _TEST_PORT_REMOTE + 1, "EFGHIJ", sizeof("EFGHIJ"),
+                          _TEST_NETIF, false));
+    ztimer_sleep(ZTIMER_MSEC, 1);    /* let lwIP stack finish */
+    expect(_check_net());
+}
+
 static void test_sock_udp_send6__socketed_other_remote(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR6_LOCAL };
@@ -1552,6 +1617,7 @@ int main(void)
     CALL(test_sock_udp_recv6__non_blocking());
     CALL(test_sock_udp_recv6__aux());
     CALL(test_sock_udp_recv_buf6__success());
+    CALL(test_sock_udp_recv_batch6__socketed());
     _prepare_send_checks();
     CALL(test_sock_udp_send6__EAFNOSUPPORT());
     CALL(test_sock_udp_send6__EINVAL_addr());
@@ -1564,6 +1630,7 @@ int main(void)
     CALL(test_sock_udp_send6__socketed_no_local());
     CALL(test_sock_udp_send6__socketed());
     CALL(test_sock_udp_sendv6__socketed());
+    CALL(test_sock_udp_send_batch6__multiple_remotes());
     CALL(test_sock_udp_send6__socketed_other_remote());
     CALL(test_sock_udp_send6__unsocketed_no_local_no_netif());
     CALL(test_sock_udp_send6__unsocketed_no_netif());
@@ -88,6 +88,7 @@ def testfunc(child):
         child.expect_exact(u"Calling test_sock_udp_recv6__unsocketed_with_remote()")
         child.expect_exact(u"Calling test_sock_udp_recv6__with_timeout()")
         child.expect_exact(u"Calling test_sock_udp_recv6__non_blocking()")
+        child.expect_exact(u"Calling test_sock_udp_recv_batch6__socketed()")
         child.expect_exact(u"Calling test_sock_udp_send6__EAFNOSUPPORT()")
         child.expect_exact(u"Calling test_sock_udp_send6__EINVAL_addr()")
         child.expect_exact(u"Calling test_sock_udp_send6__EINVAL_netif()")
@@ -98,6 +99,7 @@ def testfunc(child):
         child.expect_exact(u"Calling test_sock_udp_send6__socketed_no_netif()")
         child.expect_exact(u"Calling test_sock_udp_send6__socketed_no_local()")
         child.expect_exact(u"Calling test_sock_udp_send6__socketed()")
+        child.expect_exact(u"Calling test_sock_udp_send_batch6__multiple_remotes()")
         child.expect_exact(u"Calling test_sock_udp_send6__socketed_other_remote()")
         child.expect_exact(u"Calling test_sock_udp_send6__unsocketed_no_local_no_netif()")
         child.expect_exact(u"Calling test_sock_udp_send6__unsocketed_no_netif()")
@@ -100,12 +100,61 @@ static void test_crypto_aes_init_key_length(void)
     TEST_ASSERT_EQUAL_INT(CIPHER_ERR_INVALID_KEY_SIZE, err);
 }
 
+static void _check_encrypt_blocks(const uint8_t *key, uint8_t key_len)
+{
+    static uint8_t plain[9 * AES_BLOCK_SIZE];
+    static uint8_t cipher[9 * AES_BLOCK_SIZE];
+    uint8_t expected[AES_BLOCK_SIZE];
+    cipher_context_t ctx;
+
+    for (unsigned i = 0; i < sizeof(plain); i++) {
+        plain[i] = i * 7 + key_len;
+    }
+
+    TEST_ASSERT_EQUAL_INT(1, aes_init(&ctx, key, key_len));
+
+    for (unsigned nblocks = 1; nblocks <= 9; nblocks++) {
+        memset(cipher, 0, sizeof(cipher));
+        TEST_ASSERT_EQUAL_INT(1, aes_encrypt_blocks(&ctx, plain, cipher,
+                                                    nblocks));
+        for (unsigned i = 0; i < nblocks; i++) {
+            aes_encrypt(&ctx, plain + i * AES_BLOCK_SIZE, expected);
+            TEST_ASSERT(compare(expected, cipher + i * AES_BLOCK_SIZE,
+                                AES_BLOCK_SIZE));
+        }
+    }
+
+    /* in-place operation */
+    memcpy(cipher, plain, sizeof(cipher));
+    TEST_ASSERT_EQUAL_INT(1, aes_encrypt_blocks(&ctx, cipher, cipher, 9));
+    for (unsigned i = 0; i < 9; i++) {
+        aes_encrypt(&ctx, plain + i * AES_BLOCK_SIZE, expected);
+        TEST_ASSERT(compare(expected, cipher + i * AES_BLOCK_SIZE,
+                            AES_BLOCK_SIZE));
+    }
+}
+
+static void test_crypto_aes_encrypt_blocks(void)
+{
+    static const uint8_t key_256[32] = {
+        0x60, 0x3D, 0xEB, 0x10, 0x15, 0xCA, 0x71, 0xBE,
+        0x2B, 0x73, 0xAE, 0xF0, 0x85, 0x7D, 0x77, 0x81,
+        0x1F, 0x35, 0x2C, 0x07, 0x3B, 0x61, 0x08, 0xD7,
+        0x2D, 0x98, 0x10, 0xA3, 0x09, 0x14, 0xDF, 0xF4,
+    };
+
+    _check_encrypt_blocks(TEST_0_KEY, AES_KEY_SIZE_128);
+    _check_encrypt_blocks(key_256, AES_KEY_SIZE_192);
+    _check_encrypt_blocks(key_256, AES_KEY_SIZE_256);
+}
+
 Test *tests_crypto_aes_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_aes_encrypt),
         new_TestFixture(test_crypto_aes_decrypt),
         new_TestFixture(test_crypto_aes_init_key_length),
+        new_TestFixture(test_crypto_aes_encrypt_blocks),
     };
 
     EMB_UNIT_TESTCALLER(crypto_aes_tests, NULL, NULL, fixtures);
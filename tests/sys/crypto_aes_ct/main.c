@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests for the bitsliced, constant-time AES implementation
+ *
+ * With `crypto_aes_ct`, aes_encrypt_blocks() and the modes built on it use
+ * the bitsliced kernel, while aes_encrypt() still uses the T-tables, so the
+ * two can be compared.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "crypto/aes.h"
+#include "crypto/modes/ctr.h"
+
+/* FIPS-197, Appendix C */
+static const uint8_t _key[32] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+};
+static const uint8_t _plain[AES_BLOCK_SIZE] = {
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+    0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff,
+};
+static const uint8_t _cipher_128[AES_BLOCK_SIZE] = {
+    0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+    0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a,
+};
+static const uint8_t _cipher_192[AES_BLOCK_SIZE] = {
+    0xdd, 0xa9, 0x7c, 0xa4, 0x86, 0x4c, 0xdf, 0xe0,
+    0x6e, 0xaf, 0x70, 0xa0, 0xec, 0x0d, 0x71, 0x91,
+};
+static const uint8_t _cipher_256[AES_BLOCK_SIZE] = {
+    0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf,
+    0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89,
+};
+
+/* SP 800-38A, F.5.1 */
+static const uint8_t _ctr_key[AES_KEY_SIZE_128] = {
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+    0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c,
+};
+static const uint8_t _ctr_counter[AES_BLOCK_SIZE] = {
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff,
+};
+static const uint8_t _ctr_plain[4 * AES_BLOCK_SIZE] = {
+    0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96,
+    0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+    0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+    0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+    0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11,
+    0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+    0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17,
+    0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10,
+};
+static const uint8_t _ctr_cipher[4 * AES_BLOCK_SIZE] = {
+    0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26,
+    0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d, 0xb6, 0xce,
+    0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70, 0xfd, 0xff,
+    0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff,
+    0x5a, 0xe4, 0xdf, 0x3e, 0xdb, 0xd5, 0xd3, 0x5e,
+    0x5b, 0x4f, 0x09, 0x02, 0x0d, 0xb0, 0x3e, 0xab,
+    0x1e, 0x03, 0x1d, 0xda, 0x2f, 0xbe, 0x03, 0xd1,
+    0x79, 0x21, 0x70, 0xa0, 0xf3, 0x00, 0x9c, 0xee,
+};
+
+static void _check_fips197(uint8_t key_size, const uint8_t *expected)
+{
+    cipher_context_t ctx;
+    uint8_t data[AES_BLOCK_SIZE];
+
+    TEST_ASSERT_EQUAL_INT(1, aes_init(&ctx, _key, key_size));
+    TEST_ASSERT_EQUAL_INT(1, aes_encrypt_blocks(&ctx, _plain, data, 1));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, data, sizeof(data)));
+}
+
+static void test_aes_ct_fips197(void)
+{
+    _check_fips197(AES_KEY_SIZE_128, _cipher_128);
+    _check_fips197(AES_KEY_SIZE_192, _cipher_192);
+    _check_fips197(AES_KEY_SIZE_256, _cipher_256);
+}
+
+static void _check_blocks(uint8_t key_size)
+{
+    static uint8_t plain[9 * AES_BLOCK_SIZE];
+    static uint8_t cipher[9 * AES_BLOCK_SIZE];
+    uint8_t expected[AES_BLOCK_SIZE];
+    cipher_context_t ctx;
+
+    for (unsigned i = 0; i < sizeof(plain); i++) {
+        plain[i] = i * 13 + key_size;
+    }
+    TEST_ASSERT_EQUAL_INT(1, aes_init(&ctx, _key, key_size));
+
+    /* odd and even numbers of blocks, the kernel processes two at a time */
+    for (unsigned nblocks = 1; nblocks <= 9; nblocks++) {
+        memset(cipher, 0, sizeof(cipher));
+        TEST_ASSERT_EQUAL_INT(1, aes_encrypt_blocks(&ctx, plain, cipher,
+                                                    nblocks));
+        for (unsigned i = 0; i < nblocks; i++) {
+            aes_encrypt(&ctx, plain + i * AES_BLOCK_SIZE, expected);
+            TEST_ASSERT_EQUAL_INT(0, memcmp(expected,
+                                            cipher + i * AES_BLOCK_SIZE,
+                                            AES_BLOCK_SIZE));
+        }
+        for (unsigned i = nblocks * AES_BLOCK_SIZE; i < sizeof(cipher); i++) {
+            TEST_ASSERT_EQUAL_INT(0, cipher[i]);
+        }
+    }
+
+    /* in place */
+    memcpy(cipher, plain, sizeof(cipher));
+    TEST_ASSERT_EQUAL_INT(1, aes_encrypt_blocks(&ctx, cipher, cipher, 9));
+    for (unsigned i = 0; i < 9; i++) {
+        aes_encrypt(&ctx, plain + i * AES_BLOCK_SIZE, expected);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(expected, cipher + i * AES_BLOCK_SIZE,
+                                        AES_BLOCK_SIZE));
+    }
+}
+
+static void test_aes_ct_blocks(void)
+{
+    _check_blocks(AES_KEY_SIZE_128);
+    _check_blocks(AES_KEY_SIZE_192);
+    _check_blocks(AES_KEY_SIZE_256);
+}
+
+static void test_aes_ct_ctr(void)
+{
+    cipher_t cipher;
+    uint8_t counter[AES_BLOCK_SIZE];
+    uint8_t data[sizeof(_ctr_plain)];
+
+    TEST_ASSERT_EQUAL_INT(1, cipher_init(&cipher, CIPHER_AES, _ctr_key,
+                                         sizeof(_ctr_key)));
+
+    memcpy(counter, _ctr_counter, sizeof(counter));
+    TEST_ASSERT_EQUAL_INT(sizeof(data),
+                          cipher_encrypt_ctr(&cipher, counter, 0, _ctr_plain,
+                                             sizeof(_ctr_plain), data));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_ctr_cipher, data, sizeof(data)));
+
+    memcpy(counter, _ctr_counter, sizeof(counter));
+    TEST_ASSERT_EQUAL_INT(sizeof(data),
+                          cipher_decrypt_ctr(&cipher, counter, 0, _ctr_cipher,
+                                             sizeof(_ctr_cipher), data));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_ctr_plain, data, sizeof(data)));
+}
+
+static Test *tests_crypto_aes_ct(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_aes_ct_fips197),
+        new_TestFixture(test_aes_ct_blocks),
+        new_TestFixture(test_aes_ct_ctr),
+    };
+
+    EMB_UNIT_TESTCALLER(crypto_aes_ct_tests, NULL, NULL, fixtures);
+    return (Test *)&crypto_aes_ct_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_crypto_aes_ct());
+    TESTS_END();
+    return 0;
+}
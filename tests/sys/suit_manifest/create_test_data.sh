@@ -49,3 +49,7 @@ sign_manifest "${MANIFEST_DIR}/manifest3.bin".unsigned "${MANIFEST_DIR}/manifest
 # valid manifest, valid seqnr, signed, 2 components
 gen_manifest "${MANIFEST_DIR}/manifest4.bin".unsigned 3 "${MANIFEST_DIR}/file1.bin:0:ram:0" "${MANIFEST_DIR}/file2.bin:0:ram:1"
 sign_manifest "${MANIFEST_DIR}/manifest4.bin".unsigned "${MANIFEST_DIR}/manifest4.bin"
+
+# valid manifest, valid seqnr, signed, digest doesn't match the mock payload
+gen_manifest "${MANIFEST_DIR}/manifest5.bin".unsigned 4 "${MANIFEST_DIR}/file2.bin:0:ram:0"
+sign_manifest "${MANIFEST_DIR}/manifest5.bin".unsigned "${MANIFEST_DIR}/manifest5.bin"
@@ -35,6 +35,7 @@
 #include TEST_MANIFEST_INCLUDE(manifest2.bin.h)
 #include TEST_MANIFEST_INCLUDE(manifest3.bin.h)
 #include TEST_MANIFEST_INCLUDE(manifest4.bin.h)
+#include TEST_MANIFEST_INCLUDE(manifest5.bin.h)
 
 #include TEST_MANIFEST_INCLUDE(file1.bin.h)
 #include TEST_MANIFEST_INCLUDE(file2.bin.h)
@@ -52,6 +53,7 @@ const manifest_blob_t manifest_blobs[] = {
     { manifest2_bin, sizeof(manifest2_bin), SUIT_ERR_COND },
     { manifest3_bin, sizeof(manifest3_bin), SUIT_OK },
     { manifest4_bin, sizeof(manifest4_bin), SUIT_OK },
+    { manifest5_bin, sizeof(manifest5_bin), SUIT_ERR_DIGEST_MISMATCH },
 };
 
 const unsigned manifest_blobs_numof = ARRAY_SIZE(manifest_blobs);
@@ -69,12 +71,12 @@ const suit_transport_mock_payload_t payloads[] = {
 
 const size_t num_payloads = ARRAY_SIZE(payloads);
 
+static char _url[CONFIG_SOCK_URLPATH_MAXLEN];
+static suit_manifest_t manifest;
+
 static int test_suit_manifest(const unsigned char *manifest_bin,
                                 size_t manifest_bin_len)
 {
-    char _url[CONFIG_SOCK_URLPATH_MAXLEN];
-    suit_manifest_t manifest;
-
     memset(&manifest, 0, sizeof(manifest));
 
     manifest.urlbuf = _url;
@@ -102,10 +104,31 @@ static void test_suit_manifest_01_manifests(void)
     }
 }
 
+static void test_suit_manifest_02_digest_stream(void)
+{
+    suit_storage_set_seq_no_all(1);
+
+    /* manifest3 has a single component */
+    TEST_ASSERT_EQUAL_INT(SUIT_OK,
+                          test_suit_manifest(manifest3_bin, sizeof(manifest3_bin)));
+    TEST_ASSERT(suit_component_check_flag(&manifest.components[0],
+                                          SUIT_COMPONENT_STATE_INSTALLED));
+    TEST_ASSERT_EQUAL_INT(IS_USED(MODULE_SUIT_DIGEST_STREAM),
+                          suit_component_check_flag(&manifest.components[0],
+                                                    SUIT_COMPONENT_STATE_DIGESTED));
+
+    /* the digest of manifest5 doesn't match, with or without streaming */
+    TEST_ASSERT_EQUAL_INT(SUIT_ERR_DIGEST_MISMATCH,
+                          test_suit_manifest(manifest5_bin, sizeof(manifest5_bin)));
+    TEST_ASSERT(!suit_component_check_flag(&manifest.components[0],
+                                           SUIT_COMPONENT_STATE_INSTALLED));
+}
+
 Test *tests_suit_manifest(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_suit_manifest_01_manifests),
+        new_TestFixture(test_suit_manifest_02_digest_stream),
     };
 
     EMB_UNIT_TESTCALLER(suit_manifest_tests, NULL, NULL, fixtures);
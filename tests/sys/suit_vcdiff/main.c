@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests for applying SUIT VCDIFF delta payloads
+ *
+ * A mock storage backend provides the installed payload with
+ * read_installed() and keeps the reconstructed image, which is passed to it
+ * in chunks of @ref CONFIG_SUIT_VCDIFF_BUF_SIZE bytes.
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "container.h"
+#include "embUnit.h"
+#include "suit.h"
+#include "suit/storage.h"
+#include "suit/vcdiff.h"
+
+/* Same vector as tests/pkg/tinyvcdiff, generated using open-vcdiff:
+ * $ echo "Hello world! I hope you are doing well ..." >source.bin
+ * $ echo "Hello universe! I hope you are doing well ..." >target.bin
+ * $ vcdiff delta -interleaved -dictionary source.bin <target.bin >delta.bin */
+#include "blob/source.bin.h"
+#include "blob/target.bin.h"
+#include "blob/delta.bin.h"
+
+/* Delta against source.bin that also copies from the target:
+ *  COPY 6 from source @0           "Hello "
+ *  ADD 8                           "universe"
+ *  COPY 8 from source @11          "! I hope"
+ *  COPY 14 from target @6          "universe! I ho"
+ *  ADD 1                           "\n"
+ * The last copy starts in the part of the image that is already stored and
+ * ends in the part that is still buffered. */
+static const uint8_t _delta_self[] = {
+    0xd6, 0xc3, 0xc4, 0x53, 0x00, 0x01, 0x2b, 0x00,
+    0x16, 0x25, 0x00, 0x00, 0x11, 0x00, 0x16, 0x00,
+    0x09, 0x75, 0x6e, 0x69, 0x76, 0x65, 0x72, 0x73,
+    0x65, 0x18, 0x0b, 0x1e, 0x31, 0x02, 0x0a,
+};
+static const char _target_self[] = "Hello universe! I hopeuniverse! I ho\n";
+
+#define IMAGE_MAX   (64U)
+
+typedef struct {
+    suit_storage_t storage;
+    uint8_t image[IMAGE_MAX];
+    size_t written;             /**< bytes of the image written so far */
+    unsigned reads;             /**< reads of the written image */
+    unsigned finished;          /**< calls with more == 0 */
+    bool chunks_ok;             /**< all but the last chunk are complete */
+} _mock_storage_t;
+
+static int _mock_write(suit_storage_t *storage, const suit_manifest_t *manifest,
+                       const uint8_t *buf, size_t offset, size_t len)
+{
+    (void)manifest;
+    _mock_storage_t *mock = container_of(storage, _mock_storage_t, storage);
+
+    if ((offset != mock->written) || (offset + len > sizeof(mock->image))) {
+        return SUIT_ERR_STORAGE;
+    }
+    memcpy(&mock->image[offset], buf, len);
+    mock->written += len;
+    return SUIT_OK;
+}
+
+static int _mock_read(suit_storage_t *storage, uint8_t *buf, size_t offset,
+                      size_t len)
+{
+    _mock_storage_t *mock = container_of(storage, _mock_storage_t, storage);
+
+    if (offset + len > mock->written) {
+        return SUIT_ERR_STORAGE;
+    }
+    memcpy(buf, &mock->image[offset], len);
+    mock->reads++;
+    return SUIT_OK;
+}
+
+static int _mock_read_installed(suit_storage_t *storage, uint8_t *buf,
+                                size_t offset, size_t len)
+{
+    (void)storage;
+
+    if (offset + len > sizeof(source_bin)) {
+        return SUIT_ERR_STORAGE;
+    }
+    memcpy(buf, &source_bin[offset], len);
+    return SUIT_OK;
+}
+
+static const suit_storage_driver_t _mock_driver = {
+    .write = _mock_write,
+    .read = _mock_read,
+    .read_installed = _mock_read_installed,
+};
+
+static const suit_storage_driver_t _mock_driver_no_installed = {
+    .write = _mock_write,
+    .read = _mock_read,
+};
+
+static _mock_storage_t _mock;
+static suit_vcdiff_t _vcdiff;
+
+/* Stores the reconstructed image like the SUIT fetch callback does */
+static int _store(void *arg, size_t offset, uint8_t *buf, size_t len, int more)
+{
+    _mock_storage_t *mock = arg;
+
+    if (more && (len != CONFIG_SUIT_VCDIFF_BUF_SIZE)) {
+        mock->chunks_ok = false;
+    }
+    if (!more) {
+        mock->finished++;
+    }
+    return suit_storage_write(&mock->storage, NULL, buf, offset, len);
+}
+
+static int _store_fail(void *arg, size_t offset, uint8_t *buf, size_t len,
+                       int more)
+{
+    (void)arg;
+    (void)offset;
+    (void)buf;
+    (void)len;
+    (void)more;
+    return SUIT_ERR_STORAGE;
+}
+
+static void set_up(void)
+{
+    memset(&_mock, 0, sizeof(_mock));
+    _mock.storage.driver = &_mock_driver;
+    _mock.chunks_ok = true;
+}
+
+static void _check_image(const void *expected, size_t len)
+{
+    TEST_ASSERT_EQUAL_INT(len, _mock.written);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, _mock.image, len));
+    TEST_ASSERT_EQUAL_INT(1, _mock.finished);
+    TEST_ASSERT(_mock.chunks_ok);
+}
+
+static void test_suit_vcdiff_known_delta(void)
+{
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_vcdiff_init(&_vcdiff, &_mock.storage,
+                                                    _store, &_mock));
+    TEST_ASSERT_EQUAL_INT(0, suit_vcdiff_apply(&_vcdiff, delta_bin,
+                                               sizeof(delta_bin)));
+    TEST_ASSERT_EQUAL_INT(0, _mock.finished);
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_vcdiff_finish(&_vcdiff));
+    _check_image(target_bin, sizeof(target_bin));
+}
+
+static void test_suit_vcdiff_bytewise(void)
+{
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_vcdiff_init(&_vcdiff, &_mock.storage,
+                                                    _store, &_mock));
+    for (unsigned i = 0; i < sizeof(delta_bin); i++) {
+        TEST_ASSERT_EQUAL_INT(0, suit_vcdiff_apply(&_vcdiff, &delta_bin[i], 1));
+    }
+    /* the fetch callback expects the next chunk at this offset */
+    TEST_ASSERT_EQUAL_INT(sizeof(delta_bin), _vcdiff.delta_len);
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_vcdiff_finish(&_vcdiff));
+    _check_image(target_bin, sizeof(target_bin));
+}
+
+static void test_suit_vcdiff_copy_from_target(void)
+{
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_vcdiff_init(&_vcdiff, &_mock.storage,
+                                                    _store, &_mock));
+    TEST_ASSERT_EQUAL_INT(0, suit_vcdiff_apply(&_vcdiff, _delta_self,
+                                               sizeof(_delta_self)));
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_vcdiff_finish(&_vcdiff));
+    _check_image(_target_self, sizeof(_target_self) - 1);
+    /* the stored part of the copy was read back from the storage */
+    TEST_ASSERT(_mock.reads > 0);
+}
+
+static void test_suit_vcdiff_no_installed(void)
+{
+    _mock.storage.driver = &_mock_driver_no_installed;
+    TEST_ASSERT_EQUAL_INT(SUIT_ERR_UNSUPPORTED,
+                          suit_vcdiff_init(&_vcdiff, &_mock.storage, _store,
+                                           &_mock));
+}
+
+static void test_suit_vcdiff_truncated(void)
+{
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_vcdiff_init(&_vcdiff, &_mock.storage,
+                                                    _store, &_mock));
+    TEST_ASSERT_EQUAL_INT(0, suit_vcdiff_apply(&_vcdiff, delta_bin,
+                                               sizeof(delta_bin) - 4));
+    TEST_ASSERT(suit_vcdiff_finish(&_vcdiff) < 0);
+    TEST_ASSERT_EQUAL_INT(0, _mock.finished);
+}
+
+static void test_suit_vcdiff_callback_error(void)
+{
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_vcdiff_init(&_vcdiff, &_mock.storage,
+                                                    _store_fail, &_mock));
+    /* the target is longer than one chunk, so the callback is called */
+    TEST_ASSERT(suit_vcdiff_apply(&_vcdiff, delta_bin, sizeof(delta_bin)) < 0);
+}
+
+static Test *tests_suit_vcdiff(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_suit_vcdiff_known_delta),
+        new_TestFixture(test_suit_vcdiff_bytewise),
+        new_TestFixture(test_suit_vcdiff_copy_from_target),
+        new_TestFixture(test_suit_vcdiff_no_installed),
+        new_TestFixture(test_suit_vcdiff_truncated),
+        new_TestFixture(test_suit_vcdiff_callback_error),
+    };
+
+    EMB_UNIT_TESTCALLER(suit_vcdiff_tests, set_up, NULL, fixtures);
+    return (Test *)&suit_vcdiff_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_suit_vcdiff());
+    TESTS_END();
+    return 0;
+}
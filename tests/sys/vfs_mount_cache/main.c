@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test for the VFS mount point lookup cache
+ *
+ * The VFS unit tests cover the lookup without the cache.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#include "embUnit.h"
+#include "container.h"
+#include "fs/constfs.h"
+#include "vfs.h"
+
+static const char _data[] = "data";
+
+static const constfs_file_t _files_a[] = {
+    { .path = "/a.txt", .data = _data, .size = sizeof(_data) },
+};
+
+static const constfs_file_t _files_b[] = {
+    { .path = "/b.txt", .data = _data, .size = sizeof(_data) },
+};
+
+static const constfs_t _fs_a = { .files = _files_a, .nfiles = ARRAY_SIZE(_files_a) };
+static const constfs_t _fs_b = { .files = _files_b, .nfiles = ARRAY_SIZE(_files_b) };
+
+static vfs_mount_t _mount_test = {
+    .mount_point = "/test",
+    .fs = &constfs_file_system,
+    .private_data = (void *)&_fs_a,
+};
+
+static vfs_mount_t _mount_tests = {
+    .mount_point = "/tests",
+    .fs = &constfs_file_system,
+    .private_data = (void *)&_fs_b,
+};
+
+static vfs_mount_t _mount_nested = {
+    .mount_point = "/test/sub",
+    .fs = &constfs_file_system,
+    .private_data = (void *)&_fs_b,
+};
+
+static vfs_mount_t _mount_other[] = {
+    { .mount_point = "/m0", .fs = &constfs_file_system, .private_data = (void *)&_fs_a },
+    { .mount_point = "/m1", .fs = &constfs_file_system, .private_data = (void *)&_fs_a },
+    { .mount_point = "/m2", .fs = &constfs_file_system, .private_data = (void *)&_fs_a },
+    { .mount_point = "/m3", .fs = &constfs_file_system, .private_data = (void *)&_fs_a },
+};
+
+static void _test_stat(const char *path, int expected)
+{
+    struct stat stat;
+
+    TEST_ASSERT_EQUAL_INT(expected, vfs_stat(path, &stat));
+}
+
+static void test_vfs_mount_cache_siblings(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&_mount_test));
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&_mount_tests));
+
+    /* the second round is served from the cache */
+    for (unsigned i = 0; i < 2; i++) {
+        _test_stat("/test/a.txt", 0);
+        _test_stat("/tests/b.txt", 0);
+        _test_stat("/tests/a.txt", -ENOENT);
+        _test_stat("/test/b.txt", -ENOENT);
+        _test_stat("/tes/a.txt", -ENOENT);
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&_mount_tests, false));
+    _test_stat("/tests/b.txt", -ENOENT);
+    _test_stat("/test/a.txt", 0);
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&_mount_test, false));
+    _test_stat("/test/a.txt", -ENOENT);
+}
+
+static void test_vfs_mount_cache_nested(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&_mount_test));
+    for (unsigned i = 0; i < 2; i++) {
+        _test_stat("/test/a.txt", 0);
+        _test_stat("/test/sub/b.txt", -ENOENT);
+    }
+
+    /* a cached entry must not hide a nested mount point mounted later */
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&_mount_nested));
+    for (unsigned i = 0; i < 2; i++) {
+        _test_stat("/test/sub/b.txt", 0);
+        _test_stat("/test/a.txt", 0);
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&_mount_nested, false));
+    for (unsigned i = 0; i < 2; i++) {
+        _test_stat("/test/sub/b.txt", -ENOENT);
+        _test_stat("/test/a.txt", 0);
+    }
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&_mount_test, false));
+}
+
+static void test_vfs_mount_cache_collisions(void)
+{
+    char path[] = "/mX/a.txt";
+
+    /* more mount points than cache slots */
+    for (unsigned i = 0; i < ARRAY_SIZE(_mount_other); i++) {
+        TEST_ASSERT_EQUAL_INT(0, vfs_mount(&_mount_other[i]));
+    }
+
+    for (unsigned round = 0; round < 3; round++) {
+        for (unsigned i = 0; i < ARRAY_SIZE(_mount_other); i++) {
+            path[2] = '0' + i;
+            _test_stat(path, 0);
+        }
+    }
+
+    /* an unmounted mount point must not be served from the cache */
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&_mount_other[1], false));
+    _test_stat("/m1/a.txt", -ENOENT);
+    _test_stat("/m0/a.txt", 0);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_mount_other); i++) {
+        if (i != 1) {
+            TEST_ASSERT_EQUAL_INT(0, vfs_umount(&_mount_other[i], false));
+        }
+    }
+    _test_stat("/m0/a.txt", -ENOENT);
+}
+
+Test *tests_vfs_mount_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_vfs_mount_cache_siblings),
+        new_TestFixture(test_vfs_mount_cache_nested),
+        new_TestFixture(test_vfs_mount_cache_collisions),
+    };
+
+    EMB_UNIT_TESTCALLER(vfs_mount_cache_tests, NULL, NULL, fixtures);
+
+    return (Test *)&vfs_mount_cache_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_vfs_mount_cache_tests());
+    TESTS_END();
+    return 0;
+}
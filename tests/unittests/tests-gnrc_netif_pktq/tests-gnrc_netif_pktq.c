@@ -39,7 +39,8 @@ static void test_pktq_usage__empty(void)
 
 static void test_pktq_put__full(void)
 {
-    gnrc_pktsnip_t pkt;
+    /* stays in the queue until the next set_up() */
+    static gnrc_pktsnip_t pkt;
 
     for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE; i++) {
         TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &pkt));
@@ -51,7 +52,7 @@ static void test_pktq_put__full(void)
 
 static void test_pktq_put_get1(void)
 {
-    gnrc_pktsnip_t pkt_in, *pkt_out;
+    gnrc_pktsnip_t pkt_in = { 0 }, *pkt_out;
 
     TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &pkt_in));
     TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_usage());
@@ -62,7 +63,7 @@ static void test_pktq_put_get1(void)
 
 static void test_pktq_put_get3(void)
 {
-    gnrc_pktsnip_t pkt_in[3];
+    gnrc_pktsnip_t pkt_in[3] = { 0 };
 
     for (unsigned i = 0; i < 3; i++) {
         TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &pkt_in[i]));
@@ -79,7 +80,8 @@ static void test_pktq_put_get3(void)
 
 static void test_pktq_push_back__full(void)
 {
-    gnrc_pktsnip_t pkt;
+    /* stays in the queue until the next set_up() */
+    static gnrc_pktsnip_t pkt;
 
     for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE; i++) {
         TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &pkt));
@@ -91,7 +93,7 @@ static void test_pktq_push_back__full(void)
 
 static void test_pktq_push_back_get1(void)
 {
-    gnrc_pktsnip_t pkt_in, *pkt_out;
+    gnrc_pktsnip_t pkt_in = { 0 }, *pkt_out;
 
     TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_push_back(&_netif, &pkt_in));
     TEST_ASSERT_EQUAL_INT(1, gnrc_netif_pktq_usage());
@@ -102,7 +104,7 @@ static void test_pktq_push_back_get1(void)
 
 static void test_pktq_push_back_get3(void)
 {
-    gnrc_pktsnip_t pkt_in[3];
+    gnrc_pktsnip_t pkt_in[3] = { 0 };
 
     for (unsigned i = 0; i < 3; i++) {
         TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_push_back(&_netif, &pkt_in[i]));
@@ -119,7 +121,7 @@ static void test_pktq_push_back_get3(void)
 
 static void test_pktq_empty(void)
 {
-    gnrc_pktsnip_t pkt_in;
+    gnrc_pktsnip_t pkt_in = { 0 };
 
     TEST_ASSERT(gnrc_netif_pktq_empty(&_netif));
     TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, &pkt_in));
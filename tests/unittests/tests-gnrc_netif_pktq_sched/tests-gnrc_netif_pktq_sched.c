@@ -0,0 +1,300 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/gnrc/netif/conf.h"
+#include "net/gnrc/netif/pktq.h"
+#include "net/icmpv6.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/sixlowpan.h"
+
+#include "tests-gnrc_netif_pktq_sched.h"
+
+#define DSCP_CS1    (8U)
+#define DSCP_CS6    (48U)
+#define DSCP_EF     (46U)
+
+typedef struct {
+    gnrc_pktsnip_t ipv6;
+    gnrc_pktsnip_t payload;
+    ipv6_hdr_t hdr;
+    uint8_t type;
+} _test_pkt_t;
+
+static gnrc_netif_t _netif;
+static _test_pkt_t _pkts[CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE];
+
+static gnrc_pktsnip_t *_init_pkt(_test_pkt_t *pkt, uint8_t dscp, uint8_t nh,
+                                 uint8_t type, size_t len)
+{
+    memset(pkt, 0, sizeof(*pkt));
+    ipv6_hdr_set_version(&pkt->hdr);
+    ipv6_hdr_set_tc_dscp(&pkt->hdr, dscp);
+    pkt->hdr.nh = nh;
+    pkt->type = type;
+    pkt->ipv6.type = GNRC_NETTYPE_IPV6;
+    pkt->ipv6.data = &pkt->hdr;
+    pkt->ipv6.size = sizeof(pkt->hdr);
+    pkt->ipv6.next = &pkt->payload;
+    pkt->payload.type = (nh == PROTNUM_ICMPV6) ? GNRC_NETTYPE_ICMPV6
+                                               : GNRC_NETTYPE_UNDEF;
+    pkt->payload.data = &pkt->type;
+    pkt->payload.size = len - sizeof(pkt->hdr);
+    return &pkt->ipv6;
+}
+
+typedef struct {
+    gnrc_pktsnip_t netif;
+    gnrc_pktsnip_t sixlo;
+    gnrc_pktsnip_t payload;
+    uint8_t type;
+} _test_sixlo_pkt_t;
+
+/* IPHC: TF, HLIM elided, link-local source from L2, ff02::1a, next header
+ * ICMPv6 inline. Both ICMPv6 types follow in the next snip */
+static const uint8_t _iphc_icmpv6[] = { 0x7b, 0x3b, PROTNUM_ICMPV6, 0x1a };
+/* IPHC: DSCP EF inline, UDP NHC with ports inline */
+static const uint8_t _iphc_udp_ef[] = {
+    0x77, 0x33, DSCP_EF << 2, 0xf0, 0x16, 0x33, 0x16, 0x34, 0xab, 0xcd,
+};
+/* IPHC: all elided, UDP NHC */
+static const uint8_t _iphc_udp[] = {
+    0x7f, 0x33, 0xf0, 0x16, 0x33, 0x16, 0x34, 0xab, 0xcd,
+};
+/* first fragment with the IPHC header of a DIO, ICMPv6 header included */
+static const uint8_t _frag1_dio[] = {
+    0xc0, 0x80, 0x12, 0x34, 0x7b, 0x3b, PROTNUM_ICMPV6, 0x1a,
+    ICMPV6_RPL_CTRL, 0x01,
+};
+/* subsequent fragment of the same datagram */
+static const uint8_t _fragn[] = { 0xe0, 0x80, 0x12, 0x34, 0x0c, 0x00 };
+
+static gnrc_pktsnip_t *_init_sixlo_pkt(_test_sixlo_pkt_t *pkt, const void *hdr,
+                                       size_t hdr_len, uint8_t type)
+{
+    memset(pkt, 0, sizeof(*pkt));
+    pkt->type = type;
+    pkt->netif.type = GNRC_NETTYPE_NETIF;
+    pkt->netif.next = &pkt->sixlo;
+    pkt->sixlo.type = GNRC_NETTYPE_SIXLOWPAN;
+    pkt->sixlo.data = (void *)hdr;
+    pkt->sixlo.size = hdr_len;
+    if (type) {
+        pkt->sixlo.next = &pkt->payload;
+        pkt->payload.type = GNRC_NETTYPE_ICMPV6;
+        pkt->payload.data = &pkt->type;
+        pkt->payload.size = 16;
+    }
+    return &pkt->netif;
+}
+
+static void set_up(void)
+{
+    memset(&_netif, 0, sizeof(_netif));
+}
+
+static void tear_down(void)
+{
+    /* give the shared pool back for other test suites */
+    while (gnrc_netif_pktq_get(&_netif)) { }
+}
+
+static void test_pktq_sched_classify(void)
+{
+    gnrc_pktsnip_t *pkt;
+    gnrc_pktsnip_t undef = { 0 };
+
+    pkt = _init_pkt(&_pkts[0], 0, PROTNUM_ICMPV6, ICMPV6_NBR_SOL, 64);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_CONTROL,
+                          gnrc_netif_pktq_classify(pkt));
+    pkt = _init_pkt(&_pkts[0], 0, PROTNUM_ICMPV6, ICMPV6_ECHO_REQ, 64);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_DEFAULT,
+                          gnrc_netif_pktq_classify(pkt));
+    pkt = _init_pkt(&_pkts[0], DSCP_CS6, PROTNUM_UDP, 0, 64);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_CONTROL,
+                          gnrc_netif_pktq_classify(pkt));
+    pkt = _init_pkt(&_pkts[0], DSCP_EF, PROTNUM_UDP, 0, 64);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_INTERACTIVE,
+                          gnrc_netif_pktq_classify(pkt));
+    pkt = _init_pkt(&_pkts[0], 0, PROTNUM_UDP, 0, 64);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_DEFAULT,
+                          gnrc_netif_pktq_classify(pkt));
+    pkt = _init_pkt(&_pkts[0], DSCP_CS1, PROTNUM_UDP, 0, 64);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_BULK,
+                          gnrc_netif_pktq_classify(pkt));
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_DEFAULT,
+                          gnrc_netif_pktq_classify(&undef));
+}
+
+static void test_pktq_sched_classify_sixlowpan(void)
+{
+    static _test_sixlo_pkt_t sixlo;
+    static uint8_t uncomp[1 + sizeof(ipv6_hdr_t) + 1];
+    ipv6_hdr_t *hdr = (ipv6_hdr_t *)&uncomp[1];
+    gnrc_pktsnip_t *pkt;
+
+    pkt = _init_sixlo_pkt(&sixlo, _iphc_icmpv6, sizeof(_iphc_icmpv6),
+                          ICMPV6_RPL_CTRL);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_CONTROL,
+                          gnrc_netif_pktq_classify(pkt));
+    pkt = _init_sixlo_pkt(&sixlo, _iphc_icmpv6, sizeof(_iphc_icmpv6),
+                          ICMPV6_ECHO_REQ);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_DEFAULT,
+                          gnrc_netif_pktq_classify(pkt));
+    pkt = _init_sixlo_pkt(&sixlo, _iphc_udp_ef, sizeof(_iphc_udp_ef), 0);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_INTERACTIVE,
+                          gnrc_netif_pktq_classify(pkt));
+    pkt = _init_sixlo_pkt(&sixlo, _iphc_udp, sizeof(_iphc_udp), 0);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_DEFAULT,
+                          gnrc_netif_pktq_classify(pkt));
+    pkt = _init_sixlo_pkt(&sixlo, _frag1_dio, sizeof(_frag1_dio), 0);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_CONTROL,
+                          gnrc_netif_pktq_classify(pkt));
+    pkt = _init_sixlo_pkt(&sixlo, _fragn, sizeof(_fragn), 0);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_DEFAULT,
+                          gnrc_netif_pktq_classify(pkt));
+
+    uncomp[0] = SIXLOWPAN_UNCOMP;
+    ipv6_hdr_set_version(hdr);
+    hdr->nh = PROTNUM_ICMPV6;
+    uncomp[sizeof(uncomp) - 1] = ICMPV6_NBR_SOL;
+    pkt = _init_sixlo_pkt(&sixlo, uncomp, sizeof(uncomp), 0);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_PKTQ_CLASS_CONTROL,
+                          gnrc_netif_pktq_classify(pkt));
+}
+
+static void test_pktq_sched_sixlowpan_priority(void)
+{
+    static _test_sixlo_pkt_t data, dio;
+    gnrc_pktsnip_t *data_pkt = _init_sixlo_pkt(&data, _iphc_udp,
+                                               sizeof(_iphc_udp), 0);
+    gnrc_pktsnip_t *dio_pkt = _init_sixlo_pkt(&dio, _iphc_icmpv6,
+                                              sizeof(_iphc_icmpv6),
+                                              ICMPV6_RPL_CTRL);
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, data_pkt));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, dio_pkt));
+    /* the compressed DIO overtakes the data frame queued before it */
+    TEST_ASSERT(dio_pkt == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(data_pkt == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT_NULL(gnrc_netif_pktq_get(&_netif));
+}
+
+static void test_pktq_sched_strict_priority(void)
+{
+    gnrc_pktsnip_t *bulk = _init_pkt(&_pkts[0], DSCP_CS1, PROTNUM_UDP, 0, 64);
+    gnrc_pktsnip_t *def = _init_pkt(&_pkts[1], 0, PROTNUM_UDP, 0, 64);
+    gnrc_pktsnip_t *ctrl = _init_pkt(&_pkts[2], 0, PROTNUM_ICMPV6,
+                                     ICMPV6_RPL_CTRL, 64);
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, bulk));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, def));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, ctrl));
+    TEST_ASSERT(ctrl == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(def == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(bulk == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT_NULL(gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(gnrc_netif_pktq_empty(&_netif));
+}
+
+static void test_pktq_sched_drr(void)
+{
+    gnrc_pktsnip_t *def[2], *bulk[2];
+
+    /* quantum of DEFAULT fits one of its packets per round, quantum of
+     * BULK one of its packets, so both classes must alternate */
+    for (unsigned i = 0; i < 2; i++) {
+        def[i] = _init_pkt(&_pkts[i], 0, PROTNUM_UDP, 0,
+                           CONFIG_GNRC_NETIF_PKTQ_SCHED_QUANTUM_DEFAULT - 50);
+        bulk[i] = _init_pkt(&_pkts[i + 2], DSCP_CS1, PROTNUM_UDP, 0,
+                            CONFIG_GNRC_NETIF_PKTQ_SCHED_QUANTUM_BULK - 20);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, def[i]));
+    }
+    for (unsigned i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, bulk[i]));
+    }
+    TEST_ASSERT(def[0] == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(bulk[0] == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(def[1] == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(bulk[1] == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT_NULL(gnrc_netif_pktq_get(&_netif));
+}
+
+static void test_pktq_sched_push_back(void)
+{
+    gnrc_pktsnip_t *def = _init_pkt(&_pkts[0], 0, PROTNUM_UDP, 0, 64);
+    gnrc_pktsnip_t *bulk = _init_pkt(&_pkts[1], DSCP_CS1, PROTNUM_UDP, 0, 64);
+    const gnrc_netif_pktq_stats_t *stats;
+    gnrc_pktsnip_t *pkt;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, def));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, bulk));
+    TEST_ASSERT((pkt = gnrc_netif_pktq_get(&_netif)) == def);
+    /* sending failed, so the packet must be next again */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_push_back(&_netif, pkt));
+    stats = gnrc_netif_pktq_stats(&_netif, GNRC_NETIF_PKTQ_CLASS_DEFAULT);
+    TEST_ASSERT_EQUAL_INT(1, stats->enqueued);
+    TEST_ASSERT_EQUAL_INT(1, stats->len);
+    TEST_ASSERT(def == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT(bulk == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_usage());
+}
+
+static void test_pktq_sched_stats(void)
+{
+    const gnrc_netif_pktq_stats_t *stats;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE; i++) {
+        gnrc_pktsnip_t *pkt = _init_pkt(&_pkts[i], DSCP_EF, PROTNUM_UDP, 0, 64);
+
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_put(&_netif, pkt));
+    }
+    TEST_ASSERT_EQUAL_INT(-1, gnrc_netif_pktq_put(&_netif, &_pkts[0].ipv6));
+    TEST_ASSERT_NOT_NULL(gnrc_netif_pktq_get(&_netif));
+    stats = gnrc_netif_pktq_stats(&_netif, GNRC_NETIF_PKTQ_CLASS_INTERACTIVE);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE, stats->enqueued);
+    TEST_ASSERT_EQUAL_INT(1, stats->dropped);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE - 1, stats->len);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE, stats->high_water);
+    stats = gnrc_netif_pktq_stats(&_netif, GNRC_NETIF_PKTQ_CLASS_DEFAULT);
+    TEST_ASSERT_EQUAL_INT(0, stats->enqueued);
+}
+
+static Test *test_gnrc_netif_pktq_sched(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_pktq_sched_classify),
+        new_TestFixture(test_pktq_sched_classify_sixlowpan),
+        new_TestFixture(test_pktq_sched_sixlowpan_priority),
+        new_TestFixture(test_pktq_sched_strict_priority),
+        new_TestFixture(test_pktq_sched_drr),
+        new_TestFixture(test_pktq_sched_push_back),
+        new_TestFixture(test_pktq_sched_stats),
+    };
+
+    EMB_UNIT_TESTCALLER(pktq_sched_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&pktq_sched_tests;
+}
+
+void tests_gnrc_netif_pktq_sched(void)
+{
+    TESTS_RUN(test_gnrc_netif_pktq_sched());
+}
+
+/** @} */
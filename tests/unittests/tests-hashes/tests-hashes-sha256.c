@@ -29,6 +29,7 @@
 
 #include "embUnit/embUnit.h"
 
+#include "container.h"
 #include "hashes/sha256.h"
 
 #include "tests-hashes.h"
@@ -267,6 +268,45 @@ static void test_hashes_sha256_hash_sequence_abc_long(void)
     TEST_ASSERT(calc_and_compare_hash_wrapper(teststring, h_fips_multiblock));
 }
 
+static void test_hashes_sha256_iolist(void)
+{
+    static const char *teststring = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    static unsigned char hash[SHA256_DIGEST_LENGTH];
+    iolist_t iol[3] = {
+        { .iol_next = &iol[1], .iol_base = (void *)teststring, .iol_len = 5 },
+        { .iol_next = &iol[2], .iol_base = (void *)&teststring[5], .iol_len = 0 },
+        { .iol_next = NULL, .iol_base = (void *)&teststring[5],
+          .iol_len = strlen(teststring) - 5 },
+    };
+
+    sha256_iolist(iol, hash);
+    TEST_ASSERT(memcmp(h_fips_multiblock, hash, SHA256_DIGEST_LENGTH) == 0);
+}
+
+static void test_hashes_sha256_mb(void)
+{
+    /* lengths around the block and padding boundaries */
+    static const size_t lens[] = { 0, 3, 55, 56, 63, 64, 65, 119, 120, 200, 1 };
+    static uint8_t msg[256];
+    static uint8_t digests[ARRAY_SIZE(lens)][SHA256_DIGEST_LENGTH];
+    const void *data[ARRAY_SIZE(lens)];
+    unsigned char hash[SHA256_DIGEST_LENGTH];
+
+    for (unsigned i = 0; i < sizeof(msg); i++) {
+        msg[i] = i * 13;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(lens); i++) {
+        /* let the messages start at different offsets */
+        data[i] = &msg[i];
+    }
+
+    sha256_mb(data, lens, ARRAY_SIZE(lens), digests);
+    for (unsigned i = 0; i < ARRAY_SIZE(lens); i++) {
+        sha256(data[i], lens[i], hash);
+        TEST_ASSERT(memcmp(digests[i], hash, SHA256_DIGEST_LENGTH) == 0);
+    }
+}
+
 Test *tests_hashes_sha256_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -285,6 +325,9 @@ Test *tests_hashes_sha256_tests(void)
 
         new_TestFixture(test_hashes_sha256_hash_sequence_abc),
         new_TestFixture(test_hashes_sha256_hash_sequence_abc_long),
+
+        new_TestFixture(test_hashes_sha256_iolist),
+        new_TestFixture(test_hashes_sha256_mb),
     };
 
     EMB_UNIT_TESTCALLER(hashes_sha256_tests, NULL, NULL,
@@ -964,6 +964,55 @@ static void test_nanocoap__options_get_opaque(void)
     TEST_ASSERT_EQUAL_INT(-ENOENT, optlen);
 }
 
+/*
+ * Tests that coap_find_option() finds every option of a parsed packet with
+ * many (partially repeated) options, and reports absent ones in between.
+ */
+static void test_nanocoap__find_option(void)
+{
+    uint8_t buf[_BUF_SIZE];
+    coap_pkt_t pkt;
+    uint8_t token[2] = {0xDA, 0xEC};
+    static const uint16_t optnums[] = {
+        COAP_OPT_IF_MATCH, COAP_OPT_URI_HOST, COAP_OPT_ETAG, COAP_OPT_OBSERVE,
+        COAP_OPT_LOCATION_PATH, COAP_OPT_URI_PATH, COAP_OPT_URI_PATH,
+        COAP_OPT_CONTENT_FORMAT, COAP_OPT_MAX_AGE, COAP_OPT_URI_QUERY,
+        COAP_OPT_URI_QUERY, COAP_OPT_ACCEPT, COAP_OPT_BLOCK2, COAP_OPT_SIZE1,
+    };
+
+    coap_pkt_init(&pkt, buf, sizeof(buf),
+                  coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_NON, token, sizeof(token),
+                                 COAP_METHOD_GET, 23));
+    for (unsigned i = 0; i < ARRAY_SIZE(optnums); i++) {
+        /* use the index as value to tell repeated options apart */
+        TEST_ASSERT(coap_opt_add_uint(&pkt, optnums[i], i) > 0);
+    }
+    ssize_t len = coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE);
+    TEST_ASSERT(len > 0);
+
+    memset(&pkt, 0, sizeof(pkt));
+    TEST_ASSERT_EQUAL_INT(0, coap_parse(&pkt, buf, len));
+
+    for (unsigned i = 0; i < ARRAY_SIZE(optnums); i++) {
+        uint32_t value;
+        TEST_ASSERT_EQUAL_INT(0, coap_opt_get_uint(&pkt, optnums[i], &value));
+        /* repeated options report the value of the first occurrence */
+        unsigned first = i;
+        while ((first > 0) && (optnums[first - 1] == optnums[i])) {
+            first--;
+        }
+        TEST_ASSERT_EQUAL_INT(first, value);
+    }
+
+    for (unsigned num = 0; num <= COAP_OPT_SIZE1 + 1; num++) {
+        bool exists = false;
+        for (unsigned i = 0; i < ARRAY_SIZE(optnums); i++) {
+            exists |= (optnums[i] == num);
+        }
+        TEST_ASSERT_EQUAL_INT(exists, coap_find_option(&pkt, num) != NULL);
+    }
+}
+
 /*
  * Validates empty message parsing.
  */
@@ -1276,6 +1325,7 @@ Test *tests_nanocoap_tests(void)
         new_TestFixture(test_nanocoap__option_remove_no_payload),
         new_TestFixture(test_nanocoap__options_get_opaque),
         new_TestFixture(test_nanocoap__options_iterate),
+        new_TestFixture(test_nanocoap__find_option),
         new_TestFixture(test_nanocoap__server_get_req),
         new_TestFixture(test_nanocoap__server_reply_simple),
         new_TestFixture(test_nanocoap__server_get_req_con),
@@ -55,6 +55,19 @@ static const constfs_t fs_data = {
     .nfiles = ARRAY_SIZE(_files),
 };
 
+static const constfs_file_t _files_nested[] = {
+    {
+        .path = "/nested.txt",
+        .data = str_data,
+        .size = sizeof(str_data),
+    },
+};
+
+static const constfs_t fs_data_nested = {
+    .files = _files_nested,
+    .nfiles = ARRAY_SIZE(_files_nested),
+};
+
 static vfs_mount_t _test_vfs_mount_invalid_mount = {
     .mount_point = "test",
     .fs = &constfs_file_system,
@@ -67,6 +80,18 @@ static vfs_mount_t _test_vfs_mount = {
     .private_data = (void *)&fs_data,
 };
 
+static vfs_mount_t _test_vfs_mount_nested = {
+    .mount_point = "/test/sub",
+    .fs = &constfs_file_system,
+    .private_data = (void *)&fs_data_nested,
+};
+
+static vfs_mount_t _test_vfs_mount_sibling = {
+    .mount_point = "/tests",
+    .fs = &constfs_file_system,
+    .private_data = (void *)&fs_data_nested,
+};
+
 static void test_vfs_mount_umount(void)
 {
     int res;
@@ -173,6 +198,81 @@ static void test_vfs_constfs_read_lseek(void)
     TEST_ASSERT_EQUAL_INT(0, res);
 }
 
+static void test_vfs_constfs_read_ptr(void)
+{
+    int res;
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    int fd = vfs_open("/test/data.bin", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+
+    /* the file contents are not copied */
+    const void *data;
+    ssize_t nbytes = vfs_read_ptr(fd, &data, 8);
+    TEST_ASSERT_EQUAL_INT(8, nbytes);
+    TEST_ASSERT(data == &bin_data[0]);
+
+    /* and the position is advanced */
+    nbytes = vfs_read_ptr(fd, &data, sizeof(bin_data));
+    TEST_ASSERT_EQUAL_INT(sizeof(bin_data) - 8, nbytes);
+    TEST_ASSERT(data == &bin_data[8]);
+
+    nbytes = vfs_read_ptr(fd, &data, sizeof(bin_data));
+    TEST_ASSERT_EQUAL_INT(0, nbytes);
+
+    res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_umount(&_test_vfs_mount, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
+static void _test_stat(const char *path, int expected)
+{
+    struct stat stat;
+
+    TEST_ASSERT_EQUAL_INT(expected, vfs_stat(path, &stat));
+}
+
+static void test_vfs_constfs_nested(void)
+{
+    int res;
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_mount(&_test_vfs_mount_sibling);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    /* repeated lookups must resolve to the same mount */
+    for (unsigned i = 0; i < 2; i++) {
+        _test_stat("/test/test.txt", 0);
+        _test_stat("/tests/nested.txt", 0);
+        _test_stat("/tests/test.txt", -ENOENT);
+        _test_stat("/test/nested.txt", -ENOENT);
+        _test_stat("/tes/test.txt", -ENOENT);
+        _test_stat("/test/sub/nested.txt", -ENOENT);
+    }
+
+    /* a nested mount point takes precedence once it is mounted */
+    res = vfs_mount(&_test_vfs_mount_nested);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    for (unsigned i = 0; i < 2; i++) {
+        _test_stat("/test/sub/nested.txt", 0);
+        _test_stat("/test/test.txt", 0);
+    }
+
+    res = vfs_umount(&_test_vfs_mount_nested, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    _test_stat("/test/sub/nested.txt", -ENOENT);
+
+    res = vfs_umount(&_test_vfs_mount, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    _test_stat("/test/test.txt", -ENOENT);
+
+    res = vfs_umount(&_test_vfs_mount_sibling, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
 #if MODULE_NEWLIB || MODULE_PICOLIBC || defined(CPU_NATIVE)
 static void test_vfs_constfs__posix(void)
 {
@@ -212,6 +312,8 @@ Test *tests_vfs_mount_constfs_tests(void)
         new_TestFixture(test_vfs_umount__invalid_mount),
         new_TestFixture(test_vfs_constfs_open),
         new_TestFixture(test_vfs_constfs_read_lseek),
+        new_TestFixture(test_vfs_constfs_read_ptr),
+        new_TestFixture(test_vfs_constfs_nested),
 #if MODULE_NEWLIB || MODULE_PICOLIBC || defined(CPU_NATIVE)
         new_TestFixture(test_vfs_constfs__posix),
 #endif